@@ -23,6 +23,7 @@ namespace lar_content
 BdtBeamParticleIdTool::BdtBeamParticleIdTool() :
     m_useTrainingMode(false),
     m_trainingOutputFile(""),
+    m_trainingOutputFormat(LArMvaHelper::TRAINING_OUTPUT_CSV),
     m_minPurity(0.8f),
     m_minCompleteness(0.8f),
     m_adaBoostDecisionTree(AdaBoostDecisionTree()),
@@ -116,7 +117,7 @@ void BdtBeamParticleIdTool::SelectOutputPfos(const pandora::Algorithm *const pAl
             if (std::find(bestSliceIndices.begin(), bestSliceIndices.end(), sliceIndex) != bestSliceIndices.end())
                 isGoodTrainingSlice = true;
 
-            LArMvaHelper::ProduceTrainingExample(m_trainingOutputFile, isGoodTrainingSlice, featureVector);
+            LArMvaHelper::ProduceTrainingExample(m_trainingOutputFile, isGoodTrainingSlice, featureVector, m_trainingOutputFormat);
         }
 
         return;
@@ -688,6 +689,14 @@ float BdtBeamParticleIdTool::SliceFeatures::GetAdaBoostDecisionTreeScore(const A
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode BdtBeamParticleIdTool::Reset()
+{
+    LArMvaHelper::FlushTrainingExamples();
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode BdtBeamParticleIdTool::ReadSettings(const TiXmlHandle xmlHandle)
 {
     // BDT Settings
@@ -697,6 +706,8 @@ StatusCode BdtBeamParticleIdTool::ReadSettings(const TiXmlHandle xmlHandle)
     {
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "TrainingOutputFileName", m_trainingOutputFile));
 
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArMvaHelper::ReadTrainingOutputFormat(xmlHandle, m_trainingOutputFormat));
+
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "CaloHitListName", m_caloHitListName));
 
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "MCParticleListName", m_mcParticleListName));
@@ -383,15 +383,17 @@ private:
     void SelectPfosByAdaBDTScore(const pandora::Algorithm *const pAlgorithm, const SliceHypotheses &nuSliceHypotheses,
         const SliceHypotheses &crSliceHypotheses, const SliceFeaturesVector &sliceFeaturesVector, pandora::PfoList &selectedPfos) const;
 
+    pandora::StatusCode Reset();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
     // Training
     bool m_useTrainingMode;           ///< Should use training mode. If true, training examples will be written to the output file
     std::string m_trainingOutputFile; ///< Output file name for training examples
-    std::string m_caloHitListName;    ///< Name of input calo hit list
-    std::string m_mcParticleListName; ///< Name of input MC particle list
-    float m_minPurity;                ///< Minimum purity of the best slice to use event for training
-    float m_minCompleteness;          ///< Minimum completeness of the best slice to use event for training
+    LArMvaHelper::TrainingOutputFormat m_trainingOutputFormat; ///< The format of the training output file
+    std::string m_caloHitListName;                             ///< Name of input calo hit list
+    std::string m_mcParticleListName;                          ///< Name of input MC particle list
+    float m_minPurity;                                         ///< Minimum purity of the best slice to use event for training
+    float m_minCompleteness;                                   ///< Minimum completeness of the best slice to use event for training
 
     // Classification
     AdaBoostDecisionTree m_adaBoostDecisionTree;     ///< The adaptive boost decision tree
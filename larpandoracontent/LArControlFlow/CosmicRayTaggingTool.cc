@@ -15,6 +15,8 @@
 
 #include "larpandoracontent/LArObjects/LArCaloHit.h"
 
+#include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
+
 using namespace pandora;
 
 namespace lar_content
@@ -172,24 +174,72 @@ void CosmicRayTaggingTool::GetPfoAssociations(const PfoList &parentCosmicRayPfos
             std::make_pair(ThreeDSlidingFitResult(pCluster, 5, layerPitch), ThreeDSlidingFitResult(pCluster, 100, layerPitch)))); // TODO Configurable
     }
 
-    for (const ParticleFlowObject *const pPfo1 : parentCosmicRayPfos)
+    // ATTN Associated endpoints lie within the maximum separation allowed by CheckAssociation, so only nearby endpoints need to be compared
+    PfoVector fittedPfos;
+    PfoToIndexMap pfoToIndexMap;
+    PfoKDNode3DList kDNode3DList;
+
+    for (const ParticleFlowObject *const pPfo : parentCosmicRayPfos)
     {
-        PfoToSlidingFitsMap::const_iterator iter1(pfoToSlidingFitsMap.find(pPfo1));
-        if (pfoToSlidingFitsMap.end() == iter1)
+        PfoToSlidingFitsMap::const_iterator iter(pfoToSlidingFitsMap.find(pPfo));
+        if (pfoToSlidingFitsMap.end() == iter)
             continue;
 
-        const ThreeDSlidingFitResult &fitPos1(iter1->second.first), &fitDir1(iter1->second.second);
+        const ThreeDSlidingFitResult &fitPos(iter->second.first);
+        const CartesianVector &minLayerPosition(fitPos.GetGlobalMinLayerPosition()), &maxLayerPosition(fitPos.GetGlobalMaxLayerPosition());
+
+        (void)pfoToIndexMap.insert(PfoToIndexMap::value_type(pPfo, fittedPfos.size()));
+        fittedPfos.push_back(pPfo);
+        kDNode3DList.emplace_back(pPfo, minLayerPosition.GetX(), minLayerPosition.GetY(), minLayerPosition.GetZ());
+        kDNode3DList.emplace_back(pPfo, maxLayerPosition.GetX(), maxLayerPosition.GetY(), maxLayerPosition.GetZ());
+    }
 
-        for (const ParticleFlowObject *const pPfo2 : parentCosmicRayPfos)
+    if (kDNode3DList.empty())
+        return;
+
+    KDTreeCube boundingRegion(kDNode3DList.front().dims[0], kDNode3DList.front().dims[0], kDNode3DList.front().dims[1],
+        kDNode3DList.front().dims[1], kDNode3DList.front().dims[2], kDNode3DList.front().dims[2]);
+
+    for (const PfoKDNode3D &kDNode : kDNode3DList)
+    {
+        for (unsigned int i = 0; i < 3; ++i)
         {
-            if (pPfo1 == pPfo2)
-                continue;
+            boundingRegion.dimmin[i] = std::min(boundingRegion.dimmin[i], kDNode.dims[i]);
+            boundingRegion.dimmax[i] = std::max(boundingRegion.dimmax[i], kDNode.dims[i]);
+        }
+    }
 
-            PfoToSlidingFitsMap::const_iterator iter2(pfoToSlidingFitsMap.find(pPfo2));
-            if (pfoToSlidingFitsMap.end() == iter2)
-                continue;
+    PfoKDTree3D kdTree;
+    kdTree.build(kDNode3DList, boundingRegion);
+
+    const float searchDistance(this->GetMaxEndpointSeparation());
+
+    for (const ParticleFlowObject *const pPfo1 : fittedPfos)
+    {
+        const ThreeDSlidingFitResult &fitPos1(pfoToSlidingFitsMap.at(pPfo1).first), &fitDir1(pfoToSlidingFitsMap.at(pPfo1).second);
+
+        PfoKDNode3DList found;
+        kdTree.search(
+            build_3d_kd_search_region(fitPos1.GetGlobalMinLayerPosition(), searchDistance, searchDistance, searchDistance), found);
+        kdTree.search(
+            build_3d_kd_search_region(fitPos1.GetGlobalMaxLayerPosition(), searchDistance, searchDistance, searchDistance), found);
 
-            const ThreeDSlidingFitResult &fitPos2(iter2->second.first), &fitDir2(iter2->second.second);
+        // ATTN Consider candidates in input order, to preserve the ordering of the association lists
+        std::vector<unsigned int> candidateIndices;
+
+        for (const PfoKDNode3D &kDNode : found)
+        {
+            if (pPfo1 != kDNode.data)
+                candidateIndices.push_back(pfoToIndexMap.at(kDNode.data));
+        }
+
+        std::sort(candidateIndices.begin(), candidateIndices.end());
+        candidateIndices.erase(std::unique(candidateIndices.begin(), candidateIndices.end()), candidateIndices.end());
+
+        for (const unsigned int candidateIndex : candidateIndices)
+        {
+            const ParticleFlowObject *const pPfo2(fittedPfos.at(candidateIndex));
+            const ThreeDSlidingFitResult &fitPos2(pfoToSlidingFitsMap.at(pPfo2).first), &fitDir2(pfoToSlidingFitsMap.at(pPfo2).second);
 
             // TODO Use existing LArPointingClusters and IsEmission/IsNode logic, for consistency
             if (!(this->CheckAssociation(fitPos1.GetGlobalMinLayerPosition(), fitDir1.GetGlobalMinLayerDirection() * -1.f,
@@ -217,6 +267,21 @@ void CosmicRayTaggingTool::GetPfoAssociations(const PfoList &parentCosmicRayPfos
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+float CosmicRayTaggingTool::GetMaxEndpointSeparation() const
+{
+    // ATTN CheckAssociation requires each endpoint to lie within maxLambda of the point of closest approach, and the two closest-approach
+    // points to lie within maxImpactDist of one another, which bounds the separation of any associated pair of endpoints
+    const float sinDeltaTheta(std::fabs(std::sin(m_angularUncertainty * M_PI / 180.f)));
+    const float maxVertexUncertainty(m_maxAssociationDist * sinDeltaTheta + m_positionalUncertainty);
+    const float maxLambda(m_maxAssociationDist + maxVertexUncertainty);
+    const float maxImpactDist(sinDeltaTheta * 2.f * maxLambda + m_positionalUncertainty);
+
+    // Small safety margin, to absorb rounding in the single precision closest-approach calculation
+    return 1.01f * (2.f * maxLambda + maxImpactDist) + 1.f;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 bool CosmicRayTaggingTool::CheckAssociation(
     const CartesianVector &endPoint1, const CartesianVector &endDir1, const CartesianVector &endPoint2, const CartesianVector &endDir2) const
 {
@@ -269,24 +334,14 @@ bool CosmicRayTaggingTool::CheckAssociation(
 void CosmicRayTaggingTool::SliceEvent(const PfoList &parentCosmicRayPfos, const PfoToPfoListMap &pfoAssociationMap, PfoToSliceIdMap &pfoToSliceIdMap) const
 {
     SliceList sliceList;
+    PfoSet assignedPfos;
 
     for (const ParticleFlowObject *const pPfo : parentCosmicRayPfos)
     {
-        bool isAlreadyInSlice(false);
-
-        for (const PfoList &slice : sliceList)
-        {
-            if (std::find(slice.begin(), slice.end(), pPfo) != slice.end())
-            {
-                isAlreadyInSlice = true;
-                break;
-            }
-        }
-
-        if (!isAlreadyInSlice)
+        if (!assignedPfos.count(pPfo))
         {
             sliceList.push_back(PfoList());
-            this->FillSlice(pPfo, pfoAssociationMap, sliceList.back());
+            this->FillSlice(pPfo, pfoAssociationMap, sliceList.back(), assignedPfos);
         }
     }
 
@@ -305,9 +360,10 @@ void CosmicRayTaggingTool::SliceEvent(const PfoList &parentCosmicRayPfos, const
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void CosmicRayTaggingTool::FillSlice(const ParticleFlowObject *const pPfo, const PfoToPfoListMap &pfoAssociationMap, PfoList &slice) const
+void CosmicRayTaggingTool::FillSlice(
+    const ParticleFlowObject *const pPfo, const PfoToPfoListMap &pfoAssociationMap, PfoList &slice, PfoSet &assignedPfos) const
 {
-    if (std::find(slice.begin(), slice.end(), pPfo) != slice.end())
+    if (!assignedPfos.insert(pPfo).second)
         return;
 
     slice.push_back(pPfo);
@@ -317,7 +373,7 @@ void CosmicRayTaggingTool::FillSlice(const ParticleFlowObject *const pPfo, const
     if (pfoAssociationMap.end() != iter)
     {
         for (const ParticleFlowObject *const pAssociatedPfo : iter->second)
-            this->FillSlice(pAssociatedPfo, pfoAssociationMap, slice);
+            this->FillSlice(pAssociatedPfo, pfoAssociationMap, slice, assignedPfos);
     }
 }
 
@@ -18,6 +18,13 @@
 namespace lar_content
 {
 
+template <typename, unsigned int>
+class KDTreeLinkerAlgo;
+template <typename, unsigned int>
+class KDTreeNodeInfoT;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 /**
  *  @brief  CosmicRayTaggingTool class
  */
@@ -79,6 +86,11 @@ private:
     bool GetValid3DCluster(const pandora::ParticleFlowObject *const pPfo, const pandora::Cluster *&pCluster3D) const;
 
     typedef std::unordered_map<const pandora::ParticleFlowObject *, pandora::PfoList> PfoToPfoListMap;
+    typedef std::unordered_map<const pandora::ParticleFlowObject *, unsigned int> PfoToIndexMap;
+
+    typedef KDTreeLinkerAlgo<const pandora::ParticleFlowObject *, 3> PfoKDTree3D;
+    typedef KDTreeNodeInfoT<const pandora::ParticleFlowObject *, 3> PfoKDNode3D;
+    typedef std::vector<PfoKDNode3D> PfoKDNode3DList;
 
     /**
      *  @brief  Get mapping between Pfos that are associated with it other by pointing
@@ -88,6 +100,13 @@ private:
      */
     void GetPfoAssociations(const pandora::PfoList &parentCosmicRayPfos, PfoToPfoListMap &pfoAssociationMap) const;
 
+    /**
+     *  @brief  Get the maximum separation between a pair of Pfo endpoints that could pass the CheckAssociation requirements
+     *
+     *  @return the maximum endpoint separation
+     */
+    float GetMaxEndpointSeparation() const;
+
     /**
      *  @brief  Check whethe two Pfo endpoints are associated by distance of closest approach
      *
@@ -118,8 +137,10 @@ private:
      *  @param  pPfo Pfo to add to the slice
      *  @param  pfoAssociationMap mapping between Pfos and other associated Pfos
      *  @param  slice the slice to add Pfos to
+     *  @param  assignedPfos the set of Pfos already assigned to a slice, to be updated
      */
-    void FillSlice(const pandora::ParticleFlowObject *const pPfo, const PfoToPfoListMap &pfoAssociationMap, pandora::PfoList &slice) const;
+    void FillSlice(const pandora::ParticleFlowObject *const pPfo, const PfoToPfoListMap &pfoAssociationMap, pandora::PfoList &slice,
+        pandora::PfoSet &assignedPfos) const;
 
     /**
      *  @brief  Make a list of CRCandidates
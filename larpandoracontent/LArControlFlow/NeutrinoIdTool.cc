@@ -590,6 +590,15 @@ void NeutrinoIdTool<T>::SliceFeatures::GetPointsInSphere(const CartesianPointVec
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+StatusCode NeutrinoIdTool<T>::Reset()
+{
+    LArMvaHelper::FlushTrainingExamples();
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 StatusCode NeutrinoIdTool<T>::ReadSettings(const TiXmlHandle xmlHandle)
 {
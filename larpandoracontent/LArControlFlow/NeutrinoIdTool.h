@@ -254,6 +254,7 @@ private:
      */
     void SelectPfos(const pandora::PfoList &pfos, pandora::PfoList &selectedPfos) const;
 
+    pandora::StatusCode Reset();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
     // Training
@@ -11,6 +11,9 @@
 #include "larpandoracontent/LArControlFlow/PreProcessingAlgorithm.h"
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
+#include "larpandoracontent/LArHelpers/LArHitWidthHelper.h"
+#include "larpandoracontent/LArHelpers/LArPointingClusterHelper.h"
+#include "larpandoracontent/LArHelpers/LArScratchHelper.h"
 
 #include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
 
@@ -35,6 +38,10 @@ PreProcessingAlgorithm::PreProcessingAlgorithm() :
 StatusCode PreProcessingAlgorithm::Reset()
 {
     m_processedHits.clear();
+    LArClusterHelper::ResetClusterSummaryCache();
+    LArHitWidthHelper::ResetConstituentHitCache();
+    LArPointingClusterHelper::ResetPointingClusterCache();
+    LArScratchHelper::ResetScratchArena();
     return STATUS_CODE_SUCCESS;
 }
 
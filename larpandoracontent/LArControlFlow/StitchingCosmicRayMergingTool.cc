@@ -115,8 +115,9 @@ void StitchingCosmicRayMergingTool::BuildPointingClusterMaps(
             if (1 != clusterList.size())
                 throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
 
-            const ThreeDSlidingFitResult slidingFitResult(clusterList.front(), m_halfWindowLayers, slidingFitPitch);
-            (void)pointingClusterMap.insert(ThreeDPointingClusterMap::value_type(pPfo, LArPointingCluster(slidingFitResult)));
+            const LArPointingCluster &pointingCluster(
+                LArPointingClusterHelper::GetPointingCluster(clusterList.front(), m_halfWindowLayers, slidingFitPitch));
+            (void)pointingClusterMap.insert(ThreeDPointingClusterMap::value_type(pPfo, pointingCluster));
         }
         catch (const StatusCodeException &)
         {
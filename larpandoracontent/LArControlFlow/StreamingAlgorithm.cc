@@ -12,6 +12,7 @@
 
 #include "larpandoracontent/LArHelpers/LArMCParticleHelper.h"
 #include "larpandoracontent/LArHelpers/LArMonitoringHelper.h"
+#include "larpandoracontent/LArHelpers/LArProfilingHelper.h"
 
 #include "larpandoracontent/LArObjects/LArCaloHit.h"
 
@@ -53,7 +54,7 @@ StatusCode StreamingAlgorithm::Run()
                 PandoraContentApi::GetCurrentList(*this, pClusterList);
                 if (!pClusterList->empty())
                 {
-                    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::RunDaughterAlgorithm(*this, alg));
+                    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArProfilingHelper::RunDaughterAlgorithm(*this, alg));
                 }
             }
             // Save the current list to the target output list
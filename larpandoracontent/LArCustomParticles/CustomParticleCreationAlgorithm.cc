@@ -8,6 +8,7 @@
 
 #include "Pandora/AlgorithmHeaders.h"
 
+#include "larpandoracontent/LArHelpers/LArParallelHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
 
 #include "larpandoracontent/LArCustomParticles/CustomParticleCreationAlgorithm.h"
@@ -17,6 +18,13 @@ using namespace pandora;
 namespace lar_content
 {
 
+CustomParticleCreationAlgorithm::CustomParticleCreationAlgorithm() :
+    m_maxFitThreads(1)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode CustomParticleCreationAlgorithm::Run()
 {
     // Get input Pfo List
@@ -50,26 +58,39 @@ StatusCode CustomParticleCreationAlgorithm::Run()
     std::string tempVertexListName;
     PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::CreateTemporaryListAndSetCurrent(*this, pTempVertexList, tempVertexListName));
 
-    // Loop over input Pfos
-    PfoList pfoList(pPfoList->begin(), pPfoList->end());
+    // Select input Pfos
+    PfoVector inputPfoVector;
     VertexList vertexList(pVertexList->begin(), pVertexList->end());
 
-    for (PfoList::const_iterator iter = pfoList.begin(), iterEnd = pfoList.end(); iter != iterEnd; ++iter)
+    for (const ParticleFlowObject *const pInputPfo : *pPfoList)
     {
-        const ParticleFlowObject *const pInputPfo = *iter;
-
         if (pInputPfo->GetVertexList().empty())
             continue;
 
-        const Vertex *const pInputVertex = LArPfoHelper::GetVertex(pInputPfo);
-
-        if (vertexList.end() == std::find(vertexList.begin(), vertexList.end(), pInputVertex))
+        if (vertexList.end() == std::find(vertexList.begin(), vertexList.end(), LArPfoHelper::GetVertex(pInputPfo)))
             throw StatusCodeException(STATUS_CODE_FAILURE);
 
+        inputPfoVector.push_back(pInputPfo);
+    }
+
+    // ATTN Input Pfos are fitted concurrently, without modifying the event, then replaced serially and in input order
+    ParticleFitResultVector particleFitResultVector(inputPfoVector.size());
+
+    LArParallelHelper::ForEachIndex(inputPfoVector.size(), m_maxFitThreads,
+        [&](const size_t index) { particleFitResultVector.at(index) = this->FitPfo(inputPfoVector.at(index)); });
+
+    for (size_t index = 0; index < inputPfoVector.size(); ++index)
+    {
+        if (!particleFitResultVector.at(index))
+            continue;
+
+        const ParticleFlowObject *const pInputPfo(inputPfoVector.at(index));
+        const Vertex *const pInputVertex(LArPfoHelper::GetVertex(pInputPfo));
+
         // Build a new pfo and vertex from the old pfo
         const ParticleFlowObject *pOutputPfo(NULL);
 
-        this->CreatePfo(pInputPfo, pOutputPfo);
+        this->CreatePfo(pInputPfo, *particleFitResultVector.at(index), pOutputPfo);
 
         if (NULL == pOutputPfo)
             continue;
@@ -123,6 +144,9 @@ StatusCode CustomParticleCreationAlgorithm::ReadSettings(const TiXmlHandle xmlHa
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "PfoListName", m_pfoListName));
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "VertexListName", m_vertexListName));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "MaxFitThreads", m_maxFitThreads));
+
     return STATUS_CODE_SUCCESS;
 }
 
@@ -10,6 +10,9 @@
 
 #include "Pandora/Algorithm.h"
 
+#include <memory>
+#include <vector>
+
 namespace lar_content
 {
 
@@ -18,21 +21,55 @@ namespace lar_content
  */
 class CustomParticleCreationAlgorithm : public pandora::Algorithm
 {
+public:
+    /**
+     *  @brief  Default constructor
+     */
+    CustomParticleCreationAlgorithm();
+
 protected:
+    /**
+     *  @brief  ParticleFitResult class, the base for the results of the (read-only) fits from which specialised pfos are created
+     */
+    class ParticleFitResult
+    {
+    public:
+        /**
+         *  @brief  Destructor
+         */
+        virtual ~ParticleFitResult() = default;
+    };
+
+    typedef std::unique_ptr<const ParticleFitResult> ParticleFitResultPtr;
+    typedef std::vector<ParticleFitResultPtr> ParticleFitResultVector;
+
     virtual pandora::StatusCode Run();
     virtual pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
+    /**
+     *  @brief  Fit a generic input Pfo, to provide the information required to create a specialised Pfo. Fits for different input Pfos
+     *          may run concurrently, so implementations must only read the input Pfo, its vertex and the algorithm configuration
+     *
+     *  @param  pInputPfo the address of the input Pfo
+     *
+     *  @return the fit result, or nullptr if no specialised Pfo is to be created
+     */
+    virtual ParticleFitResultPtr FitPfo(const pandora::ParticleFlowObject *const pInputPfo) const = 0;
+
     /**
      *  @brief  Create specialised Pfo from an generic input Pfo
      *
      *  @param  pInputPfo the address of the input Pfo
+     *  @param  particleFitResult the fit result for the input Pfo
      *  @param  pOutputPfo the address of the output Pfo
      */
-    virtual void CreatePfo(const pandora::ParticleFlowObject *const pInputPfo, const pandora::ParticleFlowObject *&pOutputPfo) const = 0;
+    virtual void CreatePfo(const pandora::ParticleFlowObject *const pInputPfo, const ParticleFitResult &particleFitResult,
+        const pandora::ParticleFlowObject *&pOutputPfo) const = 0;
 
 private:
     std::string m_pfoListName;    ///< The name of the input pfo list
     std::string m_vertexListName; ///< The name of the input vertex list
+    unsigned int m_maxFitThreads; ///< The maximum number of threads with which to fit the input pfos
 };
 
 } // namespace lar_content
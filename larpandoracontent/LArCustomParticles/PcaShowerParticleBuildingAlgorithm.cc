@@ -30,7 +30,8 @@ PcaShowerParticleBuildingAlgorithm::PcaShowerParticleBuildingAlgorithm() :
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void PcaShowerParticleBuildingAlgorithm::CreatePfo(const ParticleFlowObject *const pInputPfo, const ParticleFlowObject *&pOutputPfo) const
+CustomParticleCreationAlgorithm::ParticleFitResultPtr PcaShowerParticleBuildingAlgorithm::FitPfo(
+    const ParticleFlowObject *const pInputPfo) const
 {
     try
     {
@@ -38,22 +39,46 @@ void PcaShowerParticleBuildingAlgorithm::CreatePfo(const ParticleFlowObject *con
         if (LArPfoHelper::IsNeutrinoFinalState(pInputPfo))
         {
             if (!LArPfoHelper::IsShower(pInputPfo))
-                return;
+                return nullptr;
         }
         else
         {
             if (LArPfoHelper::IsFinalState(pInputPfo))
-                return;
+                return nullptr;
 
             if (LArPfoHelper::IsNeutrino(pInputPfo))
-                return;
+                return nullptr;
         }
 
         // Need an input vertex to provide a shower propagation direction
         const Vertex *const pInputVertex = LArPfoHelper::GetVertex(pInputPfo);
 
         // Run the PCA analysis
-        const LArShowerPCA showerPCA(LArPfoHelper::GetPrincipalComponents(pInputPfo, pInputVertex));
+        return ParticleFitResultPtr(new ShowerFitResult(LArPfoHelper::GetPrincipalComponents(pInputPfo, pInputVertex)));
+    }
+    catch (StatusCodeException &statusCodeException)
+    {
+        if (STATUS_CODE_FAILURE == statusCodeException.GetStatusCode())
+            throw statusCodeException;
+    }
+
+    return nullptr;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void PcaShowerParticleBuildingAlgorithm::CreatePfo(
+    const ParticleFlowObject *const pInputPfo, const ParticleFitResult &particleFitResult, const ParticleFlowObject *&pOutputPfo) const
+{
+    try
+    {
+        const ShowerFitResult *const pShowerFitResult(dynamic_cast<const ShowerFitResult *>(&particleFitResult));
+
+        if (!pShowerFitResult)
+            throw StatusCodeException(STATUS_CODE_FAILURE);
+
+        const Vertex *const pInputVertex = LArPfoHelper::GetVertex(pInputPfo);
+        const LArShowerPCA &showerPCA(pShowerFitResult->m_showerPCA);
 
         // Build a new pfo
         LArShowerPfoFactory pfoFactory;
@@ -109,4 +134,12 @@ StatusCode PcaShowerParticleBuildingAlgorithm::ReadSettings(const TiXmlHandle xm
     return CustomParticleCreationAlgorithm::ReadSettings(xmlHandle);
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+PcaShowerParticleBuildingAlgorithm::ShowerFitResult::ShowerFitResult(const LArShowerPCA &showerPCA) :
+    m_showerPCA(showerPCA)
+{
+}
+
 } // namespace lar_content
@@ -8,6 +8,7 @@
 #ifndef LAR_PCA_SHOWER_PARTICLE_BUILDING_ALGORITHM_H
 #define LAR_PCA_SHOWER_PARTICLE_BUILDING_ALGORITHM_H 1
 
+#include "larpandoracontent/LArObjects/LArPfoObjects.h"
 #include "larpandoracontent/LArObjects/LArShowerPfo.h"
 
 #include "larpandoracontent/LArCustomParticles/CustomParticleCreationAlgorithm.h"
@@ -36,7 +37,25 @@ public:
     };
 
 private:
-    void CreatePfo(const pandora::ParticleFlowObject *const pInputPfo, const pandora::ParticleFlowObject *&pOutputPfo) const;
+    /**
+     *  @brief  ShowerFitResult class
+     */
+    class ShowerFitResult : public ParticleFitResult
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  showerPCA the shower principal component analysis
+         */
+        ShowerFitResult(const LArShowerPCA &showerPCA);
+
+        LArShowerPCA m_showerPCA; ///< The shower principal component analysis
+    };
+
+    ParticleFitResultPtr FitPfo(const pandora::ParticleFlowObject *const pInputPfo) const;
+    void CreatePfo(const pandora::ParticleFlowObject *const pInputPfo, const ParticleFitResult &particleFitResult,
+        const pandora::ParticleFlowObject *&pOutputPfo) const;
 
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
@@ -29,7 +29,8 @@ TrackParticleBuildingAlgorithm::TrackParticleBuildingAlgorithm() :
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void TrackParticleBuildingAlgorithm::CreatePfo(const ParticleFlowObject *const pInputPfo, const ParticleFlowObject *&pOutputPfo) const
+CustomParticleCreationAlgorithm::ParticleFitResultPtr TrackParticleBuildingAlgorithm::FitPfo(
+    const ParticleFlowObject *const pInputPfo) const
 {
     try
     {
@@ -40,15 +41,15 @@ void TrackParticleBuildingAlgorithm::CreatePfo(const ParticleFlowObject *const p
         if (LArPfoHelper::IsNeutrinoFinalState(pInputPfo))
         {
             if (!LArPfoHelper::IsTrack(pInputPfo))
-                return;
+                return nullptr;
         }
         else
         {
             if (!LArPfoHelper::IsFinalState(pInputPfo))
-                return;
+                return nullptr;
 
             if (LArPfoHelper::IsNeutrino(pInputPfo))
-                return;
+                return nullptr;
         }
 
         // ATTN If wire w pitches vary between TPCs, exception will be raised in initialisation of lar pseudolayer plugin
@@ -56,11 +57,37 @@ void TrackParticleBuildingAlgorithm::CreatePfo(const ParticleFlowObject *const p
         const float layerPitch(pFirstLArTPC->GetWirePitchW());
 
         // Calculate sliding fit trajectory
-        LArTrackStateVector trackStateVector;
-        LArPfoHelper::GetSlidingFitTrajectory(pInputPfo, pInputVertex, m_slidingFitHalfWindow, layerPitch, trackStateVector);
+        std::unique_ptr<TrackFitResult> pTrackFitResult(new TrackFitResult);
+        LArPfoHelper::GetSlidingFitTrajectory(
+            pInputPfo, pInputVertex, m_slidingFitHalfWindow, layerPitch, pTrackFitResult->m_trackStateVector);
 
-        if (trackStateVector.empty())
-            return;
+        if (pTrackFitResult->m_trackStateVector.empty())
+            return nullptr;
+
+        return ParticleFitResultPtr(std::move(pTrackFitResult));
+    }
+    catch (StatusCodeException &statusCodeException)
+    {
+        if (STATUS_CODE_FAILURE == statusCodeException.GetStatusCode())
+            throw statusCodeException;
+    }
+
+    return nullptr;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void TrackParticleBuildingAlgorithm::CreatePfo(
+    const ParticleFlowObject *const pInputPfo, const ParticleFitResult &particleFitResult, const ParticleFlowObject *&pOutputPfo) const
+{
+    try
+    {
+        const TrackFitResult *const pTrackFitResult(dynamic_cast<const TrackFitResult *>(&particleFitResult));
+
+        if (!pTrackFitResult)
+            throw StatusCodeException(STATUS_CODE_FAILURE);
+
+        const Vertex *const pInputVertex = LArPfoHelper::GetVertex(pInputPfo);
 
         // Build track-like pfo from track trajectory (TODO Correct these placeholder parameters)
         LArTrackPfoFactory trackFactory;
@@ -71,7 +98,7 @@ void TrackParticleBuildingAlgorithm::CreatePfo(const ParticleFlowObject *const p
         pfoParameters.m_energy = 0.f;
         pfoParameters.m_momentum = pInputPfo->GetMomentum();
         pfoParameters.m_propertiesToAdd = pInputPfo->GetPropertiesMap();
-        pfoParameters.m_trackStateVector = trackStateVector;
+        pfoParameters.m_trackStateVector = pTrackFitResult->m_trackStateVector;
 
         PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::ParticleFlowObject::Create(*this, pfoParameters, pOutputPfo, trackFactory));
 
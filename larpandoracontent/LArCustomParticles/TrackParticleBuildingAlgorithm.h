@@ -27,9 +27,20 @@ public:
     TrackParticleBuildingAlgorithm();
 
 private:
+    /**
+     *  @brief  TrackFitResult class
+     */
+    class TrackFitResult : public ParticleFitResult
+    {
+    public:
+        LArTrackStateVector m_trackStateVector; ///< The sliding fit trajectory
+    };
+
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
-    void CreatePfo(const pandora::ParticleFlowObject *const pInputPfo, const pandora::ParticleFlowObject *&pOutputPfo) const;
+    ParticleFitResultPtr FitPfo(const pandora::ParticleFlowObject *const pInputPfo) const;
+    void CreatePfo(const pandora::ParticleFlowObject *const pInputPfo, const ParticleFitResult &particleFitResult,
+        const pandora::ParticleFlowObject *&pOutputPfo) const;
 
     unsigned int m_slidingFitHalfWindow; ///<
 };
@@ -64,32 +64,11 @@ void LArClusterHelper::GetClustersByHitType(const ClusterList &inputClusters, co
 
 float LArClusterHelper::GetLengthSquared(const Cluster *const pCluster)
 {
-    const OrderedCaloHitList &orderedCaloHitList(pCluster->GetOrderedCaloHitList());
-
-    if (orderedCaloHitList.empty())
+    if (pCluster->GetOrderedCaloHitList().empty())
         throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
 
     // ATTN In 2D case, we will actually calculate the quadrature sum of deltaX and deltaU/V/W
-    float minX(std::numeric_limits<float>::max()), maxX(-std::numeric_limits<float>::max());
-    float minY(std::numeric_limits<float>::max()), maxY(-std::numeric_limits<float>::max());
-    float minZ(std::numeric_limits<float>::max()), maxZ(-std::numeric_limits<float>::max());
-
-    for (OrderedCaloHitList::const_iterator iter = orderedCaloHitList.begin(), iterEnd = orderedCaloHitList.end(); iter != iterEnd; ++iter)
-    {
-        for (CaloHitList::const_iterator hitIter = iter->second->begin(), hitIterEnd = iter->second->end(); hitIter != hitIterEnd; ++hitIter)
-        {
-            const CartesianVector &hitPosition((*hitIter)->GetPositionVector());
-            minX = std::min(hitPosition.GetX(), minX);
-            maxX = std::max(hitPosition.GetX(), maxX);
-            minY = std::min(hitPosition.GetY(), minY);
-            maxY = std::max(hitPosition.GetY(), maxY);
-            minZ = std::min(hitPosition.GetZ(), minZ);
-            maxZ = std::max(hitPosition.GetZ(), maxZ);
-        }
-    }
-
-    const float deltaX(maxX - minX), deltaY(maxY - minY), deltaZ(maxZ - minZ);
-    return (deltaX * deltaX + deltaY * deltaY + deltaZ * deltaZ);
+    return LArClusterHelper::GetClusterSummary(pCluster).GetLengthSquared();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -197,6 +176,30 @@ float LArClusterHelper::GetClosestDistance(const Cluster *const pCluster1, const
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+float LArClusterHelper::GetClosestDistance(const ClusterSummary &summary1, const ClusterSummary &summary2)
+{
+    CartesianVector closestPosition1(0.f, 0.f, 0.f);
+    CartesianVector closestPosition2(0.f, 0.f, 0.f);
+
+    LArClusterHelper::GetClosestPositions(summary1, summary2, closestPosition1, closestPosition2);
+
+    return (closestPosition1 - closestPosition2).GetMagnitude();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool LArClusterHelper::IsCloserThan(const Cluster *const pCluster1, const Cluster *const pCluster2, const float distance)
+{
+    if ((0 == pCluster1->GetNCaloHits()) || (0 == pCluster2->GetNCaloHits()))
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+    const ClusterSummary &summary1(LArClusterHelper::GetClusterSummary(pCluster1));
+    const ClusterSummary &summary2(LArClusterHelper::GetClusterSummary(pCluster2));
+    return summary1.IsCloserThan(summary2, distance);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 float LArClusterHelper::GetClosestDistance(const CartesianVector &position, const ClusterList &clusterList)
 {
     return (position - LArClusterHelper::GetClosestPosition(position, clusterList)).GetMagnitude();
@@ -307,80 +310,32 @@ CartesianVector LArClusterHelper::GetClosestPosition(const CartesianVector &posi
 void LArClusterHelper::GetClosestPositions(
     const Cluster *const pCluster1, const Cluster *const pCluster2, CartesianVector &outputPosition1, CartesianVector &outputPosition2)
 {
-    bool distanceFound(false);
-    float minDistanceSquared(std::numeric_limits<float>::max());
-
-    CartesianVector closestPosition1(0.f, 0.f, 0.f);
-    CartesianVector closestPosition2(0.f, 0.f, 0.f);
-
-    const OrderedCaloHitList &orderedCaloHitList1(pCluster1->GetOrderedCaloHitList());
-    const OrderedCaloHitList &orderedCaloHitList2(pCluster2->GetOrderedCaloHitList());
+    const ClusterSummary &summary1(LArClusterHelper::GetClusterSummary(pCluster1));
+    const ClusterSummary &summary2(LArClusterHelper::GetClusterSummary(pCluster2));
+    LArClusterHelper::GetClosestPositions(summary1, summary2, outputPosition1, outputPosition2);
+}
 
-    // Loop over hits in cluster 1
-    for (OrderedCaloHitList::const_iterator iter1 = orderedCaloHitList1.begin(), iter1End = orderedCaloHitList1.end(); iter1 != iter1End; ++iter1)
-    {
-        for (CaloHitList::const_iterator hitIter1 = iter1->second->begin(), hitIter1End = iter1->second->end(); hitIter1 != hitIter1End; ++hitIter1)
-        {
-            const CartesianVector &positionVector1((*hitIter1)->GetPositionVector());
+//------------------------------------------------------------------------------------------------------------------------------------------
 
-            // Loop over hits in cluster 2
-            for (OrderedCaloHitList::const_iterator iter2 = orderedCaloHitList2.begin(), iter2End = orderedCaloHitList2.end(); iter2 != iter2End; ++iter2)
-            {
-                for (CaloHitList::const_iterator hitIter2 = iter2->second->begin(), hitIter2End = iter2->second->end(); hitIter2 != hitIter2End; ++hitIter2)
-                {
-                    const CartesianVector &positionVector2((*hitIter2)->GetPositionVector());
-
-                    const float distanceSquared((positionVector1 - positionVector2).GetMagnitudeSquared());
-
-                    if (distanceSquared < minDistanceSquared)
-                    {
-                        minDistanceSquared = distanceSquared;
-                        closestPosition1 = positionVector1;
-                        closestPosition2 = positionVector2;
-                        distanceFound = true;
-                    }
-                }
-            }
-        }
-    }
+void LArClusterHelper::GetClosestPositions(
+    const ClusterSummary &summary1, const ClusterSummary &summary2, CartesianVector &outputPosition1, CartesianVector &outputPosition2)
+{
+    unsigned int index1(0), index2(0);
 
-    if (!distanceFound)
+    if (!summary1.GetClosestPair(summary2, index1, index2))
         throw StatusCodeException(STATUS_CODE_NOT_FOUND);
 
-    outputPosition1 = closestPosition1;
-    outputPosition2 = closestPosition2;
+    outputPosition1 = summary1.GetPositions().at(index1);
+    outputPosition2 = summary2.GetPositions().at(index2);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void LArClusterHelper::GetClusterBoundingBox(const Cluster *const pCluster, CartesianVector &minimumCoordinate, CartesianVector &maximumCoordinate)
 {
-    const OrderedCaloHitList &orderedCaloHitList(pCluster->GetOrderedCaloHitList());
-
-    float xmin(std::numeric_limits<float>::max());
-    float ymin(std::numeric_limits<float>::max());
-    float zmin(std::numeric_limits<float>::max());
-    float xmax(-std::numeric_limits<float>::max());
-    float ymax(-std::numeric_limits<float>::max());
-    float zmax(-std::numeric_limits<float>::max());
-
-    for (OrderedCaloHitList::const_iterator ochIter = orderedCaloHitList.begin(), ochIterEnd = orderedCaloHitList.end(); ochIter != ochIterEnd; ++ochIter)
-    {
-        for (CaloHitList::const_iterator hIter = ochIter->second->begin(), hIterEnd = ochIter->second->end(); hIter != hIterEnd; ++hIter)
-        {
-            const CaloHit *const pCaloHit = *hIter;
-            const CartesianVector &hit(pCaloHit->GetPositionVector());
-            xmin = std::min(hit.GetX(), xmin);
-            xmax = std::max(hit.GetX(), xmax);
-            ymin = std::min(hit.GetY(), ymin);
-            ymax = std::max(hit.GetY(), ymax);
-            zmin = std::min(hit.GetZ(), zmin);
-            zmax = std::max(hit.GetZ(), zmax);
-        }
-    }
-
-    minimumCoordinate.SetValues(xmin, ymin, zmin);
-    maximumCoordinate.SetValues(xmax, ymax, zmax);
+    const ClusterSummary &clusterSummary(LArClusterHelper::GetClusterSummary(pCluster));
+    minimumCoordinate = clusterSummary.GetMinimumCoordinate();
+    maximumCoordinate = clusterSummary.GetMaximumCoordinate();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -438,7 +393,10 @@ void LArClusterHelper::GetExtremalCoordinates(const ClusterList &clusterList, Ca
 
 void LArClusterHelper::GetExtremalCoordinates(const Cluster *const pCluster, CartesianVector &innerCoordinate, CartesianVector &outerCoordinate)
 {
-    return LArClusterHelper::GetExtremalCoordinates(pCluster->GetOrderedCaloHitList(), innerCoordinate, outerCoordinate);
+    if (pCluster->GetOrderedCaloHitList().empty())
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+    LArClusterHelper::GetClusterSummary(pCluster).GetExtremalCoordinates(innerCoordinate, outerCoordinate);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -570,14 +528,23 @@ void LArClusterHelper::GetExtremalCoordinates(const CartesianPointVector &coordi
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void LArClusterHelper::GetCoordinateVector(const Cluster *const pCluster, CartesianPointVector &coordinateVector)
+void LArClusterHelper::GetCoordinateVector(const Cluster *const pCluster, CartesianPointVector &coordinateVector, const bool sortByPosition)
 {
-    for (const OrderedCaloHitList::value_type &layerEntry : pCluster->GetOrderedCaloHitList())
+    const ClusterSummary &clusterSummary(LArClusterHelper::GetClusterSummary(pCluster));
+
+    if (sortByPosition && coordinateVector.empty())
     {
-        for (const CaloHit *const pCaloHit : *layerEntry.second)
-            coordinateVector.push_back(pCaloHit->GetPositionVector());
+        coordinateVector = clusterSummary.GetSortedCoordinates();
+        return;
     }
 
+    const CartesianPointVector &positions(clusterSummary.GetPositions());
+    coordinateVector.insert(coordinateVector.end(), positions.begin(), positions.end());
+
+    if (!sortByPosition)
+        return;
+
+    // ATTN Any existing coordinates are sorted together with those of the cluster
     std::sort(coordinateVector.begin(), coordinateVector.end(), LArClusterHelper::SortCoordinatesByPosition);
 }
 
@@ -638,6 +605,334 @@ void LArClusterHelper::GetDaughterVolumeIDs(const Cluster *const pCluster, UIntS
         }
     }
 }
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArClusterHelper::ClusterVersion::ClusterVersion(const Cluster *const pCluster) :
+    m_nCaloHits(pCluster->GetNCaloHits()),
+    m_pFirstCaloHit(nullptr),
+    m_pLastCaloHit(nullptr),
+    m_electromagneticEnergy(pCluster->GetElectromagneticEnergy()),
+    m_hadronicEnergy(pCluster->GetHadronicEnergy())
+{
+    ClusterVersion::GetEndCaloHits(pCluster, m_pFirstCaloHit, m_pLastCaloHit);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool LArClusterHelper::ClusterVersion::IsUpToDate(const Cluster *const pCluster) const
+{
+    if ((pCluster->GetNCaloHits() != m_nCaloHits) || (pCluster->GetElectromagneticEnergy() != m_electromagneticEnergy) ||
+        (pCluster->GetHadronicEnergy() != m_hadronicEnergy))
+    {
+        return false;
+    }
+
+    const CaloHit *pFirstCaloHit(nullptr), *pLastCaloHit(nullptr);
+    ClusterVersion::GetEndCaloHits(pCluster, pFirstCaloHit, pLastCaloHit);
+
+    return ((pFirstCaloHit == m_pFirstCaloHit) && (pLastCaloHit == m_pLastCaloHit));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArClusterHelper::ClusterVersion::GetEndCaloHits(
+    const Cluster *const pCluster, const CaloHit *&pFirstCaloHit, const CaloHit *&pLastCaloHit)
+{
+    const OrderedCaloHitList &orderedCaloHitList(pCluster->GetOrderedCaloHitList());
+
+    if (orderedCaloHitList.empty())
+        return;
+
+    const CaloHitList &firstLayerList(*(orderedCaloHitList.begin()->second));
+    const CaloHitList &lastLayerList(*(orderedCaloHitList.rbegin()->second));
+
+    pFirstCaloHit = firstLayerList.empty() ? nullptr : firstLayerList.front();
+    pLastCaloHit = lastLayerList.empty() ? nullptr : lastLayerList.back();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArClusterHelper::ClusterSummary::ClusterSummary(const Cluster *const pCluster) :
+    m_minCoordinate(std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max()),
+    m_maxCoordinate(-std::numeric_limits<float>::max(), -std::numeric_limits<float>::max(), -std::numeric_limits<float>::max()),
+    m_sortAxis(0),
+    m_clusterVersion(pCluster),
+    m_extremalCoordinatesFound(false),
+    m_innerCoordinate(0.f, 0.f, 0.f),
+    m_outerCoordinate(0.f, 0.f, 0.f)
+{
+    m_positions.reserve(pCluster->GetNCaloHits());
+
+    float xmin(std::numeric_limits<float>::max()), ymin(std::numeric_limits<float>::max()), zmin(std::numeric_limits<float>::max());
+    float xmax(-std::numeric_limits<float>::max()), ymax(-std::numeric_limits<float>::max()), zmax(-std::numeric_limits<float>::max());
+
+    for (const OrderedCaloHitList::value_type &layerEntry : pCluster->GetOrderedCaloHitList())
+    {
+        for (const CaloHit *const pCaloHit : *layerEntry.second)
+        {
+            const CartesianVector &position(pCaloHit->GetPositionVector());
+            m_positions.push_back(position);
+
+            xmin = std::min(position.GetX(), xmin);
+            xmax = std::max(position.GetX(), xmax);
+            ymin = std::min(position.GetY(), ymin);
+            ymax = std::max(position.GetY(), ymax);
+            zmin = std::min(position.GetZ(), zmin);
+            zmax = std::max(position.GetZ(), zmax);
+        }
+    }
+
+    if (m_positions.empty())
+        return;
+
+    m_minCoordinate.SetValues(xmin, ymin, zmin);
+    m_maxCoordinate.SetValues(xmax, ymax, zmax);
+
+    // ATTN Sort along the axis of largest extent, so that the coordinate window around each position excludes as much as possible
+    if ((ymax - ymin > xmax - xmin) && (ymax - ymin >= zmax - zmin))
+        m_sortAxis = 1;
+    else if (zmax - zmin > xmax - xmin)
+        m_sortAxis = 2;
+
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const CartesianPointVector &LArClusterHelper::ClusterSummary::GetSortedCoordinates() const
+{
+    if (m_sortedCoordinates.size() != m_positions.size())
+    {
+        m_sortedCoordinates = m_positions;
+        std::sort(m_sortedCoordinates.begin(), m_sortedCoordinates.end(), LArClusterHelper::SortCoordinatesByPosition);
+    }
+
+    return m_sortedCoordinates;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArClusterHelper::ClusterSummary::GetExtremalCoordinates(CartesianVector &innerCoordinate, CartesianVector &outerCoordinate) const
+{
+    if (!m_extremalCoordinatesFound)
+    {
+        LArClusterHelper::GetExtremalCoordinates(this->GetSortedCoordinates(), m_innerCoordinate, m_outerCoordinate);
+        m_extremalCoordinatesFound = true;
+    }
+
+    innerCoordinate = m_innerCoordinate;
+    outerCoordinate = m_outerCoordinate;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool LArClusterHelper::ClusterSummary::IsUpToDate(const Cluster *const pCluster) const
+{
+    return m_clusterVersion.IsUpToDate(pCluster);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool LArClusterHelper::ClusterSummary::GetClosestPair(const ClusterSummary &other, unsigned int &index1, unsigned int &index2) const
+{
+    if (m_positions.empty() || other.m_positions.empty())
+        return false;
+
+    // ATTN Results must match an exhaustive search, which keeps the first pair found at the minimum distance. Pruning is therefore
+    // strict, so that equidistant pairs are still visited, and such ties are resolved in favour of the lowest index in the other summary
+    const SortedIndexVector &otherSortedIndices(other.GetSortedIndices());
+    float bestDistanceSquared(std::numeric_limits<float>::max());
+    bool found(false);
+
+    for (unsigned int i = 0; i < m_positions.size(); ++i)
+    {
+        const CartesianVector &position(m_positions.at(i));
+
+        if (other.GetBoundingBoxDistanceSquared(position) > bestDistanceSquared)
+            continue;
+
+        const float coordinate(other.GetSortCoordinate(position));
+        const SortedIndexVector::const_iterator startIter(
+            std::lower_bound(otherSortedIndices.begin(), otherSortedIndices.end(), SortedIndexVector::value_type(coordinate, 0)));
+
+        auto consider = [&](const SortedIndexVector::value_type &entry) -> bool {
+            const float deltaCoordinate(entry.first - coordinate);
+
+            if (deltaCoordinate * deltaCoordinate > bestDistanceSquared)
+                return false;
+
+            const float distanceSquared((position - other.m_positions.at(entry.second)).GetMagnitudeSquared());
+
+            const bool isTie(found && (distanceSquared == bestDistanceSquared) && (i == index1) && (entry.second < index2));
+
+            if ((distanceSquared < bestDistanceSquared) || isTie)
+            {
+                bestDistanceSquared = distanceSquared;
+                index1 = i;
+                index2 = entry.second;
+                found = true;
+            }
+
+            return true;
+        };
+
+        for (SortedIndexVector::const_iterator iter = startIter; iter != otherSortedIndices.end(); ++iter)
+        {
+            if (!consider(*iter))
+                break;
+        }
+
+        for (SortedIndexVector::const_iterator iter = startIter; iter != otherSortedIndices.begin();)
+        {
+            if (!consider(*(--iter)))
+                break;
+        }
+    }
+
+    return found;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool LArClusterHelper::ClusterSummary::IsCloserThan(const ClusterSummary &other, const float distance) const
+{
+    if (m_positions.empty() || other.m_positions.empty())
+        return false;
+
+    const CartesianVector gap1(other.m_minCoordinate - m_maxCoordinate), gap2(m_minCoordinate - other.m_maxCoordinate);
+
+    if ((gap1.GetX() >= distance) || (gap2.GetX() >= distance) || (gap1.GetY() >= distance) || (gap2.GetY() >= distance) ||
+        (gap1.GetZ() >= distance) || (gap2.GetZ() >= distance))
+    {
+        return false;
+    }
+
+    const SortedIndexVector &otherSortedIndices(other.GetSortedIndices());
+
+    for (const CartesianVector &position : m_positions)
+    {
+        if (std::sqrt(other.GetBoundingBoxDistanceSquared(position)) >= distance)
+            continue;
+
+        const float coordinate(other.GetSortCoordinate(position));
+        const SortedIndexVector::const_iterator startIter(
+            std::lower_bound(otherSortedIndices.begin(), otherSortedIndices.end(), SortedIndexVector::value_type(coordinate, 0)));
+
+        for (SortedIndexVector::const_iterator iter = startIter; iter != otherSortedIndices.end(); ++iter)
+        {
+            if (iter->first - coordinate >= distance)
+                break;
+
+            if ((position - other.m_positions.at(iter->second)).GetMagnitude() < distance)
+                return true;
+        }
+
+        for (SortedIndexVector::const_iterator iter = startIter; iter != otherSortedIndices.begin();)
+        {
+            --iter;
+
+            if (coordinate - iter->first >= distance)
+                break;
+
+            if ((position - other.m_positions.at(iter->second)).GetMagnitude() < distance)
+                return true;
+        }
+    }
+
+    return false;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float LArClusterHelper::ClusterSummary::GetBoundingBoxDistanceSquared(const CartesianVector &position) const
+{
+    const float deltaX(std::max(std::max(m_minCoordinate.GetX() - position.GetX(), position.GetX() - m_maxCoordinate.GetX()), 0.f));
+    const float deltaY(std::max(std::max(m_minCoordinate.GetY() - position.GetY(), position.GetY() - m_maxCoordinate.GetY()), 0.f));
+    const float deltaZ(std::max(std::max(m_minCoordinate.GetZ() - position.GetZ(), position.GetZ() - m_maxCoordinate.GetZ()), 0.f));
+
+    return (deltaX * deltaX + deltaY * deltaY + deltaZ * deltaZ);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const LArClusterHelper::ClusterSummary::SortedIndexVector &LArClusterHelper::ClusterSummary::GetSortedIndices() const
+{
+    if (m_sortedIndices.size() != m_positions.size())
+    {
+        m_sortedIndices.clear();
+        m_sortedIndices.reserve(m_positions.size());
+
+        for (unsigned int index = 0; index < m_positions.size(); ++index)
+            m_sortedIndices.emplace_back(this->GetSortCoordinate(m_positions.at(index)), index);
+
+        std::sort(m_sortedIndices.begin(), m_sortedIndices.end());
+    }
+
+    return m_sortedIndices;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float LArClusterHelper::ClusterSummary::GetSortCoordinate(const CartesianVector &position) const
+{
+    return ((0 == m_sortAxis) ? position.GetX() : (1 == m_sortAxis) ? position.GetY() : position.GetZ());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const LArClusterHelper::ClusterSummary &LArClusterHelper::GetClusterSummary(const Cluster *const pCluster)
+{
+    // ATTN Generations are large enough that callers holding a few summary references never see them discarded
+    const size_t maxGenerationSize(10000);
+
+    ClusterSummaryCache &clusterSummaryCache(LArClusterHelper::GetClusterSummaryCache());
+    ClusterSummaryMap &currentSummaries(clusterSummaryCache.m_currentSummaries);
+    ClusterSummaryMap::iterator iter(currentSummaries.find(pCluster));
+
+    if (currentSummaries.end() != iter)
+    {
+        // ATTN Staleness, including reuse of a deleted cluster address, is detected only as far as the ClusterVersion fingerprint allows
+        if (!iter->second.IsUpToDate(pCluster))
+            iter->second = ClusterSummary(pCluster);
+
+        return iter->second;
+    }
+
+    // Moving the full generation keeps its nodes, so references to its summaries remain valid until the following generation is full
+    if (currentSummaries.size() >= maxGenerationSize)
+    {
+        clusterSummaryCache.m_previousSummaries = std::move(currentSummaries);
+        currentSummaries.clear();
+    }
+
+    ClusterSummaryMap &previousSummaries(clusterSummaryCache.m_previousSummaries);
+    const ClusterSummaryMap::const_iterator previousIter(previousSummaries.find(pCluster));
+
+    if ((previousSummaries.end() != previousIter) && previousIter->second.IsUpToDate(pCluster))
+        return currentSummaries.emplace(pCluster, previousIter->second).first->second;
+
+    return currentSummaries.emplace(pCluster, ClusterSummary(pCluster)).first->second;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArClusterHelper::ResetClusterSummaryCache()
+{
+    ClusterSummaryCache &clusterSummaryCache(LArClusterHelper::GetClusterSummaryCache());
+    clusterSummaryCache.m_currentSummaries.clear();
+    clusterSummaryCache.m_previousSummaries.clear();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArClusterHelper::ClusterSummaryCache &LArClusterHelper::GetClusterSummaryCache()
+{
+    static thread_local ClusterSummaryCache clusterSummaryCache;
+    return clusterSummaryCache;
+}
+
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 bool LArClusterHelper::SortByNOccupiedLayers(const Cluster *const pLhs, const Cluster *const pRhs)
@@ -10,6 +10,8 @@
 
 #include "Objects/Cluster.h"
 
+#include <unordered_map>
+
 namespace lar_content
 {
 
@@ -21,6 +23,195 @@ class LArClusterHelper
 public:
     typedef std::set<unsigned int> UIntSet;
 
+    /**
+     *  @brief  ClusterVersion class, which identifies the hit content of a cluster without recording the hits themselves, so that objects
+     *          derived from a cluster can be cached and checked for staleness cheaply. The version is a fingerprint, not a guarantee: it
+     *          records the number of hits, the first and last hits in the ordered calo hit list and the cluster energies, so a change of
+     *          hit content (in place, or by reuse of the cluster address) that preserves all of these is not detected
+     */
+    class ClusterVersion
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  pCluster address of the cluster
+         */
+        ClusterVersion(const pandora::Cluster *const pCluster);
+
+        /**
+         *  @brief  Whether the version is up to date with the hit content of a cluster, checked without traversing the hits
+         *
+         *  @param  pCluster address of the cluster
+         *
+         *  @return boolean
+         */
+        bool IsUpToDate(const pandora::Cluster *const pCluster) const;
+
+    private:
+        /**
+         *  @brief  Get the first and last calo hits in the ordered calo hit list of a cluster, used to identify its hit content
+         *
+         *  @param  pCluster address of the cluster
+         *  @param  pFirstCaloHit to receive the address of the first calo hit, nullptr if the cluster is empty
+         *  @param  pLastCaloHit to receive the address of the last calo hit, nullptr if the cluster is empty
+         */
+        static void GetEndCaloHits(
+            const pandora::Cluster *const pCluster, const pandora::CaloHit *&pFirstCaloHit, const pandora::CaloHit *&pLastCaloHit);
+
+        unsigned int m_nCaloHits;                ///< The number of calo hits in the cluster
+        const pandora::CaloHit *m_pFirstCaloHit; ///< The first calo hit in the cluster
+        const pandora::CaloHit *m_pLastCaloHit;  ///< The last calo hit in the cluster
+        float m_electromagneticEnergy;           ///< The cluster electromagnetic energy
+        float m_hadronicEnergy;                  ///< The cluster hadronic energy
+    };
+
+    /**
+     *  @brief  ClusterSummary class, a compact spatial summary of the hit positions in a cluster, supporting accelerated proximity queries.
+     *          The summary records the version of the cluster hit content from which it was built, so that it can be cached and reused
+     */
+    class ClusterSummary
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  pCluster address of the cluster
+         */
+        ClusterSummary(const pandora::Cluster *const pCluster);
+
+        /**
+         *  @brief  Get the hit positions, in the order in which they appear in the cluster ordered calo hit list
+         *
+         *  @return the hit positions
+         */
+        const pandora::CartesianPointVector &GetPositions() const;
+
+        /**
+         *  @brief  Get the minimum coordinates of the bounding box
+         *
+         *  @return the minimum coordinates
+         */
+        const pandora::CartesianVector &GetMinimumCoordinate() const;
+
+        /**
+         *  @brief  Get the maximum coordinates of the bounding box
+         *
+         *  @return the maximum coordinates
+         */
+        const pandora::CartesianVector &GetMaximumCoordinate() const;
+
+        /**
+         *  @brief  Get the squared length of the bounding box diagonal, as for LArClusterHelper::GetLengthSquared
+         *
+         *  @return the length squared
+         */
+        float GetLengthSquared() const;
+
+        /**
+         *  @brief  Get the hit positions sorted by position, as for LArClusterHelper::GetCoordinateVector (calculated on first use)
+         *
+         *  @return the sorted hit positions
+         */
+        const pandora::CartesianPointVector &GetSortedCoordinates() const;
+
+        /**
+         *  @brief  Get the extremal coordinates, as for LArClusterHelper::GetExtremalCoordinates (calculated on first use)
+         *
+         *  @param  innerCoordinate to receive the inner extremal position
+         *  @param  outerCoordinate to receive the outer extremal position
+         */
+        void GetExtremalCoordinates(pandora::CartesianVector &innerCoordinate, pandora::CartesianVector &outerCoordinate) const;
+
+        /**
+         *  @brief  Whether the summary is up to date with the hit content of a cluster, checked without traversing the hits
+         *
+         *  @param  pCluster address of the cluster
+         *
+         *  @return boolean
+         */
+        bool IsUpToDate(const pandora::Cluster *const pCluster) const;
+
+        /**
+         *  @brief  Find the closest pair of hit positions in this and another summary. Ties are resolved exactly as for an exhaustive
+         *          search over the positions of this summary, then the other summary, in input order
+         *
+         *  @param  other the other summary
+         *  @param  index1 to receive the index of the closest position in this summary
+         *  @param  index2 to receive the index of the closest position in the other summary
+         *
+         *  @return whether a closest pair was found
+         */
+        bool GetClosestPair(const ClusterSummary &other, unsigned int &index1, unsigned int &index2) const;
+
+        /**
+         *  @brief  Whether the closest distance between hit positions in this and another summary is less than a specified distance
+         *
+         *  @param  other the other summary
+         *  @param  distance the distance
+         *
+         *  @return boolean
+         */
+        bool IsCloserThan(const ClusterSummary &other, const float distance) const;
+
+    private:
+        typedef std::vector<std::pair<float, unsigned int>> SortedIndexVector;
+
+        /**
+         *  @brief  Get the squared distance between a position and the bounding box
+         *
+         *  @param  position the position
+         *
+         *  @return the squared distance, zero for contained positions
+         */
+        float GetBoundingBoxDistanceSquared(const pandora::CartesianVector &position) const;
+
+        /**
+         *  @brief  Get the (sort coordinate, position index) pairs, in order of sort coordinate then index (calculated on first use)
+         *
+         *  @return the sorted indices
+         */
+        const SortedIndexVector &GetSortedIndices() const;
+
+        /**
+         *  @brief  Get the coordinate of a position along the sort axis
+         *
+         *  @param  position the position
+         *
+         *  @return the coordinate
+         */
+        float GetSortCoordinate(const pandora::CartesianVector &position) const;
+
+        pandora::CartesianPointVector m_positions; ///< The hit positions, in ordered calo hit list order
+        pandora::CartesianVector m_minCoordinate;  ///< The minimum coordinates of the bounding box
+        pandora::CartesianVector m_maxCoordinate;  ///< The maximum coordinates of the bounding box
+        unsigned int m_sortAxis;                   ///< The axis (0, 1, 2 for x, y, z) of largest extent, along which positions are sorted
+        mutable SortedIndexVector m_sortedIndices; ///< The (sort coordinate, position index) pairs, calculated on first use
+        ClusterVersion m_clusterVersion;           ///< The version of the cluster hit content, when summarised
+        mutable pandora::CartesianPointVector m_sortedCoordinates; ///< The hit positions sorted by position, calculated on first use
+        mutable bool m_extremalCoordinatesFound;                   ///< Whether the extremal coordinates have been calculated
+        mutable pandora::CartesianVector m_innerCoordinate;        ///< The inner extremal coordinate
+        mutable pandora::CartesianVector m_outerCoordinate;        ///< The outer extremal coordinate
+    };
+
+    /**
+     *  @brief  Get the cached summary of a cluster, rebuilding it if the cluster version has changed since it was summarised (see the
+     *          ClusterVersion limitations). The cache is owned by the calling thread and holds at most two generations of summaries, the
+     *          older discarded as a new generation fills, so its size is bounded even if it is never reset. The returned reference remains
+     *          valid until the cluster is modified, the cache is reset, or a further generation of summaries has been built
+     *
+     *  @param  pCluster address of the cluster
+     *
+     *  @return the cluster summary
+     */
+    static const ClusterSummary &GetClusterSummary(const pandora::Cluster *const pCluster);
+
+    /**
+     *  @brief  Reset the cluster summary cache of the calling thread, to be called at event boundaries (or any other point at which no
+     *          summary references are held) to release the summaries promptly
+     */
+    static void ResetClusterSummaryCache();
+
     /**
      *  @brief  Get the hit type associated with a two dimensional cluster
      *
@@ -135,6 +326,27 @@ public:
      */
     static float GetClosestDistance(const pandora::Cluster *const pCluster1, const pandora::Cluster *const pCluster2);
 
+    /**
+     *  @brief  Get closest distance between a pair of cluster summaries
+     *
+     *  @param  summary1 the summary of the first cluster
+     *  @param  summary2 the summary of the second cluster
+     *
+     *  @return the closest distance
+     */
+    static float GetClosestDistance(const ClusterSummary &summary1, const ClusterSummary &summary2);
+
+    /**
+     *  @brief  Whether the closest distance between a pair of clusters is less than a specified distance, using bounding box early-outs
+     *
+     *  @param  pCluster1 address of the first cluster
+     *  @param  pCluster2 address of the second cluster
+     *  @param  distance the distance
+     *
+     *  @return boolean
+     */
+    static bool IsCloserThan(const pandora::Cluster *const pCluster1, const pandora::Cluster *const pCluster2, const float distance);
+
     /**
      *  @brief  Get closest distance between a specified position and list of clusters
      *
@@ -216,6 +428,17 @@ public:
     static void GetClosestPositions(const pandora::Cluster *const pCluster1, const pandora::Cluster *const pCluster2,
         pandora::CartesianVector &position1, pandora::CartesianVector &position2);
 
+    /**
+     *  @brief  Get pair of closest positions for a pair of cluster summaries
+     *
+     *  @param  summary1 the summary of the first cluster
+     *  @param  summary2 the summary of the second cluster
+     *  @param  the closest position in the first cluster
+     *  @param  the closest position in the second cluster
+     */
+    static void GetClosestPositions(const ClusterSummary &summary1, const ClusterSummary &summary2, pandora::CartesianVector &position1,
+        pandora::CartesianVector &position2);
+
     /**
      *  @brief  Get positions of the two most distant calo hits in a list of cluster (ordered by Z)
      *
@@ -267,12 +490,16 @@ public:
         const pandora::Cluster *const pCluster, pandora::CartesianVector &minimumCoordinate, pandora::CartesianVector &maximumCoordinate);
 
     /**
-     *  @brief  Get vector of hit coordinates from an input cluster
+     *  @brief  Get vector of hit coordinates from an input cluster. If sorting by position, any existing coordinates are sorted together
+     *          with those of the cluster, using the cached sorted coordinates of the cluster where possible. Otherwise, the cluster
+     *          coordinates are appended, in ordered calo hit list order, and any existing coordinates are left untouched
      *
      *  @param  pCluster address of the cluster
      *  @param  coordinateVector
+     *  @param  sortByPosition whether to sort the coordinates by position
      */
-    static void GetCoordinateVector(const pandora::Cluster *const pCluster, pandora::CartesianPointVector &coordinateVector);
+    static void GetCoordinateVector(
+        const pandora::Cluster *const pCluster, pandora::CartesianPointVector &coordinateVector, const bool sortByPosition = true);
 
     /**
      *  @brief  Get list of Calo hits from an input cluster that are contained in a bounding box.  The hits are sorted by position
@@ -384,8 +611,57 @@ public:
      *  @param  rhs second point
      */
     static bool SortCoordinatesByPosition(const pandora::CartesianVector &lhs, const pandora::CartesianVector &rhs);
+
+private:
+    typedef std::unordered_map<const pandora::Cluster *, ClusterSummary> ClusterSummaryMap;
+
+    /**
+     *  @brief  ClusterSummaryCache class, holding the current generation of cluster summaries and the generation before it
+     */
+    class ClusterSummaryCache
+    {
+    public:
+        ClusterSummaryMap m_currentSummaries;  ///< The summaries of the current generation
+        ClusterSummaryMap m_previousSummaries; ///< The summaries of the previous generation
+    };
+
+    /**
+     *  @brief  Get the cluster summary cache of the calling thread
+     *
+     *  @return the cluster summary cache
+     */
+    static ClusterSummaryCache &GetClusterSummaryCache();
 };
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const pandora::CartesianPointVector &LArClusterHelper::ClusterSummary::GetPositions() const
+{
+    return m_positions;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const pandora::CartesianVector &LArClusterHelper::ClusterSummary::GetMinimumCoordinate() const
+{
+    return m_minCoordinate;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const pandora::CartesianVector &LArClusterHelper::ClusterSummary::GetMaximumCoordinate() const
+{
+    return m_maxCoordinate;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline float LArClusterHelper::ClusterSummary::GetLengthSquared() const
+{
+    const pandora::CartesianVector delta(m_maxCoordinate - m_minCoordinate);
+    return (delta.GetX() * delta.GetX() + delta.GetY() * delta.GetY() + delta.GetZ() * delta.GetZ());
+}
+
 } // namespace lar_content
 
 #endif // #ifndef LAR_CLUSTER_HELPER_H
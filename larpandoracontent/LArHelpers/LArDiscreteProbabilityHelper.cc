@@ -19,20 +19,23 @@ float LArDiscreteProbabilityHelper::CalculateCorrelationCoefficientPValueFromPer
     if (1 > nPermutations)
         throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
 
-    const float rNominal(LArDiscreteProbabilityHelper::CalculateCorrelationCoefficient(t1, t2));
+    PermutationTestBuffers &buffers(LArDiscreteProbabilityHelper::FillPermutationTestBuffers(t1, t2));
+    return LArDiscreteProbabilityHelper::RunPermutationTest(buffers, randomNumberGenerator, nPermutations, nullptr, 0.f);
+}
 
-    unsigned int nExtreme(0);
-    for (unsigned int iPermutation = 0; iPermutation < nPermutations; ++iPermutation)
-    {
-        const float rRandomised(LArDiscreteProbabilityHelper::CalculateCorrelationCoefficient(
-            LArDiscreteProbabilityHelper::MakeRandomisedSample(t1, randomNumberGenerator),
-            LArDiscreteProbabilityHelper::MakeRandomisedSample(t2, randomNumberGenerator)));
+//------------------------------------------------------------------------------------------------------------------------------------------
 
-        if ((rRandomised - rNominal) > std::numeric_limits<float>::epsilon())
-            nExtreme++;
-    }
+template <typename T>
+float LArDiscreteProbabilityHelper::CalculateCorrelationCoefficientPValueFromPermutationTest(const T &t1, const T &t2,
+    std::mt19937 &randomNumberGenerator, const unsigned int nPermutations, const std::function<bool(const float)> &fCriteria,
+    const float earlyStoppingSignificance)
+{
+    if (1 > nPermutations)
+        throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
 
-    return static_cast<float>(nExtreme) / static_cast<float>(nPermutations);
+    PermutationTestBuffers &buffers(LArDiscreteProbabilityHelper::FillPermutationTestBuffers(t1, t2));
+    return LArDiscreteProbabilityHelper::RunPermutationTest(
+        buffers, randomNumberGenerator, nPermutations, fCriteria, earlyStoppingSignificance);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -124,10 +127,167 @@ float LArDiscreteProbabilityHelper::CalculateMean(const T &t)
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+LArDiscreteProbabilityHelper::PermutationTestBuffers &LArDiscreteProbabilityHelper::FillPermutationTestBuffers(const T &t1, const T &t2)
+{
+    const unsigned int size1(LArDiscreteProbabilityHelper::GetSize(t1));
+    const unsigned int size2(LArDiscreteProbabilityHelper::GetSize(t2));
+    if (size1 != size2)
+        throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
+
+    if (2 > size1)
+        throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
+
+    PermutationTestBuffers &buffers(LArDiscreteProbabilityHelper::GetPermutationTestBuffers());
+    LArDiscreteProbabilityHelper::FillCentredValues(t1, buffers.m_centredValues1);
+    LArDiscreteProbabilityHelper::FillCentredValues(t2, buffers.m_centredValues2);
+
+    return buffers;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void LArDiscreteProbabilityHelper::FillCentredValues(const T &t, pandora::FloatVector &centredValues)
+{
+    const unsigned int size(LArDiscreteProbabilityHelper::GetSize(t));
+    const float mean(LArDiscreteProbabilityHelper::CalculateMean(t));
+
+    // ATTN Resizing retains the capacity of the buffer, so no allocation is needed once the largest dataset has been seen
+    centredValues.resize(size);
+
+    for (unsigned int iElement = 0; iElement < size; ++iElement)
+        centredValues[iElement] = LArDiscreteProbabilityHelper::GetElement(t, iElement) - mean;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float LArDiscreteProbabilityHelper::RunPermutationTest(PermutationTestBuffers &buffers, std::mt19937 &randomNumberGenerator,
+    const unsigned int nPermutations, const std::function<bool(const float)> &fCriteria, const float earlyStoppingSignificance)
+{
+    const pandora::FloatVector &centredValues1(buffers.m_centredValues1);
+    const pandora::FloatVector &centredValues2(buffers.m_centredValues2);
+    pandora::FloatVector &shuffledValues1(buffers.m_shuffledValues1);
+    pandora::FloatVector &shuffledValues2(buffers.m_shuffledValues2);
+    const unsigned int size(centredValues1.size());
+
+    const float variance1(LArDiscreteProbabilityHelper::GetDotProduct(centredValues1.data(), centredValues1.data(), size));
+    const float variance2(LArDiscreteProbabilityHelper::GetDotProduct(centredValues2.data(), centredValues2.data(), size));
+
+    if (variance1 < std::numeric_limits<float>::epsilon() || variance2 < std::numeric_limits<float>::epsilon())
+        throw pandora::StatusCodeException(pandora::STATUS_CODE_FAILURE);
+
+    const float sqrtVars(std::sqrt(variance1 * variance2));
+    if (sqrtVars < std::numeric_limits<float>::epsilon())
+        throw pandora::StatusCodeException(pandora::STATUS_CODE_FAILURE);
+
+    const float rNominal(LArDiscreteProbabilityHelper::GetDotProduct(centredValues1.data(), centredValues2.data(), size) / sqrtVars);
+
+    unsigned int nExtreme(0);
+    for (unsigned int iPermutation = 0; iPermutation < nPermutations; ++iPermutation)
+    {
+        // ATTN Fresh copies of both datasets are shuffled, as for the original samples, so the same random numbers yield the same pairings
+        shuffledValues1.assign(centredValues1.begin(), centredValues1.end());
+        std::shuffle(shuffledValues1.begin(), shuffledValues1.end(), randomNumberGenerator);
+        shuffledValues2.assign(centredValues2.begin(), centredValues2.end());
+        std::shuffle(shuffledValues2.begin(), shuffledValues2.end(), randomNumberGenerator);
+
+        const float rRandomised(
+            LArDiscreteProbabilityHelper::GetDotProduct(shuffledValues1.data(), shuffledValues2.data(), size) / sqrtVars);
+
+        if ((rRandomised - rNominal) > std::numeric_limits<float>::epsilon())
+            nExtreme++;
+
+        float settledPValue(0.f);
+
+        if (fCriteria && LArDiscreteProbabilityHelper::IsPermutationTestSettled(
+                             nExtreme, iPermutation + 1, nPermutations, fCriteria, earlyStoppingSignificance, settledPValue))
+        {
+            return settledPValue;
+        }
+    }
+
+    return static_cast<float>(nExtreme) / static_cast<float>(nPermutations);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool LArDiscreteProbabilityHelper::IsPermutationTestSettled(const unsigned int nExtreme, const unsigned int nRun,
+    const unsigned int nPermutations, const std::function<bool(const float)> &fCriteria, const float earlyStoppingSignificance,
+    float &pValue)
+{
+    // ATTN The full test p-value is one of the values between these bounds, calculated exactly as for the full test. The criteria hold
+    // below a boundary and not above it, so if they agree at both bounds, the lower bound gives the same outcome as the full test
+    const float minPValue(static_cast<float>(nExtreme) / static_cast<float>(nPermutations));
+    const float maxPValue(static_cast<float>(nExtreme + nPermutations - nRun) / static_cast<float>(nPermutations));
+
+    if (fCriteria(minPValue) == fCriteria(maxPValue))
+    {
+        pValue = minPValue;
+        return true;
+    }
+
+    const float n(static_cast<float>(nRun));
+    const float z2(earlyStoppingSignificance * earlyStoppingSignificance);
+    const float pValueEstimate(static_cast<float>(nExtreme) / n);
+    const float denominator(1.f + z2 / n);
+    const float centre((pValueEstimate + 0.5f * z2 / n) / denominator);
+    const float halfWidth(
+        earlyStoppingSignificance * std::sqrt(pValueEstimate * (1.f - pValueEstimate) / n + 0.25f * z2 / (n * n)) / denominator);
+
+    const float lowerBound(centre - halfWidth), upperBound(centre + halfWidth);
+
+    if (fCriteria(lowerBound) == fCriteria(upperBound))
+    {
+        // ATTN The Wilson score interval contains the estimate, which is clamped to guard against rounding, so gives the settled outcome
+        pValue = std::min(std::max(pValueEstimate, lowerBound), upperBound);
+        return true;
+    }
+
+    return false;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float LArDiscreteProbabilityHelper::GetDotProduct(const float *const pValues1, const float *const pValues2, const unsigned int size)
+{
+    float sum0(0.f), sum1(0.f), sum2(0.f), sum3(0.f);
+    unsigned int iElement(0);
+
+    for (; iElement + 4 <= size; iElement += 4)
+    {
+        sum0 += pValues1[iElement] * pValues2[iElement];
+        sum1 += pValues1[iElement + 1] * pValues2[iElement + 1];
+        sum2 += pValues1[iElement + 2] * pValues2[iElement + 2];
+        sum3 += pValues1[iElement + 3] * pValues2[iElement + 3];
+    }
+
+    for (; iElement < size; ++iElement)
+        sum0 += pValues1[iElement] * pValues2[iElement];
+
+    return (sum0 + sum1) + (sum2 + sum3);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArDiscreteProbabilityHelper::PermutationTestBuffers &LArDiscreteProbabilityHelper::GetPermutationTestBuffers()
+{
+    static thread_local PermutationTestBuffers buffers;
+    return buffers;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template float LArDiscreteProbabilityHelper::CalculateCorrelationCoefficientPValueFromPermutationTest(
     const DiscreteProbabilityVector &, const DiscreteProbabilityVector &, std::mt19937 &, const unsigned int);
 template float LArDiscreteProbabilityHelper::CalculateCorrelationCoefficientPValueFromPermutationTest(
     const pandora::FloatVector &, const pandora::FloatVector &, std::mt19937 &, const unsigned int);
+template float LArDiscreteProbabilityHelper::CalculateCorrelationCoefficientPValueFromPermutationTest(
+    const DiscreteProbabilityVector &, const DiscreteProbabilityVector &, std::mt19937 &, const unsigned int,
+    const std::function<bool(const float)> &, const float);
+template float LArDiscreteProbabilityHelper::CalculateCorrelationCoefficientPValueFromPermutationTest(
+    const pandora::FloatVector &, const pandora::FloatVector &, std::mt19937 &, const unsigned int,
+    const std::function<bool(const float)> &, const float);
 
 template float LArDiscreteProbabilityHelper::CalculateCorrelationCoefficientPValueFromStudentTDistribution(
     const DiscreteProbabilityVector &, const DiscreteProbabilityVector &, const unsigned int, const float);
@@ -11,6 +11,7 @@
 #include "larpandoracontent/LArObjects/LArDiscreteProbabilityVector.h"
 
 #include <algorithm>
+#include <functional>
 #include <random>
 
 namespace lar_content
@@ -36,6 +37,27 @@ public:
     static float CalculateCorrelationCoefficientPValueFromPermutationTest(
         const T &t1, const T &t2, std::mt19937 &randomNumberGenerator, const unsigned int nPermutations);
 
+    /**
+     *  @brief  Calculate P value for measured correlation coefficient between two datasets via a permutation test, stopping early once
+     *          it is settled, at a given significance, whether the p-value satisfies the caller's criteria. The criteria must hold for
+     *          all p-values below some boundary and for none above it. The returned p-value then satisfies the criteria if and only if
+     *          the outcome is settled that way, and is for use only with the criteria: if the remaining permutations could not change
+     *          the outcome, it is the proven lower bound on the p-value of the full test, otherwise the estimate from the permutations
+     *          run so far
+     *
+     *  @param  t1 the first input dataset
+     *  @param  t2 the second input dataset
+     *  @param  randomNumberGenerator the random number generator to shuffle the datasets
+     *  @param  nPermutations the maximum number of permutations to run
+     *  @param  fCriteria the criteria to apply to the p-value, exactly as applied by the caller to the returned p-value
+     *  @param  earlyStoppingSignificance the number of standard deviations separating a settled p-value estimate from the boundary
+     *
+     *  @return the p-value
+     */
+    template <typename T>
+    static float CalculateCorrelationCoefficientPValueFromPermutationTest(const T &t1, const T &t2, std::mt19937 &randomNumberGenerator,
+        const unsigned int nPermutations, const std::function<bool(const float)> &fCriteria, const float earlyStoppingSignificance);
+
     /**
      *  @brief  Calculate P value for measured correlation coefficient between two datasets via a integrating the student T dist.
      *
@@ -73,26 +95,86 @@ public:
 
 private:
     /**
-     *  @brief  Make a randomised copy of a dataset
+     *  @brief  PermutationTestBuffers class, the scratch space for permutation tests, reused between tests on the calling thread
+     */
+    class PermutationTestBuffers
+    {
+    public:
+        pandora::FloatVector m_centredValues1;  ///< The first dataset, less its mean
+        pandora::FloatVector m_centredValues2;  ///< The second dataset, less its mean
+        pandora::FloatVector m_shuffledValues1; ///< The copy of the first centred dataset shuffled by each permutation
+        pandora::FloatVector m_shuffledValues2; ///< The copy of the second centred dataset shuffled by each permutation
+    };
+
+    /**
+     *  @brief  Fill the permutation test buffers of the calling thread with the centred datasets
      *
-     *  @param  t the dataset to be shuffled
-     *  @param  randomNumberGenerator the random number generator
+     *  @param  t1 the first input dataset
+     *  @param  t2 the second input dataset
      *
-     *  @return the reshuffled dataset
+     *  @return the permutation test buffers
      */
     template <typename T>
-    static T MakeRandomisedSample(const T &t, std::mt19937 &randomNumberGenerator);
+    static PermutationTestBuffers &FillPermutationTestBuffers(const T &t1, const T &t2);
 
     /**
-     *  @brief  Make a randomised copy of dataset (dataset is an std::vector)
+     *  @brief  Fill a buffer with a dataset, less its mean
      *
-     *  @param  t the std::vector-based dataset to be shuffled
-     *  @param  randomNumberGenerator the random number generator
-     *
-     *  @return the reshuffled std::vector
+     *  @param  t the dataset
+     *  @param  centredValues to receive the centred values
      */
     template <typename T>
-    static std::vector<T> MakeRandomisedSample(const std::vector<T> &t, std::mt19937 &randomNumberGenerator);
+    static void FillCentredValues(const T &t, pandora::FloatVector &centredValues);
+
+    /**
+     *  @brief  Run a permutation test on the centred datasets in the permutation test buffers. As the means and variances of the
+     *          datasets are unchanged by the permutations, only the covariance is recalculated for each permutation
+     *
+     *  @param  buffers the permutation test buffers
+     *  @param  randomNumberGenerator the random number generator to shuffle the datasets
+     *  @param  nPermutations the maximum number of permutations to run
+     *  @param  fCriteria the criteria to apply to the p-value, stopping once settled, or an empty function to run all permutations
+     *  @param  earlyStoppingSignificance the number of standard deviations separating a settled p-value estimate from the boundary
+     *
+     *  @return the p-value
+     */
+    static float RunPermutationTest(PermutationTestBuffers &buffers, std::mt19937 &randomNumberGenerator, const unsigned int nPermutations,
+        const std::function<bool(const float)> &fCriteria, const float earlyStoppingSignificance);
+
+    /**
+     *  @brief  Whether the outcome of a permutation test, i.e. whether the p-value satisfies the criteria, is settled. This is the case
+     *          if the criteria give the same outcome at both bounds on the p-value of the full test, or at both ends of the Wilson score
+     *          interval of the p-value estimate
+     *
+     *  @param  nExtreme the number of permutations so far yielding a more extreme correlation coefficient
+     *  @param  nRun the number of permutations so far
+     *  @param  nPermutations the maximum number of permutations
+     *  @param  fCriteria the criteria to apply to the p-value
+     *  @param  earlyStoppingSignificance the number of standard deviations separating a settled p-value estimate from the boundary
+     *  @param  pValue to receive, if settled, a p-value giving the settled outcome
+     *
+     *  @return boolean
+     */
+    static bool IsPermutationTestSettled(const unsigned int nExtreme, const unsigned int nRun, const unsigned int nPermutations,
+        const std::function<bool(const float)> &fCriteria, const float earlyStoppingSignificance, float &pValue);
+
+    /**
+     *  @brief  Get the dot product of two arrays of values, accumulated in independent partial sums so that the reduction can be vectorised
+     *
+     *  @param  pValues1 address of the first array
+     *  @param  pValues2 address of the second array
+     *  @param  size the number of values in each array
+     *
+     *  @return the dot product
+     */
+    static float GetDotProduct(const float *const pValues1, const float *const pValues2, const unsigned int size);
+
+    /**
+     *  @brief  Get the permutation test buffers of the calling thread
+     *
+     *  @return the permutation test buffers
+     */
+    static PermutationTestBuffers &GetPermutationTestBuffers();
 
     /**
      *  @brief  Get the size the size of a dataset
@@ -139,23 +221,6 @@ private:
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-template <typename T>
-inline std::vector<T> LArDiscreteProbabilityHelper::MakeRandomisedSample(const std::vector<T> &t, std::mt19937 &randomNumberGenerator)
-{
-    std::vector<T> randomisedVector(t);
-    std::shuffle(randomisedVector.begin(), randomisedVector.end(), randomNumberGenerator);
-
-    return randomisedVector;
-}
-
-template <>
-inline DiscreteProbabilityVector LArDiscreteProbabilityHelper::MakeRandomisedSample(const DiscreteProbabilityVector &t, std::mt19937 &randomNumberGenerator)
-{
-    return DiscreteProbabilityVector(t, randomNumberGenerator);
-}
-
-//------------------------------------------------------------------------------------------------------------------------------------------
-
 template <typename T>
 inline unsigned int LArDiscreteProbabilityHelper::GetSize(const std::vector<T> &t)
 {
@@ -11,6 +11,7 @@
 
 #include "larpandoracontent/LArHelpers/LArHierarchyHelper.h"
 #include "larpandoracontent/LArHelpers/LArInteractionTypeHelper.h"
+#include "larpandoracontent/LArHelpers/LArScratchHelper.h"
 
 #include <numeric>
 
@@ -1085,163 +1086,132 @@ const std::string LArHierarchyHelper::RecoHierarchy::Node::ToString(const std::s
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+LArHierarchyHelper::HitCounts::HitCounts() :
+    m_nHits{0},
+    m_adc{0.f}
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArHierarchyHelper::HitCounts::HitCounts(const CaloHitList &caloHitList) :
+    HitCounts()
+{
+    for (const CaloHit *pCaloHit : caloHitList)
+        this->AddHit(pCaloHit);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArHierarchyHelper::HitCounts::AddHit(const CaloHit *const pCaloHit)
+{
+    const HitType view{pCaloHit->GetHitType()};
+    const float adc{pCaloHit->GetInputEnergy()};
+
+    ++m_nHits;
+    m_adc += adc;
+    ++m_viewNHitsMap[view];
+    m_viewAdcMap[view] += adc;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 LArHierarchyHelper::MCMatches::MCMatches(const MCHierarchy::Node *pMCParticle) :
-    m_pMCParticle{pMCParticle}
+    m_pMCParticle{pMCParticle},
+    m_mcHitCounts{pMCParticle->GetCaloHits()}
 {
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void LArHierarchyHelper::MCMatches::AddRecoMatch(const RecoHierarchy::Node *pReco, const int nSharedHits)
+void LArHierarchyHelper::MCMatches::AddRecoMatch(
+    const RecoHierarchy::Node *pReco, const HitCounts &sharedHitCounts, const HitCounts &recoHitCounts)
 {
+    m_recoNodeToIndexMap.insert(std::make_pair(pReco, m_recoNodes.size()));
     m_recoNodes.emplace_back(pReco);
-    m_sharedHits.emplace_back(nSharedHits);
+    m_sharedHits.emplace_back(static_cast<int>(sharedHitCounts.GetNHits()));
+    m_sharedHitCounts.emplace_back(sharedHitCounts);
+    m_recoHitCounts.emplace_back(recoHitCounts);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 unsigned int LArHierarchyHelper::MCMatches::GetSharedHits(const RecoHierarchy::Node *pReco) const
 {
-    auto iter{std::find(m_recoNodes.begin(), m_recoNodes.end(), pReco)};
-    if (iter == m_recoNodes.end())
-        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
-    int index = iter - m_recoNodes.begin();
-
-    return static_cast<int>(m_sharedHits[index]);
+    return static_cast<int>(m_sharedHits[this->GetRecoMatchIndex(pReco)]);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 float LArHierarchyHelper::MCMatches::GetPurity(const RecoHierarchy::Node *pReco, const bool adcWeighted) const
 {
-    auto iter{std::find(m_recoNodes.begin(), m_recoNodes.end(), pReco)};
-    if (iter == m_recoNodes.end())
-        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
-
-    const CaloHitList &recoHits{pReco->GetCaloHits()};
-    const CaloHitList &mcHits{m_pMCParticle->GetCaloHits()};
-    CaloHitVector intersection;
-    std::set_intersection(mcHits.begin(), mcHits.end(), recoHits.begin(), recoHits.end(), std::back_inserter(intersection));
+    const size_t index{this->GetRecoMatchIndex(pReco)};
+    const HitCounts &shared{m_sharedHitCounts[index]}, &reco{m_recoHitCounts[index]};
 
-    return this->GetPurity(intersection, recoHits, adcWeighted);
+    return this->GetFraction(shared.GetNHits(), shared.GetAdc(), reco.GetNHits(), reco.GetAdc(), adcWeighted);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 float LArHierarchyHelper::MCMatches::GetPurity(const RecoHierarchy::Node *pReco, const HitType view, const bool adcWeighted) const
 {
-    auto iter{std::find(m_recoNodes.begin(), m_recoNodes.end(), pReco)};
-    if (iter == m_recoNodes.end())
-        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
-
-    CaloHitList recoHits;
-    for (const CaloHit *pCaloHit : pReco->GetCaloHits())
-        if (pCaloHit->GetHitType() == view)
-            recoHits.emplace_back(pCaloHit);
-    CaloHitList mcHits;
-    for (const CaloHit *pCaloHit : m_pMCParticle->GetCaloHits())
-        if (pCaloHit->GetHitType() == view)
-            mcHits.emplace_back(pCaloHit);
-
-    CaloHitVector intersection;
-    std::set_intersection(mcHits.begin(), mcHits.end(), recoHits.begin(), recoHits.end(), std::back_inserter(intersection));
+    const size_t index{this->GetRecoMatchIndex(pReco)};
+    const HitCounts &shared{m_sharedHitCounts[index]}, &reco{m_recoHitCounts[index]};
 
-    return this->GetPurity(intersection, recoHits, adcWeighted);
+    return this->GetFraction(shared.GetNHits(view), shared.GetAdc(view), reco.GetNHits(view), reco.GetAdc(view), adcWeighted);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 float LArHierarchyHelper::MCMatches::GetCompleteness(const RecoHierarchy::Node *pReco, const bool adcWeighted) const
 {
-    auto iter{std::find(m_recoNodes.begin(), m_recoNodes.end(), pReco)};
-    if (iter == m_recoNodes.end())
-        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
-
-    const CaloHitList &recoHits{pReco->GetCaloHits()};
-    const CaloHitList &mcHits{m_pMCParticle->GetCaloHits()};
-    CaloHitVector intersection;
-    std::set_intersection(mcHits.begin(), mcHits.end(), recoHits.begin(), recoHits.end(), std::back_inserter(intersection));
+    const HitCounts &shared{m_sharedHitCounts[this->GetRecoMatchIndex(pReco)]};
 
-    return this->GetCompleteness(intersection, mcHits, adcWeighted);
+    return this->GetFraction(shared.GetNHits(), shared.GetAdc(), m_mcHitCounts.GetNHits(), m_mcHitCounts.GetAdc(), adcWeighted);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 float LArHierarchyHelper::MCMatches::GetCompleteness(const RecoHierarchy::Node *pReco, const HitType view, const bool adcWeighted) const
 {
-    auto iter{std::find(m_recoNodes.begin(), m_recoNodes.end(), pReco)};
-    if (iter == m_recoNodes.end())
-        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
-
-    CaloHitList recoHits;
-    for (const CaloHit *pCaloHit : pReco->GetCaloHits())
-        if (pCaloHit->GetHitType() == view)
-            recoHits.emplace_back(pCaloHit);
-    CaloHitList mcHits;
-    for (const CaloHit *pCaloHit : m_pMCParticle->GetCaloHits())
-        if (pCaloHit->GetHitType() == view)
-            mcHits.emplace_back(pCaloHit);
-
-    CaloHitVector intersection;
-    std::set_intersection(mcHits.begin(), mcHits.end(), recoHits.begin(), recoHits.end(), std::back_inserter(intersection));
+    const HitCounts &shared{m_sharedHitCounts[this->GetRecoMatchIndex(pReco)]};
 
-    return this->GetCompleteness(intersection, mcHits, adcWeighted);
+    return this->GetFraction(
+        shared.GetNHits(view), shared.GetAdc(view), m_mcHitCounts.GetNHits(view), m_mcHitCounts.GetAdc(view), adcWeighted);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-float LArHierarchyHelper::MCMatches::GetPurity(const CaloHitVector &intersection, const CaloHitList &recoHits, const bool adcWeighted) const
+size_t LArHierarchyHelper::MCMatches::GetRecoMatchIndex(const RecoHierarchy::Node *pReco) const
 {
-    float purity{0.f};
-    if (!intersection.empty())
-    {
-        if (adcWeighted)
-        {
-            float adcSum{0.f};
-            for (const CaloHit *pCaloHit : recoHits)
-                adcSum += pCaloHit->GetInputEnergy();
-            if (adcSum > std::numeric_limits<float>::epsilon())
-            {
-                for (const CaloHit *pCaloHit : intersection)
-                    purity += pCaloHit->GetInputEnergy();
-                purity /= adcSum;
-            }
-        }
-        else
-        {
-            purity = intersection.size() / static_cast<float>(recoHits.size());
-        }
-    }
+    const auto iter{m_recoNodeToIndexMap.find(pReco)};
+    if (iter == m_recoNodeToIndexMap.end())
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
 
-    return purity;
+    return iter->second;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-float LArHierarchyHelper::MCMatches::GetCompleteness(const CaloHitVector &intersection, const CaloHitList &mcHits, const bool adcWeighted) const
+float LArHierarchyHelper::MCMatches::GetFraction(
+    const unsigned int nSharedHits, const float sharedAdc, const unsigned int nHits, const float adc, const bool adcWeighted) const
 {
-    float completeness{0.f};
-    if (!intersection.empty())
+    float fraction{0.f};
+    if (nSharedHits > 0)
     {
         if (adcWeighted)
         {
-            float adcSum{0.f};
-            for (const CaloHit *pCaloHit : mcHits)
-                adcSum += pCaloHit->GetInputEnergy();
-            if (adcSum > std::numeric_limits<float>::epsilon())
-            {
-                for (const CaloHit *pCaloHit : intersection)
-                    completeness += pCaloHit->GetInputEnergy();
-                completeness /= adcSum;
-            }
+            if (adc > std::numeric_limits<float>::epsilon())
+                fraction = sharedAdc / adc;
         }
         else
         {
-            completeness = intersection.size() / static_cast<float>(mcHits.size());
+            fraction = nSharedHits / static_cast<float>(nHits);
         }
     }
 
-    return completeness;
+    return fraction;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -1297,57 +1267,103 @@ void LArHierarchyHelper::MatchInfo::Match()
     m_recoHierarchy.GetRootPfos(rootPfos);
     std::map<const MCHierarchy::Node *, MCMatches> mcToMatchMap;
 
+    // Index the reconstructable MC nodes, ordered by decreasing hit count within each interaction, and record which node(s) own each hit
+    MCHierarchy::NodeVector indexedMCNodes;
+    MCParticleVector indexedMCRoots;
+    std::map<const MCHierarchy::Node *, const MCParticle *> mcNodeToRootMap;
+    LArScratchHelper::ScratchUnorderedMap<const CaloHit *, LArScratchHelper::ScratchVector<size_t>> hitToMCNodeIndicesMap(
+        LArScratchHelper::GetScratchResource());
+
     for (const MCParticle *const pRootMC : rootMCParticles)
     {
         MCHierarchy::NodeVector mcNodes;
         m_mcHierarchy.GetFlattenedNodes(pRootMC, mcNodes);
-        for (const ParticleFlowObject *const pRootPfo : rootPfos)
+        std::sort(mcNodes.begin(), mcNodes.end(),
+            [](const MCHierarchy::Node *lhs, const MCHierarchy::Node *rhs)
+            { return lhs->GetCaloHits().size() > rhs->GetCaloHits().size(); });
+
+        for (const MCHierarchy::Node *pMCNode : mcNodes)
+        {
+            mcNodeToRootMap.insert(std::make_pair(pMCNode, pRootMC));
+            if (!pMCNode->IsReconstructable())
+                continue;
+
+            for (const CaloHit *pCaloHit : pMCNode->GetCaloHits())
+                hitToMCNodeIndicesMap[pCaloHit].emplace_back(indexedMCNodes.size());
+
+            indexedMCNodes.emplace_back(pMCNode);
+            indexedMCRoots.emplace_back(pRootMC);
+        }
+    }
+
+    // Accumulate the hits shared with each MC node in a single pass over the hits of each reco node, and select the best MC node per
+    // interaction, favouring the larger MC node if the number of shared hits is tied
+    typedef std::map<size_t, HitCounts> IndexToHitCountsMap;
+    typedef std::unordered_map<const MCParticle *, size_t> RootToIndexMap;
+    std::unordered_map<const RecoHierarchy::Node *, IndexToHitCountsMap> recoToSharedHitCountsMap;
+    std::unordered_map<const RecoHierarchy::Node *, RootToIndexMap> recoToBestIndexMap;
+    std::unordered_map<const RecoHierarchy::Node *, HitCounts> recoToHitCountsMap;
+    std::map<const ParticleFlowObject *, RecoHierarchy::NodeVector> rootPfoToRecoNodesMap;
+
+    for (const ParticleFlowObject *const pRootPfo : rootPfos)
+    {
+        RecoHierarchy::NodeVector &recoNodes(rootPfoToRecoNodesMap[pRootPfo]);
+        m_recoHierarchy.GetFlattenedNodes(pRootPfo, recoNodes);
+        std::sort(recoNodes.begin(), recoNodes.end(),
+            [](const RecoHierarchy::Node *lhs, const RecoHierarchy::Node *rhs)
+            { return lhs->GetCaloHits().size() > rhs->GetCaloHits().size(); });
+
+        for (const RecoHierarchy::Node *pRecoNode : recoNodes)
         {
-            RecoHierarchy::NodeVector recoNodes;
-            m_recoHierarchy.GetFlattenedNodes(pRootPfo, recoNodes);
+            if (recoToHitCountsMap.find(pRecoNode) != recoToHitCountsMap.end())
+                continue;
 
-            std::sort(mcNodes.begin(), mcNodes.end(),
-                [](const MCHierarchy::Node *lhs, const MCHierarchy::Node *rhs)
-                { return lhs->GetCaloHits().size() > rhs->GetCaloHits().size(); });
-            std::sort(recoNodes.begin(), recoNodes.end(),
-                [](const RecoHierarchy::Node *lhs, const RecoHierarchy::Node *rhs)
-                { return lhs->GetCaloHits().size() > rhs->GetCaloHits().size(); });
+            const CaloHitList &recoHits{pRecoNode->GetCaloHits()};
+            recoToHitCountsMap.insert(std::make_pair(pRecoNode, HitCounts(recoHits)));
+            IndexToHitCountsMap &sharedHitCountsMap(recoToSharedHitCountsMap[pRecoNode]);
 
-            for (const RecoHierarchy::Node *pRecoNode : recoNodes)
+            for (const CaloHit *pCaloHit : recoHits)
             {
-                const CaloHitList &recoHits{pRecoNode->GetCaloHits()};
-                const MCHierarchy::Node *pBestNode{nullptr};
-                size_t bestSharedHits{0};
-                for (const MCHierarchy::Node *pMCNode : mcNodes)
-                {
-                    if (!pMCNode->IsReconstructable())
-                        continue;
-                    const CaloHitList &mcHits{pMCNode->GetCaloHits()};
-                    CaloHitVector intersection;
-                    std::set_intersection(mcHits.begin(), mcHits.end(), recoHits.begin(), recoHits.end(), std::back_inserter(intersection));
+                const auto iter{hitToMCNodeIndicesMap.find(pCaloHit)};
+                if (iter == hitToMCNodeIndicesMap.end())
+                    continue;
 
-                    if (!intersection.empty())
-                    {
-                        const size_t sharedHits{intersection.size()};
-                        if (sharedHits > bestSharedHits)
-                        {
-                            bestSharedHits = sharedHits;
-                            pBestNode = pMCNode;
-                        }
-                    }
-                }
-                if (pBestNode)
+                for (const size_t index : iter->second)
+                    sharedHitCountsMap[index].AddHit(pCaloHit);
+            }
+
+            RootToIndexMap &bestIndexMap(recoToBestIndexMap[pRecoNode]);
+            for (const auto &[index, sharedHitCounts] : sharedHitCountsMap)
+            {
+                const auto bestIter{bestIndexMap.find(indexedMCRoots[index])};
+                if ((bestIter == bestIndexMap.end()) || (sharedHitCounts.GetNHits() > sharedHitCountsMap.at(bestIter->second).GetNHits()))
+                    bestIndexMap[indexedMCRoots[index]] = index;
+            }
+        }
+    }
+
+    for (const MCParticle *const pRootMC : rootMCParticles)
+    {
+        for (const ParticleFlowObject *const pRootPfo : rootPfos)
+        {
+            for (const RecoHierarchy::Node *pRecoNode : rootPfoToRecoNodesMap.at(pRootPfo))
+            {
+                const RootToIndexMap &bestIndexMap(recoToBestIndexMap.at(pRecoNode));
+                const auto bestIter{bestIndexMap.find(pRootMC)};
+                if (bestIter != bestIndexMap.end())
                 {
+                    const MCHierarchy::Node *pBestNode{indexedMCNodes[bestIter->second]};
+                    const HitCounts &sharedHitCounts(recoToSharedHitCountsMap.at(pRecoNode).at(bestIter->second));
                     auto iter{mcToMatchMap.find(pBestNode)};
                     if (iter != mcToMatchMap.end())
                     {
                         MCMatches &match(iter->second);
-                        match.AddRecoMatch(pRecoNode, static_cast<int>(bestSharedHits));
+                        match.AddRecoMatch(pRecoNode, sharedHitCounts, recoToHitCountsMap.at(pRecoNode));
                     }
                     else
                     {
                         MCMatches match(pBestNode);
-                        match.AddRecoMatch(pRecoNode, static_cast<int>(bestSharedHits));
+                        match.AddRecoMatch(pRecoNode, sharedHitCounts, recoToHitCountsMap.at(pRecoNode));
                         mcToMatchMap.insert(std::make_pair(pBestNode, match));
                     }
                 }
@@ -1359,19 +1375,12 @@ void LArHierarchyHelper::MatchInfo::Match()
         }
     }
 
-    for (auto [pMCNode, matches] : mcToMatchMap)
+    for (const auto &[pMCNode, matches] : mcToMatchMap)
     {
         // We need to figure out which MC interaction hierarchy the matches belongs to
-        for (const MCParticle *const pRootMC : rootMCParticles)
-        {
-            MCHierarchy::NodeVector mcNodes;
-            m_mcHierarchy.GetFlattenedNodes(pRootMC, mcNodes);
-            if (std::find(mcNodes.begin(), mcNodes.end(), pMCNode) != mcNodes.end())
-            {
-                m_matches[pRootMC].emplace_back(matches);
-                break;
-            }
-        }
+        const auto iter{mcNodeToRootMap.find(pMCNode)};
+        if (iter != mcNodeToRootMap.end())
+            m_matches[iter->second].emplace_back(matches);
     }
 
     const auto predicate = [](const MCMatches &lhs, const MCMatches &rhs)
@@ -598,6 +598,73 @@ public:
         RecoNodeVectorMap m_interactions; ///< Map from the root PFO (e.g. neutrino) to primaries
     };
 
+    /**
+     *  @brief  HitCounts class, accumulating the number of hits and their charge, both overall and by view
+     */
+    class HitCounts
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        HitCounts();
+
+        /**
+         *  @brief  Constructor, accumulating the counts for a list of hits
+         *
+         *  @param  caloHitList The list of hits to count
+         */
+        HitCounts(const pandora::CaloHitList &caloHitList);
+
+        /**
+         *  @brief  Add a hit to the counts
+         *
+         *  @param  pCaloHit The hit to add
+         */
+        void AddHit(const pandora::CaloHit *const pCaloHit);
+
+        /**
+         *  @brief  Retrieve the number of hits
+         *
+         *  @return The number of hits
+         */
+        unsigned int GetNHits() const;
+
+        /**
+         *  @brief  Retrieve the number of hits in a given view
+         *
+         *  @param  view The view of interest
+         *
+         *  @return The number of hits in the view
+         */
+        unsigned int GetNHits(const pandora::HitType view) const;
+
+        /**
+         *  @brief  Retrieve the summed charge of the hits
+         *
+         *  @return The summed charge
+         */
+        float GetAdc() const;
+
+        /**
+         *  @brief  Retrieve the summed charge of the hits in a given view
+         *
+         *  @param  view The view of interest
+         *
+         *  @return The summed charge in the view
+         */
+        float GetAdc(const pandora::HitType view) const;
+
+    private:
+        typedef std::map<pandora::HitType, unsigned int> HitTypeToUIntMap;
+        typedef std::map<pandora::HitType, float> HitTypeToFloatMap;
+
+        unsigned int m_nHits;            ///< The number of hits
+        float m_adc;                     ///< The summed charge of the hits
+        HitTypeToUIntMap m_viewNHitsMap; ///< The number of hits in each view
+        HitTypeToFloatMap m_viewAdcMap;  ///< The summed charge of the hits in each view
+    };
+
     /**
      *  @brief  MCMatches class
      */
@@ -615,9 +682,10 @@ public:
          *  @brief  Add a reconstructed node as a match for this MC node
          *
          *  @param  pReco The reconstructed node that matches this MC node
-         *  @param  nSharedHits The number of hits shared betweeb reco and MC nodes
+         *  @param  sharedHitCounts The counts for the hits shared between reco and MC nodes
+         *  @param  recoHitCounts The counts for all hits in the reco node
          */
-        void AddRecoMatch(const RecoHierarchy::Node *pReco, const int nSharedHits);
+        void AddRecoMatch(const RecoHierarchy::Node *pReco, const HitCounts &sharedHitCounts, const HitCounts &recoHitCounts);
 
         /**
          *  @brief  Retrieve the MC node
@@ -702,30 +770,38 @@ public:
 
     private:
         /**
-         *  @brief  Core purity calculation given intersecting hits and reco hits
+         *  @brief  Retrieve the index of a matched reco node
          *
-         *  @param  intersection The intersecting reco and MC hits
-         *  @param  recoHits The reco hits
-         *  @param  adcWeighted Whether or not to weight purity according to the charge contribution
+         *  @param  pReco The reco node to consider
          *
-         *  @return The purity of the match
+         *  @return The index of the reco node in the vector of matches
          */
-        float GetPurity(const pandora::CaloHitVector &intersection, const pandora::CaloHitList &recoHits, const bool adcWeighted) const;
+        size_t GetRecoMatchIndex(const RecoHierarchy::Node *pReco) const;
 
         /**
-         *  @brief  Core completeness calculation given intersecting hits and MC hits
+         *  @brief  Core fraction calculation given the shared hit counts and the total hit counts
          *
-         *  @param  intersection The intersecting reco and MC hits
-         *  @param  mcHits The MC hits
-         *  @param  adcWeighted Whether or not to weight completeness according to the charge contribution
+         *  @param  nSharedHits The number of shared hits
+         *  @param  sharedAdc The summed charge of the shared hits
+         *  @param  nHits The total number of hits
+         *  @param  adc The total summed charge of the hits
+         *  @param  adcWeighted Whether or not to weight the fraction according to the charge contribution
          *
-         *  @return The completeness of the match
+         *  @return The shared fraction
          */
-        float GetCompleteness(const pandora::CaloHitVector &intersection, const pandora::CaloHitList &mcHits, const bool adcWeighted) const;
-
-        const MCHierarchy::Node *m_pMCParticle; ///< MC node associated with any matches
-        RecoHierarchy::NodeVector m_recoNodes;  ///< Matched reco nodes
-        pandora::IntVector m_sharedHits;        ///< Number of shared hits for each match
+        float GetFraction(
+            const unsigned int nSharedHits, const float sharedAdc, const unsigned int nHits, const float adc, const bool adcWeighted) const;
+
+        typedef std::vector<HitCounts> HitCountsVector;
+        typedef std::unordered_map<const RecoHierarchy::Node *, size_t> RecoNodeToIndexMap;
+
+        const MCHierarchy::Node *m_pMCParticle;  ///< MC node associated with any matches
+        HitCounts m_mcHitCounts;                 ///< The counts for all hits in the MC node
+        RecoHierarchy::NodeVector m_recoNodes;   ///< Matched reco nodes
+        pandora::IntVector m_sharedHits;         ///< Number of shared hits for each match
+        HitCountsVector m_sharedHitCounts;       ///< The counts for the shared hits for each match
+        HitCountsVector m_recoHitCounts;         ///< The counts for all hits in the reco node for each match
+        RecoNodeToIndexMap m_recoNodeToIndexMap; ///< The map from matched reco nodes to their index in the vector of matches
     };
 
     typedef std::vector<MCMatches> MCMatchesVector;
@@ -984,6 +1060,39 @@ inline const pandora::ParticleFlowObject *LArHierarchyHelper::RecoHierarchy::Nod
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+inline unsigned int LArHierarchyHelper::HitCounts::GetNHits() const
+{
+    return m_nHits;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline unsigned int LArHierarchyHelper::HitCounts::GetNHits(const pandora::HitType view) const
+{
+    const auto iter{m_viewNHitsMap.find(view)};
+
+    return (iter != m_viewNHitsMap.end()) ? iter->second : 0;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline float LArHierarchyHelper::HitCounts::GetAdc() const
+{
+    return m_adc;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline float LArHierarchyHelper::HitCounts::GetAdc(const pandora::HitType view) const
+{
+    const auto iter{m_viewAdcMap.find(view)};
+
+    return (iter != m_viewAdcMap.end()) ? iter->second : 0.f;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 inline const LArHierarchyHelper::MCHierarchy::Node *LArHierarchyHelper::MCMatches::GetMC() const
 {
     return m_pMCParticle;
@@ -35,12 +35,8 @@ bool LArHitWidthHelper::ConstituentHit::SortByDistanceToPoint::operator()(const
 
 LArHitWidthHelper::ClusterParameters::ClusterParameters(
     const Cluster *const pCluster, const float maxConstituentHitWidth, const bool isUniformHits, const float hitWidthScalingFactor) :
-    m_pCluster(pCluster),
-    m_numCaloHits(pCluster->GetNCaloHits()),
-    m_constituentHitVector(LArHitWidthHelper::GetConstituentHits(pCluster, maxConstituentHitWidth, hitWidthScalingFactor, isUniformHits)),
-    m_totalWeight(LArHitWidthHelper::GetTotalClusterWeight(m_constituentHitVector)),
-    m_lowerXExtrema(LArHitWidthHelper::GetExtremalCoordinatesLowerX(m_constituentHitVector)),
-    m_higherXExtrema(LArHitWidthHelper::GetExtremalCoordinatesHigherX(m_constituentHitVector))
+    ClusterParameters(pCluster, pCluster->GetNCaloHits(),
+        LArHitWidthHelper::GetClusterConstituentHits(pCluster, maxConstituentHitWidth, hitWidthScalingFactor, isUniformHits))
 {
 }
 
@@ -57,6 +53,76 @@ LArHitWidthHelper::ClusterParameters::ClusterParameters(const Cluster *const pCl
 {
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArHitWidthHelper::ClusterParameters::ClusterParameters(
+    const Cluster *const pCluster, const unsigned int numCaloHits, const ClusterConstituentHits &clusterConstituentHits) :
+    m_pCluster(pCluster),
+    m_numCaloHits(numCaloHits),
+    m_constituentHitVector(clusterConstituentHits.GetConstituentHitVector()),
+    m_totalWeight(LArHitWidthHelper::GetTotalClusterWeight(m_constituentHitVector)),
+    m_lowerXExtrema(clusterConstituentHits.GetLowerXExtrema()),
+    m_higherXExtrema(clusterConstituentHits.GetHigherXExtrema())
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArHitWidthHelper::ClusterConstituentHits::ClusterConstituentHits(
+    const Cluster *const pCluster, const float maxConstituentHitWidth, const float hitWidthScalingFactor, const bool isUniform) :
+    m_clusterVersion(pCluster),
+    m_constituentHitVector(LArHitWidthHelper::GetConstituentHits(pCluster, maxConstituentHitWidth, hitWidthScalingFactor, isUniform)),
+    m_extremalCoordinatesFound(false),
+    m_lowerXExtrema(0.f, 0.f, 0.f),
+    m_higherXExtrema(0.f, 0.f, 0.f)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool LArHitWidthHelper::ClusterConstituentHits::IsUpToDate(const Cluster *const pCluster) const
+{
+    return m_clusterVersion.IsUpToDate(pCluster);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const CartesianPointVector &LArHitWidthHelper::ClusterConstituentHits::GetConstituentHitPositionVector() const
+{
+    if (m_constituentHitPositionVector.empty())
+        m_constituentHitPositionVector = LArHitWidthHelper::GetConstituentHitPositionVector(m_constituentHitVector);
+
+    return m_constituentHitPositionVector;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const CartesianVector &LArHitWidthHelper::ClusterConstituentHits::GetLowerXExtrema() const
+{
+    this->FindExtremalCoordinatesX();
+    return m_lowerXExtrema;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const CartesianVector &LArHitWidthHelper::ClusterConstituentHits::GetHigherXExtrema() const
+{
+    this->FindExtremalCoordinatesX();
+    return m_higherXExtrema;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArHitWidthHelper::ClusterConstituentHits::FindExtremalCoordinatesX() const
+{
+    if (m_extremalCoordinatesFound)
+        return;
+
+    LArHitWidthHelper::GetExtremalCoordinatesX(m_constituentHitVector, m_lowerXExtrema, m_higherXExtrema);
+    m_extremalCoordinatesFound = true;
+}
+
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -155,6 +221,55 @@ LArHitWidthHelper::ConstituentHitVector LArHitWidthHelper::GetConstituentHits(
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+const LArHitWidthHelper::ClusterConstituentHits &LArHitWidthHelper::GetClusterConstituentHits(
+    const Cluster *const pCluster, const float maxConstituentHitWidth, const float hitWidthScalingFactor, const bool isUniform)
+{
+    // ATTN Entries hold many constituent hits, so generations are smaller than for cluster summaries, but callers hold only two references
+    const size_t maxGenerationSize(1000);
+
+    ConstituentHitCache &constituentHitCache(LArHitWidthHelper::GetConstituentHitCache());
+    ConstituentHitMap &currentConstituentHits(constituentHitCache.m_currentConstituentHits);
+    const ConstituentHitKey constituentHitKey(pCluster, maxConstituentHitWidth, hitWidthScalingFactor, isUniform);
+    ConstituentHitMap::iterator iter(currentConstituentHits.find(constituentHitKey));
+
+    if (currentConstituentHits.end() != iter)
+    {
+        // ATTN Staleness, including reuse of a deleted cluster address, is detected only as far as the ClusterVersion fingerprint allows
+        if (!iter->second.IsUpToDate(pCluster))
+            iter->second = ClusterConstituentHits(pCluster, maxConstituentHitWidth, hitWidthScalingFactor, isUniform);
+
+        return iter->second;
+    }
+
+    // Moving the full generation keeps its nodes, so references to its entries remain valid until the following generation is full
+    if (currentConstituentHits.size() >= maxGenerationSize)
+    {
+        constituentHitCache.m_previousConstituentHits = std::move(currentConstituentHits);
+        currentConstituentHits.clear();
+    }
+
+    ConstituentHitMap &previousConstituentHits(constituentHitCache.m_previousConstituentHits);
+    const ConstituentHitMap::const_iterator previousIter(previousConstituentHits.find(constituentHitKey));
+
+    if ((previousConstituentHits.end() != previousIter) && previousIter->second.IsUpToDate(pCluster))
+        return currentConstituentHits.emplace(constituentHitKey, previousIter->second).first->second;
+
+    return currentConstituentHits
+        .emplace(constituentHitKey, ClusterConstituentHits(pCluster, maxConstituentHitWidth, hitWidthScalingFactor, isUniform))
+        .first->second;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArHitWidthHelper::ResetConstituentHitCache()
+{
+    ConstituentHitCache &constituentHitCache(LArHitWidthHelper::GetConstituentHitCache());
+    constituentHitCache.m_currentConstituentHits.clear();
+    constituentHitCache.m_previousConstituentHits.clear();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void LArHitWidthHelper::SplitHitIntoConstituents(const CaloHit *const pCaloHit, const Cluster *const pCluster,
     const unsigned int numberOfConstituentHits, const float constituentHitWidth, LArHitWidthHelper::ConstituentHitVector &constituentHitVector)
 {
@@ -371,4 +486,12 @@ float LArHitWidthHelper::GetClosestDistance(const CaloHit *const pCaloHit1, cons
     return std::sqrt((deltaX * deltaX) + (modDeltaZ * modDeltaZ));
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArHitWidthHelper::ConstituentHitCache &LArHitWidthHelper::GetConstituentHitCache()
+{
+    static thread_local ConstituentHitCache constituentHitCache;
+    return constituentHitCache;
+}
+
 } // namespace lar_content
@@ -10,6 +10,11 @@
 
 #include "Objects/Cluster.h"
 
+#include "larpandoracontent/LArHelpers/LArClusterHelper.h"
+
+#include <map>
+#include <tuple>
+
 namespace lar_content
 {
 
@@ -87,6 +92,8 @@ public:
 
     typedef std::vector<ConstituentHit> ConstituentHitVector;
 
+    class ClusterConstituentHits;
+
     /**
      *  @brief  ClusterParameters class
      */
@@ -150,6 +157,16 @@ public:
         const pandora::CartesianVector &GetHigherXExtrema() const;
 
     private:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  pCluster from which the parameters will be obtained
+         *  @param  numCaloHits the number of calo hits within the cluster
+         *  @param  clusterConstituentHits the constituent hits of the cluster
+         */
+        ClusterParameters(
+            const pandora::Cluster *const pCluster, const unsigned int numCaloHits, const ClusterConstituentHits &clusterConstituentHits);
+
         const pandora::Cluster *m_pCluster;                ///< The address of the cluster
         const unsigned int m_numCaloHits;                  ///< The number of calo hits within the cluster
         const ConstituentHitVector m_constituentHitVector; ///< The vector of constituent hits
@@ -160,6 +177,68 @@ public:
 
     typedef std::unordered_map<const pandora::Cluster *, const ClusterParameters> ClusterToParametersMap;
 
+    /**
+     *  @brief  ClusterConstituentHits class, the constituent hits into which the hits of a cluster are broken, stored contiguously together
+     *          with the derived quantities requested of them. The version of the cluster hit content is recorded, so that the constituent
+     *          hits can be cached and reused until the cluster is modified
+     */
+    class ClusterConstituentHits
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  pCluster the input cluster
+         *  @param  maxConstituentHitWidth the maximum width of a constituent hit
+         *  @param  hitWidthScalingFactor the constituent hit width scaling factor
+         *  @param  isUniform whether to break up the hit into uniform constituent hits (and pad the hit) or not
+         */
+        ClusterConstituentHits(const pandora::Cluster *const pCluster, const float maxConstituentHitWidth,
+            const float hitWidthScalingFactor, const bool isUniform);
+
+        /**
+         *  @brief  Whether the constituent hits are up to date with the hit content of a cluster
+         *
+         *  @param  pCluster the input cluster
+         *
+         *  @return boolean
+         */
+        bool IsUpToDate(const pandora::Cluster *const pCluster) const;
+
+        /**
+         *  @brief  Returns the vector of constituent hits
+         */
+        const ConstituentHitVector &GetConstituentHitVector() const;
+
+        /**
+         *  @brief  Returns the vector of constituent hit central positions, calculated on first use
+         */
+        const pandora::CartesianPointVector &GetConstituentHitPositionVector() const;
+
+        /**
+         *  @brief  Returns the lower x extremal point of the constituent hits, calculated on first use
+         */
+        const pandora::CartesianVector &GetLowerXExtrema() const;
+
+        /**
+         *  @brief  Returns the higher x extremal point of the constituent hits, calculated on first use
+         */
+        const pandora::CartesianVector &GetHigherXExtrema() const;
+
+    private:
+        /**
+         *  @brief  Calculate the lower and higher x extremal points of the constituent hits, if not yet calculated
+         */
+        void FindExtremalCoordinatesX() const;
+
+        LArClusterHelper::ClusterVersion m_clusterVersion;                    ///< The version of the cluster hit content, when broken up
+        ConstituentHitVector m_constituentHitVector;                          ///< The vector of constituent hits
+        mutable pandora::CartesianPointVector m_constituentHitPositionVector; ///< The constituent hit central positions
+        mutable bool m_extremalCoordinatesFound;                              ///< Whether the extremal points have been calculated
+        mutable pandora::CartesianVector m_lowerXExtrema;                     ///< The lower x extremal point of the constituent hits
+        mutable pandora::CartesianVector m_higherXExtrema;                    ///< The higher x extremal point of the constituent hits
+    };
+
     /**
      *  @brief  SortByHigherExtrema class
      */
@@ -223,6 +302,29 @@ public:
     static ConstituentHitVector GetConstituentHits(
         const pandora::Cluster *const pCluster, const float maxConstituentHitWidth, const float hitWidthScalingFactor, const bool isUniform);
 
+    /**
+     *  @brief  Get the cached constituent hits of a cluster, breaking up the cluster hits only if they have not yet been broken up with
+     *          these parameters, or if the cluster version has since changed (see the ClusterVersion limitations). The cache is owned by
+     *          the calling thread and holds at most two generations of entries, the older discarded as a new generation fills, so its
+     *          size is bounded even if it is never reset. The returned reference remains valid until the cluster is modified, the cache
+     *          is reset, or a further generation of entries has been built
+     *
+     *  @param  pCluster the input cluster
+     *  @param  maxConstituentHitWidth the maximum width of a constituent hit
+     *  @param  hitWidthScalingFactor the constituent hit width scaling factor
+     *  @param  isUniform whether to break up the hit into uniform constituent hits (and pad the hit) or not
+     *
+     *  @return  the cluster constituent hits
+     */
+    static const ClusterConstituentHits &GetClusterConstituentHits(const pandora::Cluster *const pCluster,
+        const float maxConstituentHitWidth, const float hitWidthScalingFactor, const bool isUniform);
+
+    /**
+     *  @brief  Reset the constituent hit cache of the calling thread, to be called at event boundaries (or any other point at which no
+     *          constituent hit references are held) to release the entries promptly
+     */
+    static void ResetConstituentHitCache();
+
     /**
      *  @brief  Break up the calo hit into constituent hits
      *
@@ -332,6 +434,27 @@ public:
      *  @return the smallest separation
      */
     static float GetClosestDistance(const pandora::CaloHit *const pCaloHit1, const pandora::CaloHit *const pCaloHit2);
+
+private:
+    typedef std::tuple<const pandora::Cluster *, float, float, bool> ConstituentHitKey;
+    typedef std::map<ConstituentHitKey, ClusterConstituentHits> ConstituentHitMap;
+
+    /**
+     *  @brief  ConstituentHitCache class, holding the current generation of cluster constituent hits and the generation before it
+     */
+    class ConstituentHitCache
+    {
+    public:
+        ConstituentHitMap m_currentConstituentHits;  ///< The cluster constituent hits of the current generation
+        ConstituentHitMap m_previousConstituentHits; ///< The cluster constituent hits of the previous generation
+    };
+
+    /**
+     *  @brief  Get the constituent hit cache of the calling thread
+     *
+     *  @return the constituent hit cache
+     */
+    static ConstituentHitCache &GetConstituentHitCache();
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -401,6 +524,14 @@ inline const pandora::CartesianVector &LArHitWidthHelper::ClusterParameters::Get
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+inline const LArHitWidthHelper::ConstituentHitVector &LArHitWidthHelper::ClusterConstituentHits::GetConstituentHitVector() const
+{
+    return m_constituentHitVector;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 inline LArHitWidthHelper::SortByHigherXExtrema::SortByHigherXExtrema(const ClusterToParametersMap &clusterToParametersMap) :
     m_clusterToParametersMap(clusterToParametersMap)
 {
@@ -19,6 +19,7 @@
 #include "larpandoracontent/LArHelpers/LArMCParticleHelper.h"
 #include "larpandoracontent/LArHelpers/LArMonitoringHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
+#include "larpandoracontent/LArHelpers/LArScratchHelper.h"
 
 #include <algorithm>
 #include <cstdlib>
@@ -964,9 +965,16 @@ CaloHitList LArMCParticleHelper::GetSharedHits(const CaloHitList &hitListA, cons
 {
     CaloHitList sharedHits;
 
+    if (hitListA.empty() || hitListB.empty())
+        return sharedHits;
+
+    // ATTN Lookup is by address, but the shared hits retain the order of hitListA
+    LArScratchHelper::ScratchCaloHitVector sortedHitsB(hitListB.begin(), hitListB.end(), LArScratchHelper::GetScratchResource());
+    std::sort(sortedHitsB.begin(), sortedHitsB.end(), std::less<const CaloHit *>());
+
     for (const CaloHit *const pCaloHit : hitListA)
     {
-        if (std::find(hitListB.begin(), hitListB.end(), pCaloHit) != hitListB.end())
+        if (std::binary_search(sortedHitsB.begin(), sortedHitsB.end(), pCaloHit, std::less<const CaloHit *>()))
             sharedHits.push_back(pCaloHit);
     }
 
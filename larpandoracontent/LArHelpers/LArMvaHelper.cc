@@ -8,6 +8,8 @@
 
 #include "larpandoracontent/LArHelpers/LArMvaHelper.h"
 
+#include <iostream>
+
 using namespace pandora;
 
 namespace lar_content
@@ -39,4 +41,233 @@ StatusCode LArMvaHelper::ProcessAlgorithmToolListToMap(const Algorithm &algorith
     return STATUS_CODE_SUCCESS;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArMvaHelper::FlushTrainingExamples()
+{
+    TrainingExampleWriterRegistry &registry(LArMvaHelper::GetTrainingExampleWriterRegistry());
+    const std::lock_guard<std::mutex> lock(registry.m_mutex);
+
+    for (const auto &mapEntry : registry.m_writerMap)
+        mapEntry.second->Flush();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode LArMvaHelper::ReadTrainingOutputFormat(const TiXmlHandle xmlHandle, TrainingOutputFormat &format)
+{
+    std::string formatName((TRAINING_OUTPUT_BINARY == format) ? "binary" : "csv");
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "TrainingOutputFormat", formatName));
+
+    if ((formatName != "csv") && (formatName != "binary"))
+    {
+        std::cout << "LArMvaHelper::ReadTrainingOutputFormat - unknown TrainingOutputFormat " << formatName << ", expected csv or binary"
+                  << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
+    format = (formatName == "binary") ? TRAINING_OUTPUT_BINARY : TRAINING_OUTPUT_CSV;
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArMvaHelper::TrainingExampleWriterRegistry &LArMvaHelper::GetTrainingExampleWriterRegistry()
+{
+    static TrainingExampleWriterRegistry registry;
+    return registry;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode LArMvaHelper::WriteTrainingExample(const std::string &trainingOutputFile, const TrainingOutputFormat format, const bool result,
+    const StringVector &featureNames, const MvaFeatureVector &featureVector)
+{
+    TrainingExampleWriterRegistry &registry(LArMvaHelper::GetTrainingExampleWriterRegistry());
+    const std::lock_guard<std::mutex> lock(registry.m_mutex);
+
+    TrainingExampleWriterMap::const_iterator iter(registry.m_writerMap.find(trainingOutputFile));
+
+    if (registry.m_writerMap.end() == iter)
+    {
+        std::unique_ptr<TrainingExampleWriter> pWriter(new TrainingExampleWriter(trainingOutputFile, format));
+
+        if (!pWriter->IsOpen())
+        {
+            std::cout << "LArMvaHelper: could not open file for training examples at " << trainingOutputFile << std::endl;
+            return STATUS_CODE_FAILURE;
+        }
+
+        iter = registry.m_writerMap.insert(TrainingExampleWriterMap::value_type(trainingOutputFile, std::move(pWriter))).first;
+    }
+
+    if (format != iter->second->GetFormat())
+    {
+        std::cout << "LArMvaHelper: training examples at " << trainingOutputFile << " are already being written in a different format"
+                  << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
+    return iter->second->Write(result, featureNames, featureVector);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArMvaHelper::TrainingExampleWriter::TrainingExampleWriter(const std::string &fileName, const TrainingOutputFormat format) :
+    m_fileName(fileName),
+    m_format(format),
+    m_buffer(1 << 20),
+    m_isHeaderWritten(false)
+{
+    // ATTN the stream buffer must be provided before the file is opened
+    m_outfile.rdbuf()->pubsetbuf(m_buffer.data(), m_buffer.size());
+
+    // Always append to the output file, so that examples from successive jobs may be collected together
+    const std::ios_base::openmode mode(
+        (TRAINING_OUTPUT_BINARY == m_format) ? std::ios_base::app | std::ios_base::binary : std::ios_base::app);
+    m_outfile.open(m_fileName, mode);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArMvaHelper::TrainingExampleWriter::~TrainingExampleWriter()
+{
+    try
+    {
+        this->Flush();
+    }
+    catch (...)
+    {
+        std::cout << "LArMvaHelper: failed to write buffered training examples to " << m_fileName << std::endl;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool LArMvaHelper::TrainingExampleWriter::IsOpen() const
+{
+    return m_outfile.is_open();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArMvaHelper::TrainingOutputFormat LArMvaHelper::TrainingExampleWriter::GetFormat() const
+{
+    return m_format;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode LArMvaHelper::TrainingExampleWriter::Write(
+    const bool result, const StringVector &featureNames, const MvaFeatureVector &featureVector)
+{
+    if (TRAINING_OUTPUT_BINARY == m_format)
+        return this->BufferBinaryExample(result, featureNames, featureVector);
+
+    const std::string delimiter(",");
+    m_outfile << LArMvaHelper::GetTimestampString() << delimiter;
+
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArMvaHelper::WriteFeaturesToFile(m_outfile, delimiter, featureVector));
+    m_outfile << static_cast<int>(result) << '\n';
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArMvaHelper::TrainingExampleWriter::Flush()
+{
+    if ((TRAINING_OUTPUT_BINARY == m_format) && !m_results.empty())
+        this->WriteBinaryBlock();
+
+    m_outfile.flush();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode LArMvaHelper::TrainingExampleWriter::BufferBinaryExample(
+    const bool result, const StringVector &featureNames, const MvaFeatureVector &featureVector)
+{
+    if (!m_isHeaderWritten)
+    {
+        m_featureNames = featureNames;
+        m_columns.resize(featureVector.size());
+        this->WriteBinaryHeader();
+    }
+
+    if ((featureVector.size() != m_columns.size()) || (!featureNames.empty() && (featureNames != m_featureNames)))
+    {
+        std::cout << "LArMvaHelper: training example features do not match the header of " << m_fileName << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
+    // Check every feature before buffering any, so that an uninitialized feature cannot leave the columns of unequal length
+    for (const MvaFeature &feature : featureVector)
+    {
+        if (!feature.IsInitialized())
+            throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
+    }
+
+    for (size_t iFeature = 0; iFeature < featureVector.size(); ++iFeature)
+        m_columns[iFeature].push_back(featureVector[iFeature].Get());
+
+    m_results.push_back(static_cast<std::uint8_t>(result));
+
+    // Blocks of a few thousand examples keep each column contiguous on disk without holding a whole training sample in memory
+    if (m_results.size() >= 4096)
+        this->WriteBinaryBlock();
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArMvaHelper::TrainingExampleWriter::WriteBinaryHeader()
+{
+    m_outfile.write("LMVH", 4);
+    this->WriteBinaryValue(1);
+    this->WriteBinaryString(LArMvaHelper::GetTimestampString());
+    this->WriteBinaryValue(static_cast<std::uint32_t>(m_columns.size()));
+
+    for (size_t iFeature = 0; iFeature < m_columns.size(); ++iFeature)
+        this->WriteBinaryString(m_featureNames.empty() ? std::string() : m_featureNames.at(iFeature));
+
+    m_isHeaderWritten = true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArMvaHelper::TrainingExampleWriter::WriteBinaryBlock()
+{
+    m_outfile.write("LMVB", 4);
+    this->WriteBinaryValue(static_cast<std::uint32_t>(m_results.size()));
+
+    for (std::vector<double> &column : m_columns)
+    {
+        m_outfile.write(reinterpret_cast<const char *>(column.data()), column.size() * sizeof(double));
+        column.clear();
+    }
+
+    m_outfile.write(reinterpret_cast<const char *>(m_results.data()), m_results.size() * sizeof(std::uint8_t));
+    m_results.clear();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArMvaHelper::TrainingExampleWriter::WriteBinaryValue(const std::uint32_t value)
+{
+    m_outfile.write(reinterpret_cast<const char *>(&value), sizeof(std::uint32_t));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArMvaHelper::TrainingExampleWriter::WriteBinaryString(const std::string &value)
+{
+    this->WriteBinaryValue(static_cast<std::uint32_t>(value.size()));
+    m_outfile.write(value.data(), value.size());
+}
+
 } // namespace lar_content
@@ -8,6 +8,8 @@
 #ifndef LAR_MVA_HELPER_H
 #define LAR_MVA_HELPER_H 1
 
+#include "larpandoracontent/LArHelpers/LArProfilingHelper.h"
+
 #include "larpandoracontent/LArObjects/LArMvaInterface.h"
 
 #include "Api/PandoraContentApi.h"
@@ -20,8 +22,11 @@
 #include "Pandora/StatusCodes.h"
 
 #include <chrono>
+#include <cstdint>
 #include <ctime>
 #include <fstream>
+#include <memory>
+#include <mutex>
 
 namespace lar_content
 {
@@ -55,6 +60,17 @@ public:
         (void)featureToolName;
         return;
     };
+
+    /**
+     *  @brief  Whether Run may be called concurrently for different arguments, i.e. the tool reads only its configuration and its
+     *          arguments, and writes only to its output arguments
+     *
+     *  @return boolean
+     */
+    virtual bool IsThreadSafe() const
+    {
+        return false;
+    };
 };
 
 template <typename... Ts>
@@ -78,16 +94,27 @@ public:
     typedef MvaTypes::MvaFeatureMap MvaFeatureMap;
     typedef std::map<std::string, pandora::AlgorithmTool *> AlgorithmToolMap; // idea would be to put this in PandoraInternal.h at some point in PandoraSDK
 
+    /**
+     *  @brief  TrainingOutputFormat enum
+     */
+    enum TrainingOutputFormat
+    {
+        TRAINING_OUTPUT_CSV,   ///< One line per example: timestamp, features and result, comma separated
+        TRAINING_OUTPUT_BINARY ///< A header of feature names, then blocks of examples stored column by column
+    };
+
     /**
      *  @brief  Produce a training example with the given features and result
      *
      *  @param  trainingOutputFile the file to which to append the example
      *  @param  featureContainer the container of features
+     *  @param  format the format of the output file
      *
      *  @return success
      */
     template <typename TCONTAINER>
-    static pandora::StatusCode ProduceTrainingExample(const std::string &trainingOutputFile, const bool result, TCONTAINER &&featureContainer);
+    static pandora::StatusCode ProduceTrainingExample(const std::string &trainingOutputFile, const bool result,
+        TCONTAINER &&featureContainer, const TrainingOutputFormat format = TRAINING_OUTPUT_CSV);
 
     /**
      *  @brief  Produce a training example with the given features and result - using a map
@@ -95,12 +122,29 @@ public:
      *  @param  trainingOutputFile the file to which to append the example
      *  @param  featureOrder the vector of strings corresponding to ordered list of keys
      *  @param  featureContainer the container of features
+     *  @param  format the format of the output file
      *
      *  @return success
      */
     template <typename TCONTAINER>
-    static pandora::StatusCode ProduceTrainingExample(
-        const std::string &trainingOutputFile, const bool result, const pandora::StringVector &featureOrder, TCONTAINER &&featureContainer);
+    static pandora::StatusCode ProduceTrainingExample(const std::string &trainingOutputFile, const bool result,
+        const pandora::StringVector &featureOrder, TCONTAINER &&featureContainer, const TrainingOutputFormat format = TRAINING_OUTPUT_CSV);
+
+    /**
+     *  @brief  Write any buffered training examples to their output files. Producers of training examples call this at event boundaries,
+     *          from Reset, so that a job that ends abnormally loses at most the examples of its last event
+     */
+    static void FlushTrainingExamples();
+
+    /**
+     *  @brief  Read the (optional) training output format, csv or binary, from the xml of an algorithm or tool
+     *
+     *  @param  xmlHandle the xml handle
+     *  @param  format to receive the training output format
+     *
+     *  @return status code
+     */
+    static pandora::StatusCode ReadTrainingOutputFormat(const pandora::TiXmlHandle xmlHandle, TrainingOutputFormat &format);
 
     /**
      *  @brief  Use the trained classifier to predict the boolean class of an example
@@ -247,6 +291,152 @@ public:
     static MvaFeatureVector ConcatenateFeatureLists();
 
 private:
+    /**
+     *  @brief  TrainingExampleWriter class, which keeps a training output file open for the rest of the job and buffers the examples
+     *          written to it. In binary format, each file holds one or more segments (one per job), each comprising a header, then
+     *          blocks of examples. All values are written in native byte order:
+     *          header: the tag "LMVH", uint32 version, timestamp string, uint32 number of features, then the feature name strings (empty
+     *          if the examples were produced from a feature vector), where each string is a uint32 length followed by its characters;
+     *          block: the tag "LMVB", uint32 number of examples n, then, for each feature in turn, n doubles, then n uint8 results.
+     */
+    class TrainingExampleWriter
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  fileName the name of the file to which to append the examples
+         *  @param  format the format of the output file
+         */
+        TrainingExampleWriter(const std::string &fileName, const TrainingOutputFormat format);
+
+        /**
+         *  @brief  Destructor, writing any buffered examples
+         */
+        ~TrainingExampleWriter();
+
+        /**
+         *  @brief  Deleted copy constructor
+         */
+        TrainingExampleWriter(const TrainingExampleWriter &) = delete;
+
+        /**
+         *  @brief  Deleted assignment operator
+         */
+        TrainingExampleWriter &operator=(const TrainingExampleWriter &) = delete;
+
+        /**
+         *  @brief  Whether the output file was successfully opened
+         *
+         *  @return boolean
+         */
+        bool IsOpen() const;
+
+        /**
+         *  @brief  Get the format of the output file
+         *
+         *  @return the format
+         */
+        TrainingOutputFormat GetFormat() const;
+
+        /**
+         *  @brief  Write a training example
+         *
+         *  @param  result the result (true or false class) of the example
+         *  @param  featureNames the names of the features, empty if not known
+         *  @param  featureVector the features
+         *
+         *  @return success
+         */
+        pandora::StatusCode Write(const bool result, const pandora::StringVector &featureNames, const MvaFeatureVector &featureVector);
+
+        /**
+         *  @brief  Write any buffered examples to the output file
+         */
+        void Flush();
+
+    private:
+        /**
+         *  @brief  Buffer a training example, to be written in the next block of a binary file
+         *
+         *  @param  result the result of the example
+         *  @param  featureNames the names of the features, empty if not known
+         *  @param  featureVector the features
+         *
+         *  @return success
+         */
+        pandora::StatusCode BufferBinaryExample(
+            const bool result, const pandora::StringVector &featureNames, const MvaFeatureVector &featureVector);
+
+        /**
+         *  @brief  Write the header of a binary file segment
+         */
+        void WriteBinaryHeader();
+
+        /**
+         *  @brief  Write the buffered examples as a block of a binary file
+         */
+        void WriteBinaryBlock();
+
+        /**
+         *  @brief  Write an unsigned integer to a binary file
+         *
+         *  @param  value the value
+         */
+        void WriteBinaryValue(const std::uint32_t value);
+
+        /**
+         *  @brief  Write a string, preceded by its length, to a binary file
+         *
+         *  @param  value the string
+         */
+        void WriteBinaryString(const std::string &value);
+
+        typedef std::vector<std::vector<double>> ColumnVector;
+
+        const std::string m_fileName;         ///< The name of the output file
+        const TrainingOutputFormat m_format;  ///< The format of the output file
+        std::vector<char> m_buffer;           ///< The stream buffer for the output file
+        std::ofstream m_outfile;              ///< The output file
+        bool m_isHeaderWritten;               ///< Whether the binary header has been written
+        pandora::StringVector m_featureNames; ///< The feature names, fixed by the first example written to a binary file
+        ColumnVector m_columns;               ///< The buffered feature values of a binary file, stored column by column
+        std::vector<std::uint8_t> m_results;  ///< The buffered results of a binary file
+    };
+
+    typedef std::map<std::string, std::unique_ptr<TrainingExampleWriter>> TrainingExampleWriterMap;
+
+    /**
+     *  @brief  TrainingExampleWriterRegistry class, the job-wide record of training example writers
+     */
+    class TrainingExampleWriterRegistry
+    {
+    public:
+        std::mutex m_mutex;                   ///< The mutex protecting the writers
+        TrainingExampleWriterMap m_writerMap; ///< The writers, keyed by output file name
+    };
+
+    /**
+     *  @brief  Get the job-wide record of training example writers
+     *
+     *  @return the training example writer registry
+     */
+    static TrainingExampleWriterRegistry &GetTrainingExampleWriterRegistry();
+
+    /**
+     *  @brief  Write a training example, using the writer for the output file (created on first use)
+     *
+     *  @param  trainingOutputFile the file to which to append the example
+     *  @param  format the format of the output file
+     *  @param  result the result of the example
+     *  @param  featureNames the names of the features, empty if not known
+     *  @param  featureVector the features
+     *
+     *  @return success
+     */
+    static pandora::StatusCode WriteTrainingExample(const std::string &trainingOutputFile, const TrainingOutputFormat format,
+        const bool result, const pandora::StringVector &featureNames, const MvaFeatureVector &featureVector);
+
     /**
      *  @brief  Get a timestamp string for this point in time
      *
@@ -257,56 +447,45 @@ private:
     /**
      *  @brief  Write the features of the given lists to file
      *
-     *  @param  outfile the std::ofstream object to use
+     *  @param  outfile the output stream to use
      *  @param  delimiter the delimiter string
      *  @param  featureContainer a container of features to write
      *
      *  @return success
      */
     template <typename TCONTAINER>
-    static pandora::StatusCode WriteFeaturesToFile(std::ofstream &outfile, const std::string &delimiter, TCONTAINER &&featureContainer);
+    static pandora::StatusCode WriteFeaturesToFile(std::ostream &outfile, const std::string &delimiter, TCONTAINER &&featureContainer);
 
     /**
      *  @brief  Write the features of the given list to file (implementation method)
      *
-     *  @param  outfile the std::ofstream object to use
+     *  @param  outfile the output stream to use
      *  @param  delimiter the delimiter string
      *  @param  featureContainer a container of features to write
      *
      *  @return success
      */
     template <typename TCONTAINER>
-    static pandora::StatusCode WriteFeaturesToFileImpl(std::ofstream &outfile, const std::string &delimiter, TCONTAINER &&featureContainer);
+    static pandora::StatusCode WriteFeaturesToFileImpl(std::ostream &outfile, const std::string &delimiter, TCONTAINER &&featureContainer);
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename TCONTAINER>
-pandora::StatusCode LArMvaHelper::ProduceTrainingExample(const std::string &trainingOutputFile, const bool result, TCONTAINER &&featureContainer)
+pandora::StatusCode LArMvaHelper::ProduceTrainingExample(
+    const std::string &trainingOutputFile, const bool result, TCONTAINER &&featureContainer, const TrainingOutputFormat format)
 {
-    std::ofstream outfile;
-    outfile.open(trainingOutputFile, std::ios_base::app); // always append to the output file
-
-    if (!outfile.is_open())
-    {
-        std::cout << "LArMvaHelper: could not open file for training examples at " << trainingOutputFile << std::endl;
-        return pandora::STATUS_CODE_FAILURE;
-    }
-
-    std::string delimiter(",");
-    outfile << GetTimestampString() << delimiter;
-
-    PANDORA_RETURN_RESULT_IF(pandora::STATUS_CODE_SUCCESS, !=, WriteFeaturesToFile(outfile, delimiter, featureContainer));
-    outfile << static_cast<int>(result) << '\n';
+    static_assert(std::is_same<typename std::decay<TCONTAINER>::type, LArMvaHelper::MvaFeatureVector>::value,
+        "LArMvaHelper: Could not write training set example because a passed parameter was not a vector of MvaFeatures");
 
-    return pandora::STATUS_CODE_SUCCESS;
+    return WriteTrainingExample(trainingOutputFile, format, result, pandora::StringVector(), featureContainer);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename TCONTAINER>
-pandora::StatusCode LArMvaHelper::ProduceTrainingExample(
-    const std::string &trainingOutputFile, const bool result, const pandora::StringVector &featureOrder, TCONTAINER &&featureContainer)
+pandora::StatusCode LArMvaHelper::ProduceTrainingExample(const std::string &trainingOutputFile, const bool result,
+    const pandora::StringVector &featureOrder, TCONTAINER &&featureContainer, const TrainingOutputFormat format)
 {
     // Make a feature vector from the map and calculate the features
     LArMvaHelper::MvaFeatureVector featureVector;
@@ -322,7 +501,7 @@ pandora::StatusCode LArMvaHelper::ProduceTrainingExample(
         featureVector.push_back(featureContainer.at(pFeatureToolName));
     }
 
-    return ProduceTrainingExample(trainingOutputFile, result, featureVector);
+    return WriteTrainingExample(trainingOutputFile, format, result, featureOrder, featureVector);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -401,7 +580,10 @@ LArMvaHelper::MvaFeatureVector LArMvaHelper::CalculateFeatures(const MvaFeatureT
     LArMvaHelper::MvaFeatureVector featureVector;
 
     for (MvaFeatureTool<Ts...> *const pFeatureTool : featureToolVector)
+    {
+        const LArProfilingHelper::ScopedTimer timer(pFeatureTool);
         pFeatureTool->Run(featureVector, std::forward<TARGS>(args)...);
+    }
 
     return featureVector;
 }
@@ -422,7 +604,10 @@ LArMvaHelper::MvaFeatureMap LArMvaHelper::CalculateFeatures(const pandora::Strin
                       << "- Error: feature tool " << pFeatureToolName << " not found." << std::endl;
             throw pandora::StatusCodeException(pandora::STATUS_CODE_NOT_FOUND);
         }
-        featureToolMap.at(pFeatureToolName)->Run(featureMap, featureOrder, pFeatureToolName, std::forward<TARGS>(args)...);
+
+        MvaFeatureTool<Ts...> *const pFeatureTool(featureToolMap.at(pFeatureToolName));
+        const LArProfilingHelper::ScopedTimer timer(pFeatureTool);
+        pFeatureTool->Run(featureMap, featureOrder, pFeatureToolName, std::forward<TARGS>(args)...);
     }
 
     return featureMap;
@@ -439,7 +624,10 @@ LArMvaHelper::MvaFeatureVector LArMvaHelper::CalculateFeaturesOfType(const MvaFe
     for (MvaFeatureTool<Ts...> *const pFeatureTool : featureToolVector)
     {
         if (TD *const pCastFeatureTool = dynamic_cast<TD *const>(pFeatureTool))
+        {
+            const LArProfilingHelper::ScopedTimer timer(pFeatureTool);
             pCastFeatureTool->Run(featureVector, std::forward<TARGS>(args)...);
+        }
     }
 
     return featureVector;
@@ -497,7 +685,7 @@ inline std::string LArMvaHelper::GetTimestampString()
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename TCONTAINER>
-inline pandora::StatusCode LArMvaHelper::WriteFeaturesToFile(std::ofstream &outfile, const std::string &delimiter, TCONTAINER &&featureContainer)
+inline pandora::StatusCode LArMvaHelper::WriteFeaturesToFile(std::ostream &outfile, const std::string &delimiter, TCONTAINER &&featureContainer)
 {
     static_assert(std::is_same<typename std::decay<TCONTAINER>::type, LArMvaHelper::MvaFeatureVector>::value,
         "LArMvaHelper: Could not write training set example because a passed parameter was not a vector of MvaFeatures");
@@ -509,7 +697,7 @@ inline pandora::StatusCode LArMvaHelper::WriteFeaturesToFile(std::ofstream &outf
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename TCONTAINER>
-pandora::StatusCode LArMvaHelper::WriteFeaturesToFileImpl(std::ofstream &outfile, const std::string &delimiter, TCONTAINER &&featureContainer)
+pandora::StatusCode LArMvaHelper::WriteFeaturesToFileImpl(std::ostream &outfile, const std::string &delimiter, TCONTAINER &&featureContainer)
 {
     for (const MvaFeature &feature : featureContainer)
         outfile << feature.Get() << delimiter;
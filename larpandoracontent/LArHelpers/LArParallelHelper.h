@@ -0,0 +1,90 @@
+/**
+ *  @file   larpandoracontent/LArHelpers/LArParallelHelper.h
+ *
+ *  @brief  Header file for the parallel helper class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_PARALLEL_HELPER_H
+#define LAR_PARALLEL_HELPER_H 1
+
+#include <algorithm>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  LArParallelHelper class
+ */
+class LArParallelHelper
+{
+public:
+    /**
+     *  @brief  Apply a function to every index in [0, nElements), splitting the range into contiguous blocks across a number of threads.
+     *          The calling thread processes the first block. Any exception is rethrown on the calling thread, after all threads have
+     *          joined, choosing the exception from the lowest block so that behaviour does not depend on scheduling.
+     *
+     *  @param  nElements the number of elements
+     *  @param  maxThreads the maximum number of threads to use, including the calling thread (values of 0 or 1 run serially)
+     *  @param  function the function to apply, which must be safe to call concurrently for different indices
+     */
+    template <typename TFUNCTION>
+    static void ForEachIndex(const std::size_t nElements, const unsigned int maxThreads, const TFUNCTION &function);
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename TFUNCTION>
+void LArParallelHelper::ForEachIndex(const std::size_t nElements, const unsigned int maxThreads, const TFUNCTION &function)
+{
+    const std::size_t nBlocks(std::min(static_cast<std::size_t>(std::max(maxThreads, 1u)), nElements));
+
+    if (nBlocks <= 1)
+    {
+        for (std::size_t index = 0; index < nElements; ++index)
+            function(index);
+
+        return;
+    }
+
+    const std::size_t blockSize((nElements + nBlocks - 1) / nBlocks);
+    std::vector<std::exception_ptr> exceptions(nBlocks);
+
+    auto processBlock = [&](const std::size_t iBlock) {
+        try
+        {
+            const std::size_t end(std::min(nElements, (iBlock + 1) * blockSize));
+
+            for (std::size_t index = iBlock * blockSize; index < end; ++index)
+                function(index);
+        }
+        catch (...)
+        {
+            exceptions.at(iBlock) = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(nBlocks - 1);
+
+    for (std::size_t iBlock = 1; iBlock < nBlocks; ++iBlock)
+        threads.emplace_back(processBlock, iBlock);
+
+    processBlock(0);
+
+    for (std::thread &thread : threads)
+        thread.join();
+
+    for (const std::exception_ptr &pException : exceptions)
+    {
+        if (pException)
+            std::rethrow_exception(pException);
+    }
+}
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_PARALLEL_HELPER_H
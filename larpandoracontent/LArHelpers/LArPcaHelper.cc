@@ -20,50 +20,38 @@ namespace lar_content
 template <typename T>
 void LArPcaHelper::RunPca(const T &t, CartesianVector &centroid, EigenValues &outputEigenValues, EigenVectors &outputEigenVectors)
 {
-    WeightedPointVector weightedPointVector;
+    MomentAccumulator momentAccumulator;
+    momentAccumulator.AddPoints(t);
 
-    for (const auto &point : t)
-        weightedPointVector.push_back(std::make_pair(LArObjectHelper::TypeAdaptor::GetPosition(point), 1.));
-
-    return LArPcaHelper::RunPca(weightedPointVector, centroid, outputEigenValues, outputEigenVectors);
+    return LArPcaHelper::RunPca(momentAccumulator, centroid, outputEigenValues, outputEigenVectors);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void LArPcaHelper::RunPca(const WeightedPointVector &pointVector, CartesianVector &centroid, EigenValues &outputEigenValues, EigenVectors &outputEigenVectors)
 {
-    // The steps are:
-    // 1) do a mean normalization of the input vec points
-    // 2) compute the covariance matrix
-    // 3) run the SVD
-    // 4) extract the eigen vectors and values
+    MomentAccumulator momentAccumulator;
+    momentAccumulator.AddPoints(pointVector);
+
+    return LArPcaHelper::RunPca(momentAccumulator, centroid, outputEigenValues, outputEigenVectors);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
 
-    // Run through the point vector and get the mean position of all points
-    if (pointVector.empty())
+void LArPcaHelper::RunPca(const MomentAccumulator &momentAccumulator, CartesianVector &centroid, EigenValues &outputEigenValues,
+    EigenVectors &outputEigenVectors)
+{
+    // The steps are:
+    // 1) take the mean position and covariance matrix of the input points, accumulated in a single pass
+    // 2) run the SVD
+    // 3) extract the eigen vectors and values
+    if (0 == momentAccumulator.GetNPoints())
     {
         std::cout << "LArPcaHelper::RunPca - no three dimensional hits provided" << std::endl;
         throw StatusCodeException(STATUS_CODE_NOT_FOUND);
     }
 
-    double meanPosition[3] = {0., 0., 0.};
-    double sumWeight(0.);
-
-    for (const WeightedPoint &weightedPoint : pointVector)
-    {
-        const CartesianVector &point(weightedPoint.first);
-        const double weight(weightedPoint.second);
-
-        if (weight < 0.)
-        {
-            std::cout << "LArPcaHelper::RunPca - negative weight found" << std::endl;
-            throw StatusCodeException(STATUS_CODE_NOT_ALLOWED);
-        }
-
-        meanPosition[0] += static_cast<double>(point.GetX()) * weight;
-        meanPosition[1] += static_cast<double>(point.GetY()) * weight;
-        meanPosition[2] += static_cast<double>(point.GetZ()) * weight;
-        sumWeight += weight;
-    }
+    const double sumWeight(momentAccumulator.GetSumWeight());
 
     if (std::fabs(sumWeight) < std::numeric_limits<double>::epsilon())
     {
@@ -71,34 +59,15 @@ void LArPcaHelper::RunPca(const WeightedPointVector &pointVector, CartesianVecto
         throw StatusCodeException(STATUS_CODE_NOT_FOUND);
     }
 
-    meanPosition[0] /= sumWeight;
-    meanPosition[1] /= sumWeight;
-    meanPosition[2] /= sumWeight;
-    centroid = CartesianVector(meanPosition[0], meanPosition[1], meanPosition[2]);
+    centroid = momentAccumulator.GetCentroid();
 
     // Define elements of our covariance matrix
-    double xi2(0.);
-    double xiyi(0.);
-    double xizi(0.);
-    double yi2(0.);
-    double yizi(0.);
-    double zi2(0.);
-
-    for (const WeightedPoint &weightedPoint : pointVector)
-    {
-        const CartesianVector &point(weightedPoint.first);
-        const double weight(weightedPoint.second);
-        const double x(static_cast<double>((point.GetX()) - meanPosition[0]));
-        const double y(static_cast<double>((point.GetY()) - meanPosition[1]));
-        const double z(static_cast<double>((point.GetZ()) - meanPosition[2]));
-
-        xi2 += x * x * weight;
-        xiyi += x * y * weight;
-        xizi += x * z * weight;
-        yi2 += y * y * weight;
-        yizi += y * z * weight;
-        zi2 += z * z * weight;
-    }
+    const double xi2(momentAccumulator.m_coMoments[0]);
+    const double xiyi(momentAccumulator.m_coMoments[1]);
+    const double xizi(momentAccumulator.m_coMoments[2]);
+    const double yi2(momentAccumulator.m_coMoments[3]);
+    const double yizi(momentAccumulator.m_coMoments[4]);
+    const double zi2(momentAccumulator.m_coMoments[5]);
 
     // Using Eigen package
     Eigen::Matrix3f sig;
@@ -111,7 +80,7 @@ void LArPcaHelper::RunPca(const WeightedPointVector &pointVector, CartesianVecto
 
     if (eigenMat.info() != Eigen::ComputationInfo::Success)
     {
-        std::cout << "LArPcaHelper::RunPca - decomposition failure, nThreeDHits = " << pointVector.size() << std::endl;
+        std::cout << "LArPcaHelper::RunPca - decomposition failure, nThreeDHits = " << momentAccumulator.GetNPoints() << std::endl;
         throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
     }
 
@@ -137,8 +106,116 @@ void LArPcaHelper::RunPca(const WeightedPointVector &pointVector, CartesianVecto
         outputEigenVectors.emplace_back(eigenVecs(0, pair.second), eigenVecs(1, pair.second), eigenVecs(2, pair.second));
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArPcaHelper::MomentAccumulator::MomentAccumulator() :
+    m_nPoints(0),
+    m_sumWeight(0.),
+    m_mean{0., 0., 0.},
+    m_coMoments{0., 0., 0., 0., 0., 0.}
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArPcaHelper::MomentAccumulator::AddPoint(const CartesianVector &point, const double weight)
+{
+    if (weight < 0.)
+    {
+        std::cout << "LArPcaHelper::MomentAccumulator::AddPoint - negative weight found" << std::endl;
+        throw StatusCodeException(STATUS_CODE_NOT_ALLOWED);
+    }
+
+    ++m_nPoints;
+
+    // ATTN Points with zero weight are counted, but leave the moments unchanged
+    if (weight <= 0.)
+        return;
+
+    // Weighted incremental update of the mean and co-moments (West, 1979); the co-moment update uses the deviation from the old mean
+    const double newSumWeight(m_sumWeight + weight);
+    const double deltaX(static_cast<double>(point.GetX()) - m_mean[0]);
+    const double deltaY(static_cast<double>(point.GetY()) - m_mean[1]);
+    const double deltaZ(static_cast<double>(point.GetZ()) - m_mean[2]);
+    const double meanFraction(weight / newSumWeight);
+    const double coMomentScale(weight * m_sumWeight / newSumWeight);
+
+    m_mean[0] += deltaX * meanFraction;
+    m_mean[1] += deltaY * meanFraction;
+    m_mean[2] += deltaZ * meanFraction;
+
+    m_coMoments[0] += deltaX * deltaX * coMomentScale;
+    m_coMoments[1] += deltaX * deltaY * coMomentScale;
+    m_coMoments[2] += deltaX * deltaZ * coMomentScale;
+    m_coMoments[3] += deltaY * deltaY * coMomentScale;
+    m_coMoments[4] += deltaY * deltaZ * coMomentScale;
+    m_coMoments[5] += deltaZ * deltaZ * coMomentScale;
+    m_sumWeight = newSumWeight;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void LArPcaHelper::MomentAccumulator::AddPoints(const T &t)
+{
+    for (const auto &point : t)
+        this->AddPoint(LArObjectHelper::TypeAdaptor::GetPosition(point));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArPcaHelper::MomentAccumulator::AddPoints(const WeightedPointVector &pointVector)
+{
+    for (const WeightedPoint &weightedPoint : pointVector)
+        this->AddPoint(weightedPoint.first, weightedPoint.second);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArPcaHelper::MomentAccumulator::Merge(const MomentAccumulator &other)
+{
+    const unsigned int nPoints(m_nPoints + other.m_nPoints);
+
+    if (other.m_sumWeight <= 0.)
+    {
+        m_nPoints = nPoints;
+        return;
+    }
+
+    if (m_sumWeight <= 0.)
+    {
+        *this = other;
+        m_nPoints = nPoints;
+        return;
+    }
+
+    // Pairwise combination of the means and co-moments (Chan, Golub and LeVeque, 1979)
+    const double newSumWeight(m_sumWeight + other.m_sumWeight);
+    const double deltaX(other.m_mean[0] - m_mean[0]);
+    const double deltaY(other.m_mean[1] - m_mean[1]);
+    const double deltaZ(other.m_mean[2] - m_mean[2]);
+    const double meanFraction(other.m_sumWeight / newSumWeight);
+    const double coMomentScale(m_sumWeight * other.m_sumWeight / newSumWeight);
+
+    m_mean[0] += deltaX * meanFraction;
+    m_mean[1] += deltaY * meanFraction;
+    m_mean[2] += deltaZ * meanFraction;
+
+    m_coMoments[0] += other.m_coMoments[0] + deltaX * deltaX * coMomentScale;
+    m_coMoments[1] += other.m_coMoments[1] + deltaX * deltaY * coMomentScale;
+    m_coMoments[2] += other.m_coMoments[2] + deltaX * deltaZ * coMomentScale;
+    m_coMoments[3] += other.m_coMoments[3] + deltaY * deltaY * coMomentScale;
+    m_coMoments[4] += other.m_coMoments[4] + deltaY * deltaZ * coMomentScale;
+    m_coMoments[5] += other.m_coMoments[5] + deltaZ * deltaZ * coMomentScale;
+    m_sumWeight = newSumWeight;
+    m_nPoints = nPoints;
+}
+
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template void LArPcaHelper::MomentAccumulator::AddPoints(const CartesianPointVector &);
+template void LArPcaHelper::MomentAccumulator::AddPoints(const CaloHitList &);
 template void LArPcaHelper::RunPca(const CartesianPointVector &, CartesianVector &, EigenValues &, EigenVectors &);
 template void LArPcaHelper::RunPca(const CaloHitList &, CartesianVector &, EigenValues &, EigenVectors &);
 
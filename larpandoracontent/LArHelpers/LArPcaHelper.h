@@ -26,6 +26,78 @@ public:
     typedef std::pair<const pandora::CartesianVector, double> WeightedPoint;
     typedef std::vector<WeightedPoint> WeightedPointVector;
 
+    /**
+     *  @brief  MomentAccumulator class, a single pass, numerically stable accumulation of the weighted first and second moments of a set
+     *          of points. Accumulators for disjoint sets of points can be merged, to give the moments of the union of the sets.
+     */
+    class MomentAccumulator
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        MomentAccumulator();
+
+        /**
+         *  @brief  Add a weighted point to the accumulator
+         *
+         *  @param  point the position of the point
+         *  @param  weight the (non-negative) weight of the point
+         */
+        void AddPoint(const pandora::CartesianVector &point, const double weight = 1.);
+
+        /**
+         *  @brief  Add a set of points, each with unit weight, to the accumulator, reading their positions in place
+         *
+         *  @param  t the input information (calo hits or positions)
+         */
+        template <typename T>
+        void AddPoints(const T &t);
+
+        /**
+         *  @brief  Add a vector of weighted points to the accumulator
+         *
+         *  @param  pointVector a vector of pairs of positions and weights
+         */
+        void AddPoints(const WeightedPointVector &pointVector);
+
+        /**
+         *  @brief  Merge another accumulator, for a disjoint set of points, into this accumulator
+         *
+         *  @param  other the other accumulator
+         */
+        void Merge(const MomentAccumulator &other);
+
+        /**
+         *  @brief  Get the number of points added to the accumulator
+         *
+         *  @return the number of points
+         */
+        unsigned int GetNPoints() const;
+
+        /**
+         *  @brief  Get the sum of the weights of the points added to the accumulator
+         *
+         *  @return the sum of weights
+         */
+        double GetSumWeight() const;
+
+        /**
+         *  @brief  Get the weighted mean position of the points added to the accumulator
+         *
+         *  @return the weighted mean position
+         */
+        pandora::CartesianVector GetCentroid() const;
+
+    private:
+        unsigned int m_nPoints; ///< The number of points
+        double m_sumWeight;     ///< The sum of weights
+        double m_mean[3];       ///< The weighted mean x, y and z coordinates
+        double m_coMoments[6];  ///< The weighted sums of products of deviations from the mean: xx, xy, xz, yy, yz, zz
+
+        friend class LArPcaHelper;
+    };
+
     /**
      *  @brief  Run principal component analysis using input calo hits (TPC_VIEW_U,V,W or TPC_3D; all treated as 3D points)
      *
@@ -47,8 +119,41 @@ public:
      */
     static void RunPca(const WeightedPointVector &pointVector, pandora::CartesianVector &centroid, EigenValues &outputEigenValues,
         EigenVectors &outputEigenVectors);
+
+    /**
+     *  @brief  Run principal component analysis using the moments held by an accumulator
+     *
+     *  @param  momentAccumulator the moment accumulator
+     *  @param  centroid to receive the centroid position
+     *  @param  outputEigenValues to receive the eigen values
+     *  @param  outputEigenVectors to receive the eigen vectors
+     */
+    static void RunPca(const MomentAccumulator &momentAccumulator, pandora::CartesianVector &centroid, EigenValues &outputEigenValues,
+        EigenVectors &outputEigenVectors);
 };
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline unsigned int LArPcaHelper::MomentAccumulator::GetNPoints() const
+{
+    return m_nPoints;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline double LArPcaHelper::MomentAccumulator::GetSumWeight() const
+{
+    return m_sumWeight;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline pandora::CartesianVector LArPcaHelper::MomentAccumulator::GetCentroid() const
+{
+    return pandora::CartesianVector(m_mean[0], m_mean[1], m_mean[2]);
+}
+
 } // namespace lar_content
 
 #endif // #ifndef LAR_PCA_HELPER_H
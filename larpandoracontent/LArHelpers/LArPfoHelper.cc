@@ -29,8 +29,18 @@ void LArPfoHelper::GetCoordinateVector(const ParticleFlowObject *const pPfo, con
     ClusterList clusterList;
     LArPfoHelper::GetClusters(pPfo, hitType, clusterList);
 
+    if (coordinateVector.empty() && (1 == clusterList.size()))
+    {
+        LArClusterHelper::GetCoordinateVector(clusterList.front(), coordinateVector);
+        return;
+    }
+
+    // ATTN Append the coordinates of all clusters, then sort once, rather than sorting the growing vector after each cluster
     for (const Cluster *const pCluster : clusterList)
-        LArClusterHelper::GetCoordinateVector(pCluster, coordinateVector);
+        LArClusterHelper::GetCoordinateVector(pCluster, coordinateVector, false);
+
+    if (!clusterList.empty())
+        std::sort(coordinateVector.begin(), coordinateVector.end(), LArClusterHelper::SortCoordinatesByPosition);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -14,6 +14,55 @@ using namespace pandora;
 namespace lar_content
 {
 
+const LArPointingCluster &LArPointingClusterHelper::GetPointingCluster(
+    const Cluster *const pCluster, const unsigned int fitHalfLayerWindow, const float fitLayerPitch)
+{
+    // ATTN Generations are large enough that callers holding a few pointing cluster references never see them discarded
+    const size_t maxGenerationSize(10000);
+
+    PointingClusterCache &pointingClusterCache(LArPointingClusterHelper::GetPointingClusterCache());
+    PointingClusterMap &currentPointingClusters(pointingClusterCache.m_currentPointingClusters);
+    const PointingClusterKey pointingClusterKey(pCluster, fitHalfLayerWindow, fitLayerPitch);
+    PointingClusterMap::iterator iter(currentPointingClusters.find(pointingClusterKey));
+
+    if (currentPointingClusters.end() != iter)
+    {
+        // ATTN Staleness, including reuse of a deleted cluster address, is detected only as far as the ClusterVersion fingerprint allows
+        if (iter->second.m_clusterVersion.IsUpToDate(pCluster))
+            return iter->second.m_pointingCluster;
+
+        currentPointingClusters.erase(iter);
+    }
+
+    // Moving the full generation keeps its nodes, so references to its entries remain valid until the following generation is full
+    if (currentPointingClusters.size() >= maxGenerationSize)
+    {
+        pointingClusterCache.m_previousPointingClusters = std::move(currentPointingClusters);
+        currentPointingClusters.clear();
+    }
+
+    PointingClusterMap &previousPointingClusters(pointingClusterCache.m_previousPointingClusters);
+    const PointingClusterMap::const_iterator previousIter(previousPointingClusters.find(pointingClusterKey));
+
+    if ((previousPointingClusters.end() != previousIter) && previousIter->second.m_clusterVersion.IsUpToDate(pCluster))
+        return currentPointingClusters.emplace(pointingClusterKey, previousIter->second).first->second.m_pointingCluster;
+
+    // ATTN The pointing cluster is built before insertion, so a failed sliding fit leaves no entry behind
+    const CachedPointingCluster cachedPointingCluster(pCluster, fitHalfLayerWindow, fitLayerPitch);
+    return currentPointingClusters.emplace(pointingClusterKey, cachedPointingCluster).first->second.m_pointingCluster;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArPointingClusterHelper::ResetPointingClusterCache()
+{
+    PointingClusterCache &pointingClusterCache(LArPointingClusterHelper::GetPointingClusterCache());
+    pointingClusterCache.m_currentPointingClusters.clear();
+    pointingClusterCache.m_previousPointingClusters.clear();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 float LArPointingClusterHelper::GetLengthSquared(const LArPointingCluster &pointingCluster)
 {
     const LArPointingCluster::Vertex &innerVertex(pointingCluster.GetInnerVertex());
@@ -406,4 +455,22 @@ float LArPointingClusterHelper::GetAssociatedEnergy(const LArPointingCluster::Ve
     return associatedEnergy;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArPointingClusterHelper::PointingClusterCache &LArPointingClusterHelper::GetPointingClusterCache()
+{
+    static thread_local PointingClusterCache pointingClusterCache;
+    return pointingClusterCache;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArPointingClusterHelper::CachedPointingCluster::CachedPointingCluster(
+    const Cluster *const pCluster, const unsigned int fitHalfLayerWindow, const float fitLayerPitch) :
+    m_clusterVersion(pCluster),
+    m_pointingCluster(pCluster, fitHalfLayerWindow, fitLayerPitch)
+{
+}
+
 } // namespace lar_content
@@ -10,8 +10,13 @@
 
 #include "Objects/Cluster.h"
 
+#include "larpandoracontent/LArHelpers/LArClusterHelper.h"
+
 #include "larpandoracontent/LArObjects/LArPointingCluster.h"
 
+#include <map>
+#include <tuple>
+
 namespace lar_content
 {
 
@@ -21,6 +26,29 @@ namespace lar_content
 class LArPointingClusterHelper
 {
 public:
+    /**
+     *  @brief  Get the cached pointing cluster of a cluster (two or three dimensional) for a given sliding fit window, building it on
+     *          first use and rebuilding it if the cluster version has changed since it was built (see the ClusterVersion limitations).
+     *          The cache is owned by the calling thread and holds at most two generations of pointing clusters, the older discarded as a
+     *          new generation fills, so its size is bounded even if it is never reset. The returned reference remains valid until the
+     *          cluster is modified, the cache is reset, or a further generation has been built. Failed sliding fits raise an exception
+     *          for every caller, and are not cached.
+     *
+     *  @param  pCluster address of the cluster
+     *  @param  fitHalfLayerWindow the sliding fit half layer window
+     *  @param  fitLayerPitch the sliding fit layer pitch
+     *
+     *  @return the pointing cluster
+     */
+    static const LArPointingCluster &GetPointingCluster(
+        const pandora::Cluster *const pCluster, const unsigned int fitHalfLayerWindow = 10, const float fitLayerPitch = 0.3f);
+
+    /**
+     *  @brief  Reset the pointing cluster cache of the calling thread, to be called at event boundaries (or any other point at which no
+     *          pointing cluster references are held) to release the pointing clusters promptly
+     */
+    static void ResetPointingClusterCache();
+
     /**
      *  @brief  Calculate distance squared between inner and outer vertices of pointing cluster
      *
@@ -252,6 +280,45 @@ private:
         const float minLongitudinalDistance, const float maxLongitudinalDistance, const float maxTransverseDistance,
         const float angularAllowance, LArPointingClusterVertexList &outputList);
 
+    /**
+     *  @brief  CachedPointingCluster class, a pointing cluster and the version of the cluster hit content from which it was built
+     */
+    class CachedPointingCluster
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  pCluster address of the cluster
+         *  @param  fitHalfLayerWindow the sliding fit half layer window
+         *  @param  fitLayerPitch the sliding fit layer pitch
+         */
+        CachedPointingCluster(const pandora::Cluster *const pCluster, const unsigned int fitHalfLayerWindow, const float fitLayerPitch);
+
+        LArClusterHelper::ClusterVersion m_clusterVersion; ///< The version of the cluster hit content, when built
+        LArPointingCluster m_pointingCluster;              ///< The pointing cluster
+    };
+
+    typedef std::tuple<const pandora::Cluster *, unsigned int, float> PointingClusterKey; ///< (cluster, half layer window, layer pitch)
+    typedef std::map<PointingClusterKey, CachedPointingCluster> PointingClusterMap;
+
+    /**
+     *  @brief  PointingClusterCache class, holding the current generation of pointing clusters and the generation before it
+     */
+    class PointingClusterCache
+    {
+    public:
+        PointingClusterMap m_currentPointingClusters;  ///< The pointing clusters of the current generation
+        PointingClusterMap m_previousPointingClusters; ///< The pointing clusters of the previous generation
+    };
+
+    /**
+     *  @brief  Get the pointing cluster cache of the calling thread
+     *
+     *  @return the pointing cluster cache
+     */
+    static PointingClusterCache &GetPointingClusterCache();
+
     /**
      *  @brief  Get an estimate of the energy associated with a specified vertex
      *
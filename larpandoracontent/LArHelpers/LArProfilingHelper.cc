@@ -0,0 +1,373 @@
+/**
+ *  @file   larpandoracontent/LArHelpers/LArProfilingHelper.cc
+ *
+ *  @brief  Implementation of the profiling helper class.
+ *
+ *  $Log: $
+ */
+
+#include "Api/PandoraContentApi.h"
+
+#include "Helpers/XmlHelper.h"
+
+#include "Pandora/Pandora.h"
+
+#include "larpandoracontent/LArHelpers/LArProfilingHelper.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <new>
+
+#ifdef LAR_CONTENT_PROFILE_ALLOCATIONS
+static thread_local unsigned long s_larProfilingAllocationCount(0);
+
+// ATTN Replacing the global allocation functions affects the whole process, hence the need for an explicit build option
+void *operator new(std::size_t size)
+{
+    ++s_larProfilingAllocationCount;
+
+    if (void *const pMemory = std::malloc(size ? size : 1))
+        return pMemory;
+
+    throw std::bad_alloc();
+}
+
+void *operator new[](std::size_t size)
+{
+    return ::operator new(size);
+}
+
+void operator delete(void *pMemory) noexcept
+{
+    std::free(pMemory);
+}
+
+void operator delete[](void *pMemory) noexcept
+{
+    std::free(pMemory);
+}
+
+void operator delete(void *pMemory, std::size_t) noexcept
+{
+    std::free(pMemory);
+}
+
+void operator delete[](void *pMemory, std::size_t) noexcept
+{
+    std::free(pMemory);
+}
+#endif
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+LArProfilingHelper::Settings::Settings() :
+    m_writeEventSummaries(false),
+    m_useJsonFormat(false),
+    m_countAllocations(false)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArProfilingHelper::ScopedTimer::ScopedTimer(const AlgorithmTool *const pAlgorithmTool) :
+    m_isActive(false),
+    m_startAllocations(0)
+{
+    if (LArProfilingHelper::IsEnabled())
+        this->Start(*pAlgorithmTool, "AlgorithmTool", pAlgorithmTool->GetType());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArProfilingHelper::ScopedTimer::ScopedTimer(const Process &process, const std::string &category, const std::string &name) :
+    m_isActive(false),
+    m_startAllocations(0)
+{
+    if (LArProfilingHelper::IsEnabled())
+        this->Start(process, category, name);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArProfilingHelper::ScopedTimer::~ScopedTimer()
+{
+    if (!m_isActive)
+        return;
+
+    const std::chrono::duration<double> time(std::chrono::steady_clock::now() - m_startTime);
+    const unsigned long nAllocations(LArProfilingHelper::GetThreadAllocationCount() - m_startAllocations);
+
+    LArProfilingHelper::AddCall(RecordKey(m_instanceName, m_category, m_name), time.count(), nAllocations);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArProfilingHelper::ScopedTimer::Start(const Process &process, const std::string &category, const std::string &name)
+{
+    m_isActive = true;
+    m_instanceName = process.GetPandora().GetName();
+    m_category = category;
+    m_name = name;
+    m_startAllocations = LArProfilingHelper::GetThreadAllocationCount();
+    m_startTime = std::chrono::steady_clock::now();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArProfilingHelper::Record::Record() :
+    m_nCalls(0),
+    m_totalTime(0.),
+    m_maxTime(0.),
+    m_nAllocations(0)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArProfilingHelper::Record::AddCall(const double time, const unsigned long nAllocations)
+{
+    ++m_nCalls;
+    m_totalTime += time;
+    m_maxTime = std::max(m_maxTime, time);
+    m_nAllocations += nAllocations;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArProfilingHelper::Record::Merge(const Record &other)
+{
+    m_nCalls += other.m_nCalls;
+    m_totalTime += other.m_totalTime;
+    m_maxTime = std::max(m_maxTime, other.m_maxTime);
+    m_nAllocations += other.m_nAllocations;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArProfilingHelper::Profile::Profile() :
+    m_isEnabled(false),
+    m_pOwner(nullptr),
+    m_isEventBegun(false),
+    m_nEvents(0)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode LArProfilingHelper::ReadSettings(const TiXmlHandle xmlHandle, Settings &settings)
+{
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ReadValue(xmlHandle, "ProfilingOutputFileName", settings.m_outputFileName));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ReadValue(xmlHandle, "ProfilingEventSummaries", settings.m_writeEventSummaries));
+
+    std::string format(settings.m_useJsonFormat ? "json" : "csv");
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "ProfilingFormat", format));
+
+    if ((format != "csv") && (format != "json"))
+    {
+        std::cout << "LArProfilingHelper::ReadSettings - unknown ProfilingFormat " << format << ", expected csv or json" << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
+    settings.m_useJsonFormat = (format == "json");
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ReadValue(xmlHandle, "ProfilingCountAllocations", settings.m_countAllocations));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArProfilingHelper::Enable(const void *const pOwner, const Settings &settings)
+{
+    if (settings.m_outputFileName.empty())
+        return;
+
+    Profile &profile(LArProfilingHelper::GetProfile());
+    const std::lock_guard<std::mutex> lock(profile.m_mutex);
+
+    if (profile.m_pOwner)
+        return;
+
+#ifndef LAR_CONTENT_PROFILE_ALLOCATIONS
+    if (settings.m_countAllocations)
+        std::cout << "LArProfilingHelper::Enable - allocation counting requires a build with LAR_CONTENT_PROFILE_ALLOCATIONS" << std::endl;
+#endif
+
+    profile.m_pOwner = pOwner;
+    profile.m_settings = settings;
+    profile.m_isEnabled = true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool LArProfilingHelper::IsEnabled()
+{
+    return LArProfilingHelper::GetProfile().m_isEnabled;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode LArProfilingHelper::RunDaughterAlgorithm(const Algorithm &algorithm, const std::string &daughterAlgorithmName)
+{
+    if (!LArProfilingHelper::IsEnabled())
+        return PandoraContentApi::RunDaughterAlgorithm(algorithm, daughterAlgorithmName);
+
+    const ScopedTimer timer(algorithm, "DaughterAlgorithm", algorithm.GetType() + "/" + daughterAlgorithmName);
+
+    return PandoraContentApi::RunDaughterAlgorithm(algorithm, daughterAlgorithmName);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArProfilingHelper::BeginEvent(const void *const pOwner)
+{
+    Profile &profile(LArProfilingHelper::GetProfile());
+
+    if (!profile.m_isEnabled)
+        return;
+
+    const std::lock_guard<std::mutex> lock(profile.m_mutex);
+
+    if (pOwner != profile.m_pOwner)
+        return;
+
+    profile.m_isEventBegun = true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArProfilingHelper::EndEvent(const void *const pOwner)
+{
+    Profile &profile(LArProfilingHelper::GetProfile());
+
+    if (!profile.m_isEnabled)
+        return;
+
+    const std::lock_guard<std::mutex> lock(profile.m_mutex);
+
+    if ((pOwner != profile.m_pOwner) || !profile.m_isEventBegun)
+        return;
+
+    profile.m_isEventBegun = false;
+
+    const Settings &settings(profile.m_settings);
+    const std::string extension(settings.m_useJsonFormat ? ".json" : ".csv");
+
+    if (settings.m_writeEventSummaries)
+    {
+        std::ofstream eventStream(
+            settings.m_outputFileName + "_events" + extension, (0 == profile.m_nEvents) ? std::ios_base::trunc : std::ios_base::app);
+
+        if (settings.m_useJsonFormat)
+        {
+            LArProfilingHelper::WriteJson(profile.m_eventRecords, profile.m_nEvents, 1, eventStream);
+        }
+        else
+        {
+            if (0 == profile.m_nEvents)
+                eventStream << "event,instance,category,name,calls,totalTime,maxTime,allocations" << std::endl;
+
+            LArProfilingHelper::WriteCsv(profile.m_eventRecords, profile.m_nEvents, eventStream);
+        }
+    }
+
+    for (const RecordMap::value_type &mapEntry : profile.m_eventRecords)
+        profile.m_jobRecords[mapEntry.first].Merge(mapEntry.second);
+
+    profile.m_eventRecords.clear();
+    ++profile.m_nEvents;
+
+    // ATTN Rewrite the cumulative job summary at every event boundary, so that it is complete however the job ends
+    std::ofstream jobStream(settings.m_outputFileName + "_job" + extension, std::ios_base::trunc);
+
+    if (settings.m_useJsonFormat)
+    {
+        LArProfilingHelper::WriteJson(profile.m_jobRecords, -1, profile.m_nEvents, jobStream);
+    }
+    else
+    {
+        jobStream << "event,instance,category,name,calls,totalTime,maxTime,allocations" << std::endl;
+        LArProfilingHelper::WriteCsv(profile.m_jobRecords, -1, jobStream);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+unsigned long LArProfilingHelper::GetThreadAllocationCount()
+{
+#ifdef LAR_CONTENT_PROFILE_ALLOCATIONS
+    return s_larProfilingAllocationCount;
+#else
+    return 0;
+#endif
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArProfilingHelper::Profile &LArProfilingHelper::GetProfile()
+{
+    static Profile profile;
+    return profile;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArProfilingHelper::AddCall(const RecordKey &recordKey, const double time, const unsigned long nAllocations)
+{
+    Profile &profile(LArProfilingHelper::GetProfile());
+    const std::lock_guard<std::mutex> lock(profile.m_mutex);
+
+    profile.m_eventRecords[recordKey].AddCall(time, profile.m_settings.m_countAllocations ? nAllocations : 0);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArProfilingHelper::WriteCsv(const RecordMap &recordMap, const int eventNumber, std::ostream &stream)
+{
+    for (const RecordMap::value_type &mapEntry : recordMap)
+    {
+        const Record &record(mapEntry.second);
+
+        stream << eventNumber << "," << std::get<0>(mapEntry.first) << "," << std::get<1>(mapEntry.first) << ","
+               << std::get<2>(mapEntry.first) << "," << record.m_nCalls << "," << record.m_totalTime << "," << record.m_maxTime << ","
+               << record.m_nAllocations << std::endl;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArProfilingHelper::WriteJson(const RecordMap &recordMap, const int eventNumber, const unsigned int nEvents, std::ostream &stream)
+{
+    // ATTN Instance, category and tool/algorithm names are plain identifiers, so are written without escaping
+    stream << "{\"event\": " << eventNumber << ", \"nEvents\": " << nEvents << ", \"records\": [";
+
+    bool isFirst(true);
+
+    for (const RecordMap::value_type &mapEntry : recordMap)
+    {
+        const Record &record(mapEntry.second);
+
+        stream << (isFirst ? "" : ", ") << "{\"instance\": \"" << std::get<0>(mapEntry.first) << "\", \"category\": \""
+               << std::get<1>(mapEntry.first) << "\", \"name\": \"" << std::get<2>(mapEntry.first) << "\", \"calls\": " << record.m_nCalls
+               << ", \"totalTime\": " << record.m_totalTime << ", \"maxTime\": " << record.m_maxTime
+               << ", \"allocations\": " << record.m_nAllocations << "}";
+        isFirst = false;
+    }
+
+    stream << "]}" << std::endl;
+}
+
+} // namespace lar_content
@@ -0,0 +1,261 @@
+/**
+ *  @file   larpandoracontent/LArHelpers/LArProfilingHelper.h
+ *
+ *  @brief  Header file for the profiling helper class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_PROFILING_HELPER_H
+#define LAR_PROFILING_HELPER_H 1
+
+#include "Pandora/Algorithm.h"
+#include "Pandora/AlgorithmTool.h"
+#include "Pandora/PandoraInternal.h"
+#include "Pandora/StatusCodes.h"
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  LArProfilingHelper class, an opt-in record of the wall time, calls and (optionally) heap allocations of algorithms, daughter
+ *          algorithms, algorithm tools and worker pandora instances. Records are keyed by pandora instance name, so the master and
+ *          worker instances are reported separately. Times are inclusive of any nested, separately recorded, scopes.
+ */
+class LArProfilingHelper
+{
+public:
+    /**
+     *  @brief  Settings class
+     */
+    class Settings
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        Settings();
+
+        std::string m_outputFileName; ///< The output file name stem, to which the summary type and format extension are appended
+        bool m_writeEventSummaries;   ///< Whether to write a summary for every event, in addition to the (cumulative) job summary
+        bool m_useJsonFormat;         ///< Whether to write json, rather than csv, summaries
+        bool m_countAllocations;      ///< Whether to count heap allocations (only available in builds with LAR_CONTENT_PROFILE_ALLOCATIONS)
+    };
+
+    /**
+     *  @brief  ScopedTimer class, which records the wall time and allocations between its construction and destruction
+     */
+    class ScopedTimer
+    {
+    public:
+        /**
+         *  @brief  Constructor, for an algorithm tool
+         *
+         *  @param  pAlgorithmTool address of the algorithm tool
+         */
+        explicit ScopedTimer(const pandora::AlgorithmTool *const pAlgorithmTool);
+
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  process the process (algorithm or tool) within whose pandora instance the scope runs
+         *  @param  category the category of the scope (e.g. algorithm, daughter algorithm, algorithm tool, worker)
+         *  @param  name the name of the scope
+         */
+        ScopedTimer(const pandora::Process &process, const std::string &category, const std::string &name);
+
+        /**
+         *  @brief  Destructor
+         */
+        ~ScopedTimer();
+
+        /**
+         *  @brief  Deleted copy constructor
+         */
+        ScopedTimer(const ScopedTimer &) = delete;
+
+        /**
+         *  @brief  Deleted assignment operator
+         */
+        ScopedTimer &operator=(const ScopedTimer &) = delete;
+
+    private:
+        /**
+         *  @brief  Start timing, if profiling is enabled
+         *
+         *  @param  process the process within whose pandora instance the scope runs
+         *  @param  category the category of the scope
+         *  @param  name the name of the scope
+         */
+        void Start(const pandora::Process &process, const std::string &category, const std::string &name);
+
+        bool m_isActive;                                   ///< Whether the timer is recording
+        std::string m_instanceName;                        ///< The pandora instance name
+        std::string m_category;                            ///< The scope category
+        std::string m_name;                                ///< The scope name
+        std::chrono::steady_clock::time_point m_startTime; ///< The start time
+        unsigned long m_startAllocations;                  ///< The allocation count of this thread at the start time
+    };
+
+    /**
+     *  @brief  Read the profiling settings from the xml of an algorithm (profiling is disabled unless ProfilingOutputFileName is given)
+     *
+     *  @param  xmlHandle the xml handle
+     *  @param  settings to receive the settings
+     *
+     *  @return status code
+     */
+    static pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle, Settings &settings);
+
+    /**
+     *  @brief  Enable profiling, for the rest of the job, if the settings provide an output file name. Only the first owner to enable
+     *          profiling controls the event boundaries, so the same settings may be given to both master and worker instances.
+     *
+     *  @param  pOwner address of the owning algorithm
+     *  @param  settings the settings
+     */
+    static void Enable(const void *const pOwner, const Settings &settings);
+
+    /**
+     *  @brief  Whether profiling is enabled
+     *
+     *  @return boolean
+     */
+    static bool IsEnabled();
+
+    /**
+     *  @brief  Run a daughter algorithm, recording it if profiling is enabled
+     *
+     *  @param  algorithm the parent algorithm
+     *  @param  daughterAlgorithmName the daughter algorithm name
+     *
+     *  @return status code
+     */
+    static pandora::StatusCode RunDaughterAlgorithm(const pandora::Algorithm &algorithm, const std::string &daughterAlgorithmName);
+
+    /**
+     *  @brief  Begin an event, which is then ended by the next call to EndEvent. No action unless called by the owner that enabled
+     *          profiling.
+     *
+     *  @param  pOwner address of the owning algorithm
+     */
+    static void BeginEvent(const void *const pOwner);
+
+    /**
+     *  @brief  End the current event: write the event summary (if requested), rewrite the cumulative job summary and reset the event
+     *          records. No action unless called by the owner that enabled profiling, nor unless an event has begun, so an owner may
+     *          call this from every Reset without closing an event more than once.
+     *
+     *  @param  pOwner address of the owning algorithm
+     */
+    static void EndEvent(const void *const pOwner);
+
+    /**
+     *  @brief  Get the number of heap allocations made by the calling thread, always zero in builds without allocation counting
+     *
+     *  @return the number of heap allocations
+     */
+    static unsigned long GetThreadAllocationCount();
+
+private:
+    /**
+     *  @brief  Record class
+     */
+    class Record
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        Record();
+
+        /**
+         *  @brief  Add a call to the record
+         *
+         *  @param  time the wall time of the call, in seconds
+         *  @param  nAllocations the number of allocations in the call
+         */
+        void AddCall(const double time, const unsigned long nAllocations);
+
+        /**
+         *  @brief  Merge another record into this record
+         *
+         *  @param  other the other record
+         */
+        void Merge(const Record &other);
+
+        unsigned long m_nCalls;       ///< The number of calls
+        double m_totalTime;           ///< The total wall time, in seconds
+        double m_maxTime;             ///< The largest wall time of a single call, in seconds
+        unsigned long m_nAllocations; ///< The total number of allocations
+    };
+
+    typedef std::tuple<std::string, std::string, std::string> RecordKey; ///< (pandora instance name, category, name)
+    typedef std::map<RecordKey, Record> RecordMap;
+
+    /**
+     *  @brief  Profile class, the job-wide profiling state
+     */
+    class Profile
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        Profile();
+
+        std::atomic<bool> m_isEnabled; ///< Whether profiling is enabled
+        std::mutex m_mutex;            ///< The mutex protecting the members below
+        const void *m_pOwner;          ///< The address of the owner that enabled profiling
+        Settings m_settings;           ///< The settings
+        bool m_isEventBegun;           ///< Whether an event has begun, and not yet ended
+        unsigned int m_nEvents;        ///< The number of completed events
+        RecordMap m_eventRecords;      ///< The records of the current event
+        RecordMap m_jobRecords;        ///< The records of the completed events
+    };
+
+    /**
+     *  @brief  Get the job-wide profiling state
+     *
+     *  @return the profile
+     */
+    static Profile &GetProfile();
+
+    /**
+     *  @brief  Add a call to the records of the current event
+     *
+     *  @param  recordKey the record key
+     *  @param  time the wall time of the call, in seconds
+     *  @param  nAllocations the number of allocations in the call
+     */
+    static void AddCall(const RecordKey &recordKey, const double time, const unsigned long nAllocations);
+
+    /**
+     *  @brief  Write a set of records to a csv stream
+     *
+     *  @param  recordMap the records
+     *  @param  eventNumber the event number, or -1 for the job summary
+     *  @param  stream the output stream
+     */
+    static void WriteCsv(const RecordMap &recordMap, const int eventNumber, std::ostream &stream);
+
+    /**
+     *  @brief  Write a set of records, as a single line json object, to a stream
+     *
+     *  @param  recordMap the records
+     *  @param  eventNumber the event number, or -1 for the job summary
+     *  @param  nEvents the number of events summarised
+     *  @param  stream the output stream
+     */
+    static void WriteJson(const RecordMap &recordMap, const int eventNumber, const unsigned int nEvents, std::ostream &stream);
+};
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_PROFILING_HELPER_H
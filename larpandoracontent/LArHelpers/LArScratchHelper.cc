@@ -0,0 +1,36 @@
+/**
+ *  @file   larpandoracontent/LArHelpers/LArScratchHelper.cc
+ *
+ *  @brief  Implementation of the scratch helper class.
+ *
+ *  $Log: $
+ */
+
+#include "larpandoracontent/LArHelpers/LArScratchHelper.h"
+
+namespace lar_content
+{
+
+std::pmr::memory_resource *LArScratchHelper::GetScratchResource()
+{
+    return &LArScratchHelper::GetScratchArena();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArScratchHelper::ResetScratchArena()
+{
+    LArScratchHelper::GetScratchArena().release();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+std::pmr::unsynchronized_pool_resource &LArScratchHelper::GetScratchArena()
+{
+    // ATTN Requests beyond the largest pool block pass directly to new/delete, so large temporaries cannot grow the arena within an event
+    static thread_local std::pmr::unsynchronized_pool_resource scratchArena(
+        std::pmr::pool_options{0, 1 << 16}, std::pmr::new_delete_resource());
+    return scratchArena;
+}
+
+} // namespace lar_content
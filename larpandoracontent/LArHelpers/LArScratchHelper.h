@@ -0,0 +1,66 @@
+/**
+ *  @file   larpandoracontent/LArHelpers/LArScratchHelper.h
+ *
+ *  @brief  Header file for the scratch helper class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_SCRATCH_HELPER_H
+#define LAR_SCRATCH_HELPER_H 1
+
+#include "Pandora/PandoraInternal.h"
+
+#include <functional>
+#include <map>
+#include <memory_resource>
+#include <unordered_map>
+#include <vector>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  LArScratchHelper class, providing a per-thread arena for short-lived, temporary containers. Blocks released by scratch
+ *          containers are recycled, by size, within the arena, and the arena memory is returned to the system only at event boundaries.
+ *          Scratch containers must be local temporaries: they must not outlive the event, nor be destroyed by a thread other than the
+ *          thread that created them.
+ */
+class LArScratchHelper
+{
+public:
+    template <typename T>
+    using ScratchVector = std::pmr::vector<T>;
+
+    template <typename TKEY, typename TVALUE, typename TCOMPARE = std::less<TKEY>>
+    using ScratchMap = std::pmr::map<TKEY, TVALUE, TCOMPARE>;
+
+    template <typename TKEY, typename TVALUE, typename THASH = std::hash<TKEY>>
+    using ScratchUnorderedMap = std::pmr::unordered_map<TKEY, TVALUE, THASH>;
+
+    typedef ScratchVector<const pandora::CaloHit *> ScratchCaloHitVector;
+
+    /**
+     *  @brief  Get the scratch arena of the calling thread, with which scratch containers should be constructed
+     *
+     *  @return address of the arena memory resource
+     */
+    static std::pmr::memory_resource *GetScratchResource();
+
+    /**
+     *  @brief  Release the memory held by the scratch arena of the calling thread. Call only at event boundaries, when no scratch
+     *          containers are alive on the calling thread
+     */
+    static void ResetScratchArena();
+
+private:
+    /**
+     *  @brief  Get the scratch arena of the calling thread
+     *
+     *  @return the scratch arena
+     */
+    static std::pmr::unsynchronized_pool_resource &GetScratchArena();
+};
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_SCRATCH_HELPER_H
@@ -33,7 +33,7 @@ LArVertexHelper::ClusterDirection LArVertexHelper::GetClusterDirectionInZ(
 
     try
     {
-        const LArPointingCluster pointingCluster(pCluster);
+        const LArPointingCluster &pointingCluster(LArPointingClusterHelper::GetPointingCluster(pCluster));
         const float length((pointingCluster.GetInnerVertex().GetPosition() - pointingCluster.GetOuterVertex().GetPosition()).GetMagnitude());
         const bool innerIsAtLowerZ(pointingCluster.GetInnerVertex().GetPosition().GetZ() < pointingCluster.GetOuterVertex().GetPosition().GetZ());
 
@@ -0,0 +1,224 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArCaloHitGrid.cc
+ *
+ *  @brief  Implementation of the calo hit grid class.
+ *
+ *  $Log: $
+ */
+
+#include "Objects/CaloHit.h"
+
+#include "Pandora/StatusCodes.h"
+
+#include "larpandoracontent/LArObjects/LArCaloHitGrid.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+CaloHitGrid::CaloHitGrid(const CaloHitList *const pCaloHitList, const float cellSize) :
+    m_pCaloHitList(pCaloHitList),
+    m_minX(0.f),
+    m_minZ(0.f),
+    m_cellSize(cellSize),
+    m_margin(0.f),
+    m_maxHalfWidth(0.f),
+    m_nCellsX(1),
+    m_nCellsZ(1)
+{
+    if (!pCaloHitList || !(cellSize > std::numeric_limits<float>::epsilon()))
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    const unsigned int nHits(pCaloHitList->size());
+    m_caloHitVector.insert(m_caloHitVector.end(), pCaloHitList->begin(), pCaloHitList->end());
+    m_xPositions.reserve(nHits);
+    m_zPositions.reserve(nHits);
+
+    float maxX(-std::numeric_limits<float>::max()), maxZ(-std::numeric_limits<float>::max()), maxAbsCoordinate(0.f);
+    m_minX = std::numeric_limits<float>::max();
+    m_minZ = std::numeric_limits<float>::max();
+
+    for (const CaloHit *const pCaloHit : m_caloHitVector)
+    {
+        const float x(pCaloHit->GetPositionVector().GetX()), z(pCaloHit->GetPositionVector().GetZ());
+        m_xPositions.push_back(x);
+        m_zPositions.push_back(z);
+        m_minX = std::min(m_minX, x);
+        m_minZ = std::min(m_minZ, z);
+        maxX = std::max(maxX, x);
+        maxZ = std::max(maxZ, z);
+        maxAbsCoordinate = std::max(maxAbsCoordinate, std::max(std::fabs(x), std::fabs(z)));
+        m_maxHalfWidth = std::max(m_maxHalfWidth, 0.5f * pCaloHit->GetCellSize1());
+    }
+
+    if (m_caloHitVector.empty())
+    {
+        m_minX = 0.f;
+        m_minZ = 0.f;
+    }
+    else
+    {
+        // ATTN Many float ulps at the scale of the hit coordinates, so that rounding cannot exclude hits that callers would accept
+        m_margin = 1.e-5f * (1.f + maxAbsCoordinate);
+
+        // Keep the number of cells proportional to the number of hits, whatever the extent of the view
+        const double maxNCells(4. * nHits + 1.);
+
+        while (true)
+        {
+            const double nCellsX(std::floor((maxX - m_minX) / m_cellSize) + 1.), nCellsZ(std::floor((maxZ - m_minZ) / m_cellSize) + 1.);
+
+            if (nCellsX * nCellsZ <= maxNCells)
+            {
+                m_nCellsX = static_cast<unsigned int>(nCellsX);
+                m_nCellsZ = static_cast<unsigned int>(nCellsZ);
+                break;
+            }
+
+            m_cellSize *= 2.f;
+        }
+    }
+
+    // Counting sort of the hit indices by cell, which leaves the indices ascending within each cell
+    UIntVector cellIndices;
+    cellIndices.reserve(nHits);
+    m_cellOffsets.assign(m_nCellsX * m_nCellsZ + 1, 0);
+
+    for (unsigned int iHit = 0; iHit < nHits; ++iHit)
+    {
+        const unsigned int cellIndex(this->GetCellIndex(m_xPositions.at(iHit), m_minX, m_nCellsX) +
+            m_nCellsX * this->GetCellIndex(m_zPositions.at(iHit), m_minZ, m_nCellsZ));
+        cellIndices.push_back(cellIndex);
+        ++m_cellOffsets.at(cellIndex + 1);
+    }
+
+    for (unsigned int iCell = 1; iCell < m_cellOffsets.size(); ++iCell)
+        m_cellOffsets.at(iCell) += m_cellOffsets.at(iCell - 1);
+
+    UIntVector cellCursors(m_cellOffsets.begin(), std::prev(m_cellOffsets.end()));
+    m_cellEntries.resize(nHits);
+
+    for (unsigned int iHit = 0; iHit < nHits; ++iHit)
+        m_cellEntries.at(cellCursors.at(cellIndices.at(iHit))++) = iHit;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void CaloHitGrid::FindHitsInBox(const CartesianVector &minPosition, const CartesianVector &maxPosition, CaloHitList &caloHitList) const
+{
+    if (m_caloHitVector.empty())
+        return;
+
+    const float minX(minPosition.GetX() - m_margin), maxX(maxPosition.GetX() + m_margin);
+    const float minZ(minPosition.GetZ() - m_margin), maxZ(maxPosition.GetZ() + m_margin);
+
+    if ((maxX < minX) || (maxZ < minZ))
+        return;
+
+    const unsigned int minCellX(this->GetCellIndex(minX, m_minX, m_nCellsX)), maxCellX(this->GetCellIndex(maxX, m_minX, m_nCellsX));
+    const unsigned int minCellZ(this->GetCellIndex(minZ, m_minZ, m_nCellsZ)), maxCellZ(this->GetCellIndex(maxZ, m_minZ, m_nCellsZ));
+
+    UIntVector hitIndices;
+
+    for (unsigned int iCellZ = minCellZ; iCellZ <= maxCellZ; ++iCellZ)
+    {
+        for (unsigned int iCellX = minCellX; iCellX <= maxCellX; ++iCellX)
+        {
+            const unsigned int cellIndex(iCellX + m_nCellsX * iCellZ);
+
+            for (unsigned int iEntry = m_cellOffsets[cellIndex]; iEntry < m_cellOffsets[cellIndex + 1]; ++iEntry)
+            {
+                const unsigned int iHit(m_cellEntries[iEntry]);
+                const float x(m_xPositions[iHit]), z(m_zPositions[iHit]);
+
+                if ((x < minX) || (x > maxX) || (z < minZ) || (z > maxZ))
+                    continue;
+
+                hitIndices.push_back(iHit);
+            }
+        }
+    }
+
+    std::sort(hitIndices.begin(), hitIndices.end());
+
+    for (const unsigned int iHit : hitIndices)
+        caloHitList.push_back(m_caloHitVector[iHit]);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void CaloHitGrid::FindHitsInCone(
+    const CartesianVector &apex, const CartesianVector &direction, const float length, const float halfAngle, CaloHitList &caloHitList) const
+{
+    if (halfAngle >= static_cast<float>(M_PI))
+    {
+        this->FindHitsInBox(apex - CartesianVector(length, 0.f, length), apex + CartesianVector(length, 0.f, length), caloHitList);
+        return;
+    }
+
+    // Bounding box of the sector: the apex, the two edge end points and any arc point at which the arc is extremal in x or z
+    const float axisAngle(std::atan2(direction.GetZ(), direction.GetX()));
+    CartesianVector minPosition(apex), maxPosition(apex);
+
+    auto includeArcPoint = [&](const float angle) {
+        const CartesianVector arcPoint(apex + CartesianVector(std::cos(angle), 0.f, std::sin(angle)) * length);
+        minPosition = CartesianVector(std::min(minPosition.GetX(), arcPoint.GetX()), 0.f, std::min(minPosition.GetZ(), arcPoint.GetZ()));
+        maxPosition = CartesianVector(std::max(maxPosition.GetX(), arcPoint.GetX()), 0.f, std::max(maxPosition.GetZ(), arcPoint.GetZ()));
+    };
+
+    includeArcPoint(axisAngle - halfAngle);
+    includeArcPoint(axisAngle + halfAngle);
+
+    for (unsigned int quadrant = 0; quadrant < 4; ++quadrant)
+    {
+        const float angle(0.5f * static_cast<float>(M_PI) * quadrant);
+
+        if (std::fabs(std::remainder(angle - axisAngle, 2.f * static_cast<float>(M_PI))) <= halfAngle)
+            includeArcPoint(angle);
+    }
+
+    this->FindHitsInBox(minPosition, maxPosition, caloHitList);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void CaloHitGrid::FindHitsInCorridor(const CartesianVector &start, const CartesianVector &direction, const float minL, const float maxL,
+    const float halfWidth, CaloHitList &caloHitList) const
+{
+    const CartesianVector normal(direction.GetZ(), 0.f, -direction.GetX());
+    CartesianVector minPosition(start + direction * minL), maxPosition(minPosition);
+
+    for (const float l : {minL, maxL})
+    {
+        for (const float t : {-halfWidth, halfWidth})
+        {
+            const CartesianVector corner(start + direction * l + normal * t);
+            minPosition = CartesianVector(std::min(minPosition.GetX(), corner.GetX()), 0.f, std::min(minPosition.GetZ(), corner.GetZ()));
+            maxPosition = CartesianVector(std::max(maxPosition.GetX(), corner.GetX()), 0.f, std::max(maxPosition.GetZ(), corner.GetZ()));
+        }
+    }
+
+    this->FindHitsInBox(minPosition, maxPosition, caloHitList);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+unsigned int CaloHitGrid::GetCellIndex(const float coordinate, const float minCoordinate, const unsigned int nCells) const
+{
+    if (!(coordinate > minCoordinate))
+        return 0;
+
+    const float cellIndex((coordinate - minCoordinate) / m_cellSize);
+
+    if (!(cellIndex < static_cast<float>(nCells)))
+        return nCells - 1;
+
+    return std::min(static_cast<unsigned int>(cellIndex), nCells - 1);
+}
+
+} // namespace lar_content
@@ -0,0 +1,125 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArCaloHitGrid.h
+ *
+ *  @brief  Header file for the calo hit grid class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_CALO_HIT_GRID_H
+#define LAR_CALO_HIT_GRID_H 1
+
+#include "Objects/CaloHit.h"
+
+namespace lar_content
+{
+
+/**
+ *  @brief  CaloHitGrid class, a uniform 2D (x-z) grid index over the hits of a single view
+ *
+ *  @note   The queries return the candidate hits lying within the axis-aligned bounding box of the requested region, slightly
+ *          enlarged to absorb floating point rounding, and preserve the order of the input hit list. Callers are expected to apply
+ *          their own exact selection to the candidates, which therefore gives identical results to a scan over the full list.
+ */
+class CaloHitGrid
+{
+public:
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  pCaloHitList address of the view hit list, which must outlive the grid
+     *  @param  cellSize the target grid cell size (increased if necessary to keep the number of cells proportional to the number of hits)
+     */
+    CaloHitGrid(const pandora::CaloHitList *const pCaloHitList, const float cellSize);
+
+    /**
+     *  @brief  Get the indexed hit list
+     *
+     *  @return the indexed hit list
+     */
+    const pandora::CaloHitList &GetCaloHitList() const;
+
+    /**
+     *  @brief  Get the largest half hit width (cell size 1) of the indexed hits
+     *
+     *  @return the largest half hit width
+     */
+    float GetMaxHalfWidth() const;
+
+    /**
+     *  @brief  Collect the candidate hits within an axis-aligned box
+     *
+     *  @param  minPosition the minimum x and z coordinates of the box
+     *  @param  maxPosition the maximum x and z coordinates of the box
+     *  @param  caloHitList to receive the candidate hits, in the order of the indexed hit list
+     */
+    void FindHitsInBox(const pandora::CartesianVector &minPosition, const pandora::CartesianVector &maxPosition, pandora::CaloHitList &caloHitList) const;
+
+    /**
+     *  @brief  Collect the candidate hits within a cone (a circular sector in the x-z plane)
+     *
+     *  @param  apex the cone apex
+     *  @param  direction the cone axis direction
+     *  @param  length the cone length (the sector radius)
+     *  @param  halfAngle the cone half opening angle
+     *  @param  caloHitList to receive the candidate hits, in the order of the indexed hit list
+     */
+    void FindHitsInCone(const pandora::CartesianVector &apex, const pandora::CartesianVector &direction, const float length,
+        const float halfAngle, pandora::CaloHitList &caloHitList) const;
+
+    /**
+     *  @brief  Collect the candidate hits within a corridor around a line segment
+     *
+     *  @param  start the line start position
+     *  @param  direction the line unit direction
+     *  @param  minL the minimum longitudinal displacement, along the line, from the start position
+     *  @param  maxL the maximum longitudinal displacement, along the line, from the start position
+     *  @param  halfWidth the corridor half width
+     *  @param  caloHitList to receive the candidate hits, in the order of the indexed hit list
+     */
+    void FindHitsInCorridor(const pandora::CartesianVector &start, const pandora::CartesianVector &direction, const float minL,
+        const float maxL, const float halfWidth, pandora::CaloHitList &caloHitList) const;
+
+private:
+    /**
+     *  @brief  Get the (clamped) cell index for a coordinate
+     *
+     *  @param  coordinate the coordinate
+     *  @param  minCoordinate the grid minimum coordinate
+     *  @param  nCells the number of cells along the axis
+     *
+     *  @return the cell index
+     */
+    unsigned int GetCellIndex(const float coordinate, const float minCoordinate, const unsigned int nCells) const;
+
+    const pandora::CaloHitList *m_pCaloHitList; ///< The indexed hit list
+    pandora::CaloHitVector m_caloHitVector;     ///< The indexed hits, in list order
+    pandora::FloatVector m_xPositions;          ///< The hit x positions, in list order
+    pandora::FloatVector m_zPositions;          ///< The hit z positions, in list order
+    pandora::UIntVector m_cellOffsets;          ///< The offset of each cell's first entry in the cell entry vector, plus a final end offset
+    pandora::UIntVector m_cellEntries;          ///< The hit indices, grouped by cell and ascending within each cell
+    float m_minX;                               ///< The grid minimum x coordinate
+    float m_minZ;                               ///< The grid minimum z coordinate
+    float m_cellSize;                           ///< The grid cell size
+    float m_margin;                             ///< The margin by which query boxes are enlarged
+    float m_maxHalfWidth;                       ///< The largest half hit width
+    unsigned int m_nCellsX;                     ///< The number of cells along x
+    unsigned int m_nCellsZ;                     ///< The number of cells along z
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const pandora::CaloHitList &CaloHitGrid::GetCaloHitList() const
+{
+    return *m_pCaloHitList;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline float CaloHitGrid::GetMaxHalfWidth() const
+{
+    return m_maxHalfWidth;
+}
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_CALO_HIT_GRID_H
@@ -0,0 +1,41 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArHitSnapshot.cc
+ *
+ *  @brief  Implementation of the hit snapshot class.
+ *
+ *  $Log: $
+ */
+
+#include "Objects/CaloHit.h"
+
+#include "Pandora/StatusCodes.h"
+
+#include "larpandoracontent/LArObjects/LArHitSnapshot.h"
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+HitSnapshot::HitSnapshot(const CaloHitList *const pCaloHitList) :
+    m_pCaloHitList(pCaloHitList)
+{
+    if (!pCaloHitList)
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    const unsigned int nHits(pCaloHitList->size());
+    m_caloHitVector.insert(m_caloHitVector.end(), pCaloHitList->begin(), pCaloHitList->end());
+    m_xPositions.reserve(nHits);
+    m_yPositions.reserve(nHits);
+    m_zPositions.reserve(nHits);
+
+    for (const CaloHit *const pCaloHit : m_caloHitVector)
+    {
+        const CartesianVector &position(pCaloHit->GetPositionVector());
+        m_xPositions.push_back(position.GetX());
+        m_yPositions.push_back(position.GetY());
+        m_zPositions.push_back(position.GetZ());
+    }
+}
+
+} // namespace lar_content
@@ -0,0 +1,96 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArHitSnapshot.h
+ *
+ *  @brief  Header file for the hit snapshot class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_HIT_SNAPSHOT_H
+#define LAR_HIT_SNAPSHOT_H 1
+
+#include "Objects/CaloHit.h"
+
+namespace lar_content
+{
+
+/**
+ *  @brief  HitSnapshot class, a structure-of-arrays copy of the hit positions of a calo hit list, so that scans over the full list run
+ *          over contiguous coordinate arrays rather than by chasing pointers through the list and its hits
+ */
+class HitSnapshot
+{
+public:
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  pCaloHitList address of the calo hit list, which must outlive the snapshot
+     */
+    HitSnapshot(const pandora::CaloHitList *const pCaloHitList);
+
+    /**
+     *  @brief  Get the snapshot hit list
+     *
+     *  @return the snapshot hit list
+     */
+    const pandora::CaloHitList &GetCaloHitList() const;
+
+    /**
+     *  @brief  Get the snapshot hits, in list order
+     *
+     *  @return the snapshot hits
+     */
+    const pandora::CaloHitVector &GetCaloHitVector() const;
+
+    /**
+     *  @brief  Whether a hit lies strictly within a half-infinite corridor, i.e. has positive longitudinal displacement along an axis
+     *          and transverse displacement less than a specified distance
+     *
+     *  @param  index the index of the hit in the snapshot hit vector
+     *  @param  origin the axis origin
+     *  @param  direction the axis unit direction
+     *  @param  maxTransverseDistance the maximum transverse distance
+     *
+     *  @return boolean
+     */
+    bool IsAlongAxis(const unsigned int index, const pandora::CartesianVector &origin, const pandora::CartesianVector &direction,
+        const float maxTransverseDistance) const;
+
+private:
+    const pandora::CaloHitList *m_pCaloHitList; ///< The snapshot hit list
+    pandora::CaloHitVector m_caloHitVector;     ///< The snapshot hits, in list order
+    pandora::FloatVector m_xPositions;          ///< The hit x positions, in list order
+    pandora::FloatVector m_yPositions;          ///< The hit y positions, in list order
+    pandora::FloatVector m_zPositions;          ///< The hit z positions, in list order
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const pandora::CaloHitList &HitSnapshot::GetCaloHitList() const
+{
+    return *m_pCaloHitList;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const pandora::CaloHitVector &HitSnapshot::GetCaloHitVector() const
+{
+    return m_caloHitVector;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline bool HitSnapshot::IsAlongAxis(const unsigned int index, const pandora::CartesianVector &origin,
+    const pandora::CartesianVector &direction, const float maxTransverseDistance) const
+{
+    // ATTN Displacements are formed exactly as for the equivalent calculation using the hit position vectors
+    const pandora::CartesianVector position(m_xPositions[index], m_yPositions[index], m_zPositions[index]);
+    const pandora::CartesianVector displacement(position - origin);
+    const float t(direction.GetCrossProduct(displacement).GetMagnitude());
+    const float l(direction.GetDotProduct(displacement));
+
+    return ((l > 0.f) && (t < maxTransverseDistance));
+}
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_HIT_SNAPSHOT_H
@@ -19,49 +19,114 @@ using namespace pandora;
 namespace lar_content
 {
 
-float SimpleCone::GetMeanRT(const Cluster *const pCluster) const
+ConeHitPositions::ConeHitPositions(const Cluster *const pCluster) :
+    m_xCoordinates(LArScratchHelper::GetScratchResource()),
+    m_yCoordinates(LArScratchHelper::GetScratchResource()),
+    m_zCoordinates(LArScratchHelper::GetScratchResource())
 {
-    CartesianPointVector hitPositionVector;
-    LArClusterHelper::GetCoordinateVector(pCluster, hitPositionVector);
-
-    float rTSum(0.f);
-    const unsigned int nClusterHits(pCluster->GetNCaloHits());
+    const unsigned int nHits(pCluster->GetNCaloHits());
+    m_xCoordinates.reserve(nHits);
+    m_yCoordinates.reserve(nHits);
+    m_zCoordinates.reserve(nHits);
 
-    for (const CartesianVector &hitPosition : hitPositionVector)
+    for (const OrderedCaloHitList::value_type &layerEntry : pCluster->GetOrderedCaloHitList())
     {
-        const CartesianVector displacement(hitPosition - this->GetConeApex());
-        const float rT(displacement.GetCrossProduct(this->GetConeDirection()).GetMagnitude());
-        rTSum += rT;
+        for (const CaloHit *const pCaloHit : *layerEntry.second)
+        {
+            const CartesianVector &position(pCaloHit->GetPositionVector());
+            m_xCoordinates.push_back(position.GetX());
+            m_yCoordinates.push_back(position.GetY());
+            m_zCoordinates.push_back(position.GetZ());
+        }
     }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
 
-    return ((nClusterHits > 0) ? rTSum / static_cast<float>(nClusterHits) : 0.f);
+float SimpleCone::GetMeanRT(const Cluster *const pCluster) const
+{
+    const ConeHitPositions hitPositions(pCluster);
+    return this->GetConeScore(hitPositions, this->GetConeLength(), this->GetConeTanHalfAngle(), this->GetConeTanHalfAngle()).m_meanRT;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 float SimpleCone::GetBoundedHitFraction(const Cluster *const pCluster, const float coneLength, const float coneTanHalfAngle) const
 {
-    CartesianPointVector hitPositionVector;
-    LArClusterHelper::GetCoordinateVector(pCluster, hitPositionVector);
+    const ConeHitPositions hitPositions(pCluster);
+    return this->GetConeScore(hitPositions, coneLength, coneTanHalfAngle, coneTanHalfAngle).m_boundedFraction1;
+}
 
-    unsigned int nMatchedHits(0);
-    const unsigned int nClusterHits(pCluster->GetNCaloHits());
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void SimpleCone::GetConeScores(const SimpleConeList &simpleConeList, const ConeHitPositions &hitPositions, const float coneLength,
+    const float coneTanHalfAngle1, const float coneTanHalfAngle2, SimpleConeScoreList &coneScoreList)
+{
+    coneScoreList.clear();
+    coneScoreList.reserve(simpleConeList.size());
+
+    for (const SimpleCone &simpleCone : simpleConeList)
+        coneScoreList.push_back(simpleCone.GetConeScore(hitPositions, coneLength, coneTanHalfAngle1, coneTanHalfAngle2));
+}
 
-    for (const CartesianVector &hitPosition : hitPositionVector)
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void SimpleCone::GetConeScores(
+    const SimpleConeList &simpleConeList, const ConeHitPositions &hitPositions, SimpleConeScoreList &coneScoreList)
+{
+    coneScoreList.clear();
+    coneScoreList.reserve(simpleConeList.size());
+
+    for (const SimpleCone &simpleCone : simpleConeList)
     {
-        const CartesianVector displacement(hitPosition - this->GetConeApex());
-        const float rL(displacement.GetDotProduct(this->GetConeDirection()));
+        const float coneTanHalfAngle(simpleCone.GetConeTanHalfAngle());
+        coneScoreList.push_back(simpleCone.GetConeScore(hitPositions, simpleCone.GetConeLength(), coneTanHalfAngle, coneTanHalfAngle));
+    }
+}
 
-        if ((rL < 0.f) || (rL > coneLength))
-            continue;
+//------------------------------------------------------------------------------------------------------------------------------------------
 
-        const float rT(displacement.GetCrossProduct(this->GetConeDirection()).GetMagnitude());
+SimpleConeScore SimpleCone::GetConeScore(
+    const ConeHitPositions &hitPositions, const float coneLength, const float coneTanHalfAngle1, const float coneTanHalfAngle2) const
+{
+    SimpleConeScore coneScore;
+    const unsigned int nHits(hitPositions.GetNHits());
 
-        if (rL * coneTanHalfAngle > rT)
-            ++nMatchedHits;
+    if (0 == nHits)
+        return coneScore;
+
+    const float *const pX(hitPositions.GetXCoordinates().data());
+    const float *const pY(hitPositions.GetYCoordinates().data());
+    const float *const pZ(hitPositions.GetZCoordinates().data());
+
+    const float apexX(m_coneApex.GetX()), apexY(m_coneApex.GetY()), apexZ(m_coneApex.GetZ());
+    const float directionX(m_coneDirection.GetX()), directionY(m_coneDirection.GetY()), directionZ(m_coneDirection.GetZ());
+
+    unsigned int nBoundedHits1(0), nBoundedHits2(0);
+    float rTSum(0.f);
+
+    // ATTN Operations ordered as for the CartesianVector dot product, cross product and magnitude, so containment decisions are unchanged
+    for (unsigned int iHit = 0; iHit < nHits; ++iHit)
+    {
+        const float dX(pX[iHit] - apexX), dY(pY[iHit] - apexY), dZ(pZ[iHit] - apexZ);
+        const float rL(dX * directionX + dY * directionY + dZ * directionZ);
+        const float crossX(dY * directionZ - directionY * dZ);
+        const float crossY(dZ * directionX - directionZ * dX);
+        const float crossZ(dX * directionY - directionX * dY);
+        const float rT(std::sqrt(crossX * crossX + crossY * crossY + crossZ * crossZ));
+        const bool isWithinLength((rL >= 0.f) && (rL <= coneLength));
+
+        nBoundedHits1 += static_cast<unsigned int>(isWithinLength && (rL * coneTanHalfAngle1 > rT));
+        nBoundedHits2 += static_cast<unsigned int>(isWithinLength && (rL * coneTanHalfAngle2 > rT));
+        rTSum += rT;
     }
 
-    return ((nClusterHits > 0) ? static_cast<float>(nMatchedHits) / static_cast<float>(nClusterHits) : 0.f);
+    coneScore.m_boundedFraction1 = static_cast<float>(nBoundedHits1) / static_cast<float>(nHits);
+    coneScore.m_boundedFraction2 = static_cast<float>(nBoundedHits2) / static_cast<float>(nHits);
+    coneScore.m_meanRT = rTSum / static_cast<float>(nHits);
+
+    return coneScore;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -10,6 +10,8 @@
 
 #include "Api/PandoraApi.h"
 
+#include "larpandoracontent/LArHelpers/LArScratchHelper.h"
+
 #include "larpandoracontent/LArObjects/LArThreeDSlidingFitResult.h"
 
 #include <list>
@@ -30,6 +32,82 @@ enum ConeSelection
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+/**
+ *  @brief  ConeHitPositions class, the hit positions of a cluster held as separate coordinate arrays, extracted once (and without sorting)
+ *          so that many simple cones can be scored against the cluster in vectorisable passes. The arrays are allocated from the scratch
+ *          arena of the constructing thread, so hit positions must be local temporaries of that thread
+ */
+class ConeHitPositions
+{
+public:
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  pCluster the address of the cluster
+     */
+    ConeHitPositions(const pandora::Cluster *const pCluster);
+
+    /**
+     *  @brief  Get the number of hit positions
+     *
+     *  @return the number of hit positions
+     */
+    unsigned int GetNHits() const;
+
+    /**
+     *  @brief  Get the x coordinates of the hit positions
+     *
+     *  @return the x coordinates
+     */
+    const LArScratchHelper::ScratchVector<float> &GetXCoordinates() const;
+
+    /**
+     *  @brief  Get the y coordinates of the hit positions
+     *
+     *  @return the y coordinates
+     */
+    const LArScratchHelper::ScratchVector<float> &GetYCoordinates() const;
+
+    /**
+     *  @brief  Get the z coordinates of the hit positions
+     *
+     *  @return the z coordinates
+     */
+    const LArScratchHelper::ScratchVector<float> &GetZCoordinates() const;
+
+private:
+    LArScratchHelper::ScratchVector<float> m_xCoordinates; ///< The x coordinates of the hit positions
+    LArScratchHelper::ScratchVector<float> m_yCoordinates; ///< The y coordinates of the hit positions
+    LArScratchHelper::ScratchVector<float> m_zCoordinates; ///< The z coordinates of the hit positions
+};
+
+typedef std::vector<ConeHitPositions> ConeHitPositionsList;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  SimpleConeScore class, describing the containment of a set of hit positions within a simple cone
+ */
+class SimpleConeScore
+{
+public:
+    /**
+     *  @brief  Default constructor
+     */
+    SimpleConeScore();
+
+    float m_boundedFraction1; ///< The fraction of hits bounded within the cone, using the first cone half-angle
+    float m_boundedFraction2; ///< The fraction of hits bounded within the cone, using the second cone half-angle
+    float m_meanRT;           ///< The mean transverse distance to all hits (whether contained or not)
+};
+
+typedef std::vector<SimpleConeScore> SimpleConeScoreList;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+class SimpleCone;
+typedef std::vector<SimpleCone> SimpleConeList;
+
 /**
  *  @brief  SimpleCone class
  */
@@ -103,15 +181,50 @@ public:
      */
     float GetBoundedHitFraction(const pandora::Cluster *const pCluster, const float coneLength, const float coneTanHalfAngle) const;
 
+    /**
+     *  @brief  Score a list of cones against a set of hit positions, using a provided cone length and two provided cone half-angles
+     *
+     *  @param  simpleConeList the simple cone list
+     *  @param  hitPositions the hit positions
+     *  @param  coneLength the provided cone length
+     *  @param  coneTanHalfAngle1 the first provided tangent of the cone half-angle
+     *  @param  coneTanHalfAngle2 the second provided tangent of the cone half-angle
+     *  @param  coneScoreList to receive the cone scores, one per cone
+     */
+    static void GetConeScores(const SimpleConeList &simpleConeList, const ConeHitPositions &hitPositions, const float coneLength,
+        const float coneTanHalfAngle1, const float coneTanHalfAngle2, SimpleConeScoreList &coneScoreList);
+
+    /**
+     *  @brief  Score a list of cones against a set of hit positions, using the fitted length and half-angle of each cone (for both
+     *          bounded hit fractions)
+     *
+     *  @param  simpleConeList the simple cone list
+     *  @param  hitPositions the hit positions
+     *  @param  coneScoreList to receive the cone scores, one per cone
+     */
+    static void GetConeScores(
+        const SimpleConeList &simpleConeList, const ConeHitPositions &hitPositions, SimpleConeScoreList &coneScoreList);
+
 private:
+    /**
+     *  @brief  Score the cone against a set of hit positions, in a single branch-free pass over the positions
+     *
+     *  @param  hitPositions the hit positions
+     *  @param  coneLength the provided cone length
+     *  @param  coneTanHalfAngle1 the first provided tangent of the cone half-angle
+     *  @param  coneTanHalfAngle2 the second provided tangent of the cone half-angle
+     *
+     *  @return the cone score
+     */
+    SimpleConeScore GetConeScore(
+        const ConeHitPositions &hitPositions, const float coneLength, const float coneTanHalfAngle1, const float coneTanHalfAngle2) const;
+
     pandora::CartesianVector m_coneApex;      ///< The cone apex
     pandora::CartesianVector m_coneDirection; ///< The cone direction
     float m_coneLength;                       ///< The cone length
     float m_coneTanHalfAngle;                 ///< The tangent of the cone half-angle
 };
 
-typedef std::vector<SimpleCone> SimpleConeList;
-
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 typedef std::map<int, pandora::TrackState> TrackStateMap;
@@ -170,6 +283,45 @@ typedef std::unordered_map<const pandora::Cluster *, ThreeDSlidingConeFitResult>
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+inline unsigned int ConeHitPositions::GetNHits() const
+{
+    return m_xCoordinates.size();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const LArScratchHelper::ScratchVector<float> &ConeHitPositions::GetXCoordinates() const
+{
+    return m_xCoordinates;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const LArScratchHelper::ScratchVector<float> &ConeHitPositions::GetYCoordinates() const
+{
+    return m_yCoordinates;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const LArScratchHelper::ScratchVector<float> &ConeHitPositions::GetZCoordinates() const
+{
+    return m_zCoordinates;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline SimpleConeScore::SimpleConeScore() :
+    m_boundedFraction1(0.f),
+    m_boundedFraction2(0.f),
+    m_meanRT(0.f)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 inline SimpleCone::SimpleCone(const pandora::CartesianVector &coneApex, const pandora::CartesianVector &coneDirection,
     const float coneLength, const float coneTanHalfAngle) :
     m_coneApex(coneApex),
@@ -206,8 +206,8 @@ void ThreeDSlidingFitResult::GetGlobalDirection(const float dTdL1, const float d
 
 TrackState ThreeDSlidingFitResult::GetPrimaryAxis(const Cluster *const pCluster, const float layerPitch)
 {
-    CartesianPointVector pointVector;
-    LArClusterHelper::GetCoordinateVector(pCluster, pointVector);
+    // ATTN The primary axis is independent of the hit order, so the unsorted cluster positions are used in place
+    const CartesianPointVector &pointVector(LArClusterHelper::GetClusterSummary(pCluster).GetPositions());
     return ThreeDSlidingFitResult::GetPrimaryAxis(&pointVector, layerPitch);
 }
 
@@ -32,8 +32,7 @@ TwoDSlidingFitResult::TwoDSlidingFitResult(const Cluster *const pCluster, const
     m_axisDirection(0.f, 0.f, 0.f),
     m_orthoDirection(0.f, 0.f, 0.f)
 {
-    CartesianPointVector pointVector;
-    LArClusterHelper::GetCoordinateVector(pCluster, pointVector);
+    const CartesianPointVector &pointVector(LArClusterHelper::GetClusterSummary(pCluster).GetSortedCoordinates());
 
     this->CalculateAxes(pointVector, layerPitch);
 
@@ -47,9 +46,9 @@ TwoDSlidingFitResult::TwoDSlidingFitResult(const Cluster *const pCluster, const
     else
     {
         // TODO Refactor hit splitting and ensure all parameters configurable
-        LArHitWidthHelper::ConstituentHitVector constituentHitVector(LArHitWidthHelper::GetConstituentHits(pCluster, 0.5f, 1.f, true));
-        const CartesianPointVector constituentHitPointVector(LArHitWidthHelper::GetConstituentHitPositionVector(constituentHitVector));
-        this->FillLayerFitContributionMap(constituentHitPointVector);
+        const LArHitWidthHelper::ClusterConstituentHits &clusterConstituentHits(
+            LArHitWidthHelper::GetClusterConstituentHits(pCluster, 0.5f, 1.f, true));
+        this->FillLayerFitContributionMap(clusterConstituentHits.GetConstituentHitPositionVector());
     }
 
     this->PerformSlidingLinearFit();
@@ -90,16 +89,14 @@ TwoDSlidingFitResult::TwoDSlidingFitResult(const Cluster *const pCluster, const
 
     if (std::fabs(cosOpeningAngle) < axisDeviationLimitForHitDivision)
     {
-        CartesianPointVector pointVector;
-        LArClusterHelper::GetCoordinateVector(pCluster, pointVector);
-        this->FillLayerFitContributionMap(pointVector);
+        this->FillLayerFitContributionMap(LArClusterHelper::GetClusterSummary(pCluster).GetSortedCoordinates());
     }
     else
     {
         // TODO Refactor hit splitting and ensure all parameters configurable
-        LArHitWidthHelper::ConstituentHitVector constituentHitVector(LArHitWidthHelper::GetConstituentHits(pCluster, 0.5f, 1.f, true));
-        const CartesianPointVector constituentHitPointVector(LArHitWidthHelper::GetConstituentHitPositionVector(constituentHitVector));
-        this->FillLayerFitContributionMap(constituentHitPointVector);
+        const LArHitWidthHelper::ClusterConstituentHits &clusterConstituentHits(
+            LArHitWidthHelper::GetClusterConstituentHits(pCluster, 0.5f, 1.f, true));
+        this->FillLayerFitContributionMap(clusterConstituentHits.GetConstituentHitPositionVector());
     }
 
     this->PerformSlidingLinearFit();
@@ -793,6 +790,12 @@ void TwoDSlidingFitResult::FindSlidingFitSegments()
     if ((POSITIVE_IN_X == sustainedDirection) || (NEGATIVE_IN_X == sustainedDirection))
         m_fitSegmentList.push_back(
             FitSegment(sustainedDirectionStartIter->first, sustainedDirectionEndIter->first, sustainedDirectionStartX, sustainedDirectionEndX));
+
+    // ATTN Fill the lookups here, rather than on first use, so that const queries never modify a fit that may be shared between threads
+    m_transverseLookupList.resize(m_fitSegmentList.size());
+
+    for (unsigned int iSegment = 0; iSegment < m_fitSegmentList.size(); ++iSegment)
+        this->FillTransverseLookup(m_fitSegmentList.at(iSegment), m_transverseLookupList.at(iSegment));
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -922,8 +925,13 @@ StatusCode TwoDSlidingFitResult::TransverseInterpolation(const float x, const Fi
     double firstWeight(0.), secondWeight(0.);
     LayerFitResultMap::const_iterator firstLayerIter, secondLayerIter;
 
-    const StatusCode statusCode(
-        this->GetTransverseSurroundingLayers(x, fitSegment.GetStartLayer(), fitSegment.GetEndLayer(), firstLayerIter, secondLayerIter));
+    // ATTN Fit segments that do not belong to this fit result fall back to the layer-by-layer search
+    const TransverseLookup *const pTransverseLookup(this->GetTransverseLookup(fitSegment));
+
+    const StatusCode statusCode(pTransverseLookup
+            ? this->GetTransverseSurroundingLayers(x, *pTransverseLookup, firstLayerIter, secondLayerIter)
+            : this->GetTransverseSurroundingLayers(
+                  x, fitSegment.GetStartLayer(), fitSegment.GetEndLayer(), firstLayerIter, secondLayerIter));
 
     if (STATUS_CODE_SUCCESS != statusCode)
         return statusCode;
@@ -1099,6 +1107,105 @@ StatusCode TwoDSlidingFitResult::GetTransverseSurroundingLayers(const float x, c
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode TwoDSlidingFitResult::GetTransverseSurroundingLayers(const float x, const TransverseLookup &transverseLookup,
+    LayerFitResultMap::const_iterator &firstLayerIter, LayerFitResultMap::const_iterator &secondLayerIter) const
+{
+    const float minX(transverseLookup.m_minLayerX), maxX(transverseLookup.m_maxLayerX);
+
+    if ((std::fabs(maxX - minX) < std::numeric_limits<float>::epsilon()))
+        return STATUS_CODE_NOT_FOUND;
+
+    // Find start layer
+    const float minL(transverseLookup.m_minL);
+    const float maxL(transverseLookup.m_maxL);
+    const float startL(minL + (maxL - minL) * (x - minX) / (maxX - minX));
+    const int startLayer(std::max(transverseLookup.m_minLayer, std::min(transverseLookup.m_maxLayer, this->GetLayer(startL))));
+
+    // Find nearest layer to start layer
+    const int startIndex(transverseLookup.m_layerIndex.at(startLayer - transverseLookup.m_minLayer));
+
+    const bool startIsAhead((transverseLookup.m_layerX.at(startIndex) - x) > std::numeric_limits<float>::epsilon());
+    const bool increasesWithLayers(maxX > minX);
+    const int increment = ((startIsAhead == increasesWithLayers) ? -1 : +1);
+
+    // Find surrounding layers, exactly as for the layer-by-layer search, with the start layer itself unable to act as the second layer
+    firstLayerIter = m_layerFitResultMap.end();
+    secondLayerIter = m_layerFitResultMap.end();
+
+    if ((transverseLookup.m_layerX.at(startIndex) > x) != startIsAhead)
+        return STATUS_CODE_NOT_FOUND;
+
+    const int nLayers(static_cast<int>(transverseLookup.m_layers.size()));
+
+    for (int index = startIndex + increment; (index >= 0) && (index < nLayers); index += increment)
+    {
+        if ((transverseLookup.m_layerX.at(index) > x) == startIsAhead)
+            continue;
+
+        firstLayerIter = m_layerFitResultMap.find(transverseLookup.m_layers.at(index - increment));
+        secondLayerIter = m_layerFitResultMap.find(transverseLookup.m_layers.at(index));
+        return STATUS_CODE_SUCCESS;
+    }
+
+    return STATUS_CODE_NOT_FOUND;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const TwoDSlidingFitResult::TransverseLookup *TwoDSlidingFitResult::GetTransverseLookup(const FitSegment &fitSegment) const
+{
+    for (unsigned int iSegment = 0; iSegment < m_fitSegmentList.size(); ++iSegment)
+    {
+        const FitSegment &thisFitSegment(m_fitSegmentList.at(iSegment));
+
+        if ((thisFitSegment.GetStartLayer() == fitSegment.GetStartLayer()) && (thisFitSegment.GetEndLayer() == fitSegment.GetEndLayer()))
+            return &m_transverseLookupList.at(iSegment);
+    }
+
+    return nullptr;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void TwoDSlidingFitResult::FillTransverseLookup(const FitSegment &fitSegment, TransverseLookup &transverseLookup) const
+{
+    if (m_layerFitResultMap.empty())
+        throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
+
+    LayerFitResultMap::const_iterator minLayerIter = m_layerFitResultMap.find(fitSegment.GetStartLayer());
+    if (m_layerFitResultMap.end() == minLayerIter)
+        throw StatusCodeException(STATUS_CODE_FAILURE);
+
+    LayerFitResultMap::const_iterator maxLayerIter = m_layerFitResultMap.find(fitSegment.GetEndLayer());
+    if (m_layerFitResultMap.end() == maxLayerIter)
+        throw StatusCodeException(STATUS_CODE_FAILURE);
+
+    transverseLookup.m_minLayer = minLayerIter->first;
+    transverseLookup.m_maxLayer = maxLayerIter->first;
+    transverseLookup.m_minL = minLayerIter->second.GetL();
+    transverseLookup.m_maxL = maxLayerIter->second.GetL();
+    transverseLookup.m_layers.clear();
+    transverseLookup.m_layerX.clear();
+    transverseLookup.m_layerIndex.clear();
+
+    for (LayerFitResultMap::const_iterator iter = minLayerIter, iterEnd = std::next(maxLayerIter); iter != iterEnd; ++iter)
+    {
+        CartesianVector layerPosition(0.f, 0.f, 0.f);
+        this->GetGlobalPosition(iter->second.GetL(), iter->second.GetFitT(), layerPosition);
+
+        while (transverseLookup.m_minLayer + static_cast<int>(transverseLookup.m_layerIndex.size()) <= iter->first)
+            transverseLookup.m_layerIndex.push_back(transverseLookup.m_layers.size());
+
+        transverseLookup.m_layers.push_back(iter->first);
+        transverseLookup.m_layerX.push_back(layerPosition.GetX());
+    }
+
+    transverseLookup.m_minLayerX = transverseLookup.m_layerX.front();
+    transverseLookup.m_maxLayerX = transverseLookup.m_layerX.back();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void TwoDSlidingFitResult::GetLongitudinalInterpolationWeights(const float rL, const LayerFitResultMap::const_iterator &firstLayerIter,
     const LayerFitResultMap::const_iterator &secondLayerIter, double &firstWeight, double &secondWeight) const
 {
@@ -1149,4 +1256,17 @@ void TwoDSlidingFitResult::GetTransverseInterpolationWeights(const float x, cons
     }
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+TwoDSlidingFitResult::TransverseLookup::TransverseLookup() :
+    m_minLayer(0),
+    m_maxLayer(0),
+    m_minL(0.f),
+    m_maxL(0.f),
+    m_minLayerX(0.f),
+    m_maxLayerX(0.f)
+{
+}
+
 } // namespace lar_content
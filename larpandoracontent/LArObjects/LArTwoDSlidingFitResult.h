@@ -399,6 +399,31 @@ public:
     const FitSegment &GetFitSegment(const float rL) const;
 
 private:
+    /**
+     *  @brief  TransverseLookup class, holding the layers and fitted x coordinates of a single fit segment, in a form that allows the
+     *          surrounding layers for a transverse position to be found without searching the layer fit result map
+     */
+    class TransverseLookup
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        TransverseLookup();
+
+        int m_minLayer;                   ///< The fit segment start layer
+        int m_maxLayer;                   ///< The fit segment end layer
+        float m_minL;                     ///< The longitudinal coordinate of the start layer
+        float m_maxL;                     ///< The longitudinal coordinate of the end layer
+        float m_minLayerX;                ///< The fitted x coordinate at the start layer
+        float m_maxLayerX;                ///< The fitted x coordinate at the end layer
+        pandora::IntVector m_layers;      ///< The layers with fit results within the fit segment, in increasing order
+        pandora::FloatVector m_layerX;    ///< The fitted x coordinate at each of these layers
+        pandora::UIntVector m_layerIndex; ///< The index of the first layer with a fit result at or above each fit segment layer
+    };
+
+    typedef std::vector<TransverseLookup> TransverseLookupList;
+
     /**
      *  @brief  Calculate the longitudinal and transverse axes
      */
@@ -415,7 +440,7 @@ private:
     void PerformSlidingLinearFit();
 
     /**
-     *  @brief  Find sliding fit segments; sections with tramsverse direction
+     *  @brief  Find sliding fit segments; sections with tramsverse direction, and fill the transverse lookup for each
      */
     void FindSlidingFitSegments();
 
@@ -512,6 +537,37 @@ private:
     pandora::StatusCode GetTransverseSurroundingLayers(const float x, const int minLayer, const int maxLayer,
         LayerFitResultMap::const_iterator &firstLayerIter, LayerFitResultMap::const_iterator &secondLayerIter) const;
 
+    /**
+     *  @brief  Get iterators for layers surrounding a specified transverse position, using the transverse lookup for a fit segment.
+     *          The layers are identical to those found by the layer-by-layer search, which is replaced by a walk over the lookup
+     *
+     *  @param  x the transverse coordinate
+     *  @param  transverseLookup the transverse lookup for the fit segment
+     *  @param  firstLayerIter to receive the iterator for the layer just below the input coordinate
+     *  @param  secondLayerIter to receive the iterator for the layer just above the input coordinate
+     *
+     *  @return status code, faster than throwing in regular use-cases
+     */
+    pandora::StatusCode GetTransverseSurroundingLayers(const float x, const TransverseLookup &transverseLookup,
+        LayerFitResultMap::const_iterator &firstLayerIter, LayerFitResultMap::const_iterator &secondLayerIter) const;
+
+    /**
+     *  @brief  Get the transverse lookup for a fit segment
+     *
+     *  @param  fitSegment the fit segment
+     *
+     *  @return address of the transverse lookup, or nullptr if the fit segment is not one of the segments of this fit
+     */
+    const TransverseLookup *GetTransverseLookup(const FitSegment &fitSegment) const;
+
+    /**
+     *  @brief  Fill the transverse lookup for a fit segment
+     *
+     *  @param  fitSegment the fit segment
+     *  @param  transverseLookup to receive the transverse lookup
+     */
+    void FillTransverseLookup(const FitSegment &fitSegment, TransverseLookup &transverseLookup) const;
+
     /**
      *  @brief  Get interpolation weights for layers surrounding a specified longitudinal position
      *
@@ -545,6 +601,7 @@ private:
     LayerFitResultMap m_layerFitResultMap;             ///< The layer fit result map
     LayerFitContributionMap m_layerFitContributionMap; ///< The layer fit contribution map
     FitSegmentList m_fitSegmentList;                   ///< The fit segment list
+    TransverseLookupList m_transverseLookupList;       ///< The transverse lookup for each fit segment
 };
 
 typedef std::vector<TwoDSlidingFitResult> TwoDSlidingFitResultList;
@@ -91,8 +91,7 @@ void TwoDSlidingShowerFitResult::GetShowerEdges(const float x, const bool widenI
 TwoDSlidingFitResult TwoDSlidingShowerFitResult::LArTwoDShowerEdgeFit(
     const Cluster *const pCluster, const TwoDSlidingFitResult &fullShowerFit, const ShowerEdge showerEdge, const float showerEdgeMultiplier)
 {
-    CartesianPointVector pointVector;
-    LArClusterHelper::GetCoordinateVector(pCluster, pointVector);
+    const CartesianPointVector &pointVector(LArClusterHelper::GetClusterSummary(pCluster).GetSortedCoordinates());
     return TwoDSlidingShowerFitResult::LArTwoDShowerEdgeFit(&pointVector, fullShowerFit, showerEdge, showerEdgeMultiplier);
 }
 
@@ -0,0 +1,534 @@
+/**
+ *  @file   larpandoracontent/LArPersistency/SyntheticEventGenerationAlgorithm.cc
+ *
+ *  @brief  Implementation of the synthetic event generation algorithm class.
+ *
+ *  $Log: $
+ */
+
+#include "Api/PandoraApi.h"
+
+#include "Pandora/AlgorithmHeaders.h"
+
+#include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
+
+#include "larpandoracontent/LArPersistency/SyntheticEventGenerationAlgorithm.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <limits>
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+SyntheticEventGenerationAlgorithm::EventSummary::EventSummary() :
+    m_nMCParticles(0),
+    m_nHitsU(0),
+    m_nHitsV(0),
+    m_nHitsW(0)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+SyntheticEventGenerationAlgorithm::SyntheticEventGenerationAlgorithm() :
+    m_randomSeed(0),
+    m_nTracks(2),
+    m_nShowers(1),
+    m_nCosmicRays(0),
+    m_minTrackLength(10.f),
+    m_maxTrackLength(200.f),
+    m_minShowerEnergy(0.1f),
+    m_maxShowerEnergy(1.f),
+    m_criticalEnergy(0.03f),
+    m_radiationLength(14.f),
+    m_interactionLength(84.f),
+    m_showerAngularSpread(0.2f),
+    m_fiducialFraction(0.5f),
+    m_hitWidth(0.5f),
+    m_energyPerLength(0.0021f),
+    m_eventNumber(0),
+    m_nextAddress(1),
+    m_randomNumberGenerator(static_cast<std::mt19937::result_type>(0)),
+    m_larCaloHitFactory(),
+    m_larMCParticleFactory()
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode SyntheticEventGenerationAlgorithm::Run()
+{
+    CartesianVector minPosition(0.f, 0.f, 0.f), maxPosition(0.f, 0.f, 0.f);
+    this->GetDetectorBounds(minPosition, maxPosition);
+
+    // ATTN Seed every event independently, so that the content of an event does not depend upon the events processed before it
+    m_randomNumberGenerator.seed(static_cast<std::mt19937::result_type>(m_randomSeed + m_eventNumber));
+    m_nextAddress = 1;
+
+    const float scalingFactor(m_scalingFactors.empty() ? 1.f : m_scalingFactors.at(m_eventNumber % m_scalingFactors.size()));
+    const unsigned int nCosmicRays(static_cast<unsigned int>(std::round(scalingFactor * m_nCosmicRays)));
+
+    EventSummary eventSummary;
+    this->CreateInteraction(minPosition, maxPosition, scalingFactor, eventSummary);
+
+    for (unsigned int iCosmicRay = 0; iCosmicRay < nCosmicRays; ++iCosmicRay)
+        this->CreateCosmicRay(minPosition, maxPosition, eventSummary);
+
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::RepeatEventPreparation(*this));
+
+    if (!m_summaryFileName.empty())
+    {
+        std::ofstream summaryStream(m_summaryFileName, (0 == m_eventNumber) ? std::ios_base::trunc : std::ios_base::app);
+
+        if (0 == m_eventNumber)
+            summaryStream << "event,scalingFactor,nMCParticles,nHitsU,nHitsV,nHitsW,nHits" << std::endl;
+
+        summaryStream << m_eventNumber << "," << scalingFactor << "," << eventSummary.m_nMCParticles << "," << eventSummary.m_nHitsU << ","
+                      << eventSummary.m_nHitsV << "," << eventSummary.m_nHitsW << ","
+                      << (eventSummary.m_nHitsU + eventSummary.m_nHitsV + eventSummary.m_nHitsW) << std::endl;
+    }
+
+    ++m_eventNumber;
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void SyntheticEventGenerationAlgorithm::GetDetectorBounds(CartesianVector &minPosition, CartesianVector &maxPosition) const
+{
+    const LArTPCMap &larTPCMap(this->GetPandora().GetGeometry()->GetLArTPCMap());
+
+    if (larTPCMap.empty())
+    {
+        std::cout << "SyntheticEventGenerationAlgorithm::GetDetectorBounds - LArTPC description not registered with Pandora as required "
+                  << std::endl;
+        throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
+    }
+
+    float minX(std::numeric_limits<float>::max()), minY(std::numeric_limits<float>::max()), minZ(std::numeric_limits<float>::max());
+    float maxX(-std::numeric_limits<float>::max()), maxY(-std::numeric_limits<float>::max()), maxZ(-std::numeric_limits<float>::max());
+
+    for (const LArTPCMap::value_type &mapEntry : larTPCMap)
+    {
+        const LArTPC *const pLArTPC(mapEntry.second);
+        minX = std::min(minX, pLArTPC->GetCenterX() - 0.5f * pLArTPC->GetWidthX());
+        minY = std::min(minY, pLArTPC->GetCenterY() - 0.5f * pLArTPC->GetWidthY());
+        minZ = std::min(minZ, pLArTPC->GetCenterZ() - 0.5f * pLArTPC->GetWidthZ());
+        maxX = std::max(maxX, pLArTPC->GetCenterX() + 0.5f * pLArTPC->GetWidthX());
+        maxY = std::max(maxY, pLArTPC->GetCenterY() + 0.5f * pLArTPC->GetWidthY());
+        maxZ = std::max(maxZ, pLArTPC->GetCenterZ() + 0.5f * pLArTPC->GetWidthZ());
+    }
+
+    minPosition = CartesianVector(minX, minY, minZ);
+    maxPosition = CartesianVector(maxX, maxY, maxZ);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void SyntheticEventGenerationAlgorithm::CreateInteraction(
+    const CartesianVector &minPosition, const CartesianVector &maxPosition, const float scalingFactor, EventSummary &eventSummary)
+{
+    const unsigned int nTracks(static_cast<unsigned int>(std::round(scalingFactor * m_nTracks)));
+    const unsigned int nShowers(static_cast<unsigned int>(std::round(scalingFactor * m_nShowers)));
+
+    if ((0 == nTracks) && (0 == nShowers))
+        return;
+
+    const CartesianVector centre((minPosition + maxPosition) * 0.5f), extent(maxPosition - minPosition);
+    const CartesianVector vertex(centre.GetX() + m_fiducialFraction * extent.GetX() * this->GetUniformRandom(-0.5f, 0.5f),
+        centre.GetY() + m_fiducialFraction * extent.GetY() * this->GetUniformRandom(-0.5f, 0.5f),
+        centre.GetZ() + m_fiducialFraction * extent.GetZ() * this->GetUniformRandom(-0.5f, 0.5f));
+    const CartesianVector beamDirection(0.f, 0.f, 1.f);
+
+    // Sample the final state before creating the neutrino, so that the neutrino energy can be set to the total final state energy
+    static const int trackPdgCodes[3] = {MU_MINUS, PROTON, PI_PLUS};
+    IntVector pdgCodes;
+    FloatVector energies;
+    CartesianPointVector endpoints, directions;
+    float totalEnergy(0.f);
+
+    for (unsigned int iTrack = 0; iTrack < nTracks; ++iTrack)
+    {
+        const int pdg(trackPdgCodes[std::min(2, static_cast<int>(this->GetUniformRandom(0.f, 3.f)))]);
+        const float length(this->GetUniformRandom(m_minTrackLength, m_maxTrackLength));
+        const CartesianVector direction(this->GetSmearedDirection(beamDirection, 1.f));
+
+        pdgCodes.push_back(pdg);
+        energies.push_back(PdgTable::GetParticleMass(pdg) + length * m_energyPerLength);
+        endpoints.push_back(vertex + direction * length);
+        directions.push_back(direction);
+        totalEnergy += energies.back();
+    }
+
+    for (unsigned int iShower = 0; iShower < nShowers; ++iShower)
+    {
+        const int pdg((this->GetUniformRandom(0.f, 1.f) < 0.5f) ? E_MINUS : PHOTON);
+        const CartesianVector direction(this->GetSmearedDirection(beamDirection, 1.f));
+
+        pdgCodes.push_back(pdg);
+        energies.push_back(this->GetUniformRandom(m_minShowerEnergy, m_maxShowerEnergy));
+        endpoints.push_back(vertex);
+        directions.push_back(direction);
+        totalEnergy += energies.back();
+    }
+
+    const void *const pNeutrinoAddress(
+        this->CreateMCParticle(NU_MU, totalEnergy, vertex, vertex, beamDirection, 1001, MC_PROC_INCIDENT_NU, nullptr, eventSummary));
+
+    for (unsigned int iParticle = 0; iParticle < pdgCodes.size(); ++iParticle)
+    {
+        if (iParticle < nTracks)
+        {
+            const void *const pTrackAddress(this->CreateMCParticle(pdgCodes.at(iParticle), energies.at(iParticle), vertex,
+                endpoints.at(iParticle), directions.at(iParticle), 1001, MC_PROC_PRIMARY, pNeutrinoAddress, eventSummary));
+            this->CreateHits(vertex, endpoints.at(iParticle), pTrackAddress, eventSummary);
+        }
+        else
+        {
+            this->CreateShowerParticle(pdgCodes.at(iParticle), energies.at(iParticle), vertex, directions.at(iParticle), pNeutrinoAddress,
+                MC_PROC_PRIMARY, eventSummary);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void SyntheticEventGenerationAlgorithm::CreateCosmicRay(
+    const CartesianVector &minPosition, const CartesianVector &maxPosition, EventSummary &eventSummary)
+{
+    const CartesianVector entryPosition(this->GetUniformRandom(minPosition.GetX(), maxPosition.GetX()), maxPosition.GetY(),
+        this->GetUniformRandom(minPosition.GetZ(), maxPosition.GetZ()));
+    CartesianVector direction(this->GetSmearedDirection(CartesianVector(0.f, -1.f, 0.f), 0.5f));
+
+    if (direction.GetY() > -std::numeric_limits<float>::epsilon())
+        direction = CartesianVector(direction.GetX(), -std::max(std::fabs(direction.GetY()), 0.1f), direction.GetZ()).GetUnitVector();
+
+    // Path length to the first detector face crossed on exit
+    float pathLength(std::numeric_limits<float>::max());
+    const float entryCoordinates[3] = {entryPosition.GetX(), entryPosition.GetY(), entryPosition.GetZ()};
+    const float directionCoordinates[3] = {direction.GetX(), direction.GetY(), direction.GetZ()};
+    const float minCoordinates[3] = {minPosition.GetX(), minPosition.GetY(), minPosition.GetZ()};
+    const float maxCoordinates[3] = {maxPosition.GetX(), maxPosition.GetY(), maxPosition.GetZ()};
+
+    for (unsigned int iAxis = 0; iAxis < 3; ++iAxis)
+    {
+        if (std::fabs(directionCoordinates[iAxis]) < std::numeric_limits<float>::epsilon())
+            continue;
+
+        const float boundary((directionCoordinates[iAxis] > 0.f) ? maxCoordinates[iAxis] : minCoordinates[iAxis]);
+        pathLength = std::min(pathLength, (boundary - entryCoordinates[iAxis]) / directionCoordinates[iAxis]);
+    }
+
+    const CartesianVector exitPosition(entryPosition + direction * pathLength);
+    const float energy(PdgTable::GetParticleMass(MU_MINUS) + pathLength * m_energyPerLength + this->GetUniformRandom(0.f, 10.f));
+
+    const void *const pMuonAddress(
+        this->CreateMCParticle(MU_MINUS, energy, entryPosition, exitPosition, direction, 3000, MC_PROC_PRIMARY, nullptr, eventSummary));
+    this->CreateHits(entryPosition, exitPosition, pMuonAddress, eventSummary);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void SyntheticEventGenerationAlgorithm::CreateShowerParticle(const int pdg, const float energy, const CartesianVector &startPosition,
+    const CartesianVector &direction, const void *const pParentAddress, const MCProcess process, EventSummary &eventSummary)
+{
+    if (PHOTON == pdg)
+    {
+        // Photons leave no hits, converting to an electron-positron pair after a mean free path of 9/7 radiation lengths
+        const float pathLength(-std::log(this->GetUniformRandom(0.f, 1.f)) * 9.f * m_radiationLength / 7.f);
+        const CartesianVector conversionPosition(startPosition + direction * pathLength);
+        const void *const pPhotonAddress(this->CreateMCParticle(
+            PHOTON, energy, startPosition, conversionPosition, direction, 1001, process, pParentAddress, eventSummary));
+
+        if (energy < 2.f * m_criticalEnergy)
+            return;
+
+        const float energyFraction(this->GetUniformRandom(0.2f, 0.8f));
+        this->CreateShowerParticle(E_MINUS, energy * energyFraction, conversionPosition,
+            this->GetSmearedDirection(direction, m_showerAngularSpread), pPhotonAddress, MC_PROC_CONV, eventSummary);
+        this->CreateShowerParticle(E_PLUS, energy * (1.f - energyFraction), conversionPosition,
+            this->GetSmearedDirection(direction, m_showerAngularSpread), pPhotonAddress, MC_PROC_CONV, eventSummary);
+        return;
+    }
+
+    // Electrons and positrons follow a kinked path, radiating a bremsstrahlung photon at each kink until below the critical energy
+    CartesianPointVector pathPositions(1, startPosition);
+    CartesianPointVector photonPositions, photonDirections;
+    FloatVector photonEnergies;
+    CartesianVector currentDirection(direction);
+    float currentEnergy(energy);
+
+    while (currentEnergy > m_criticalEnergy)
+    {
+        const float pathLength(std::max(0.1f, -std::log(this->GetUniformRandom(0.f, 1.f)) * m_radiationLength));
+        pathPositions.push_back(pathPositions.back() + currentDirection * pathLength);
+
+        const float photonFraction(this->GetUniformRandom(0.1f, 0.5f));
+        photonPositions.push_back(pathPositions.back());
+        photonDirections.push_back(this->GetSmearedDirection(currentDirection, 0.5f * m_showerAngularSpread));
+        photonEnergies.push_back(currentEnergy * photonFraction);
+
+        currentEnergy *= (1.f - photonFraction);
+        currentDirection = this->GetSmearedDirection(currentDirection, m_showerAngularSpread);
+    }
+
+    pathPositions.push_back(pathPositions.back() + currentDirection * (currentEnergy / m_energyPerLength));
+
+    const void *const pElectronAddress(
+        this->CreateMCParticle(pdg, energy, startPosition, pathPositions.back(), direction, 1001, process, pParentAddress, eventSummary));
+
+    for (unsigned int iPosition = 1; iPosition < pathPositions.size(); ++iPosition)
+        this->CreateHits(pathPositions.at(iPosition - 1), pathPositions.at(iPosition), pElectronAddress, eventSummary);
+
+    for (unsigned int iPhoton = 0; iPhoton < photonEnergies.size(); ++iPhoton)
+    {
+        this->CreateShowerParticle(PHOTON, photonEnergies.at(iPhoton), photonPositions.at(iPhoton), photonDirections.at(iPhoton),
+            pElectronAddress, MC_PROC_E_BREM, eventSummary);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const void *SyntheticEventGenerationAlgorithm::CreateMCParticle(const int pdg, const float energy, const CartesianVector &vertex,
+    const CartesianVector &endpoint, const CartesianVector &direction, const int nuanceCode, const MCProcess process,
+    const void *const pParentAddress, EventSummary &eventSummary)
+{
+    const float mass(PdgTable::GetParticleMass(pdg));
+    const void *const pAddress(this->GetNextAddress());
+
+    LArMCParticleParameters parameters;
+    parameters.m_nuanceCode = nuanceCode;
+    parameters.m_process = process;
+    parameters.m_energy = energy;
+    parameters.m_momentum = direction * std::sqrt(std::max(0.f, energy * energy - mass * mass));
+    parameters.m_vertex = vertex;
+    parameters.m_endpoint = endpoint;
+    parameters.m_particleId = pdg;
+    parameters.m_mcParticleType = MC_3D;
+    parameters.m_pParentAddress = pAddress;
+    PANDORA_THROW_RESULT_IF(
+        STATUS_CODE_SUCCESS, !=, PandoraApi::MCParticle::Create(this->GetPandora(), parameters, m_larMCParticleFactory));
+
+    if (pParentAddress)
+    {
+        PANDORA_THROW_RESULT_IF(
+            STATUS_CODE_SUCCESS, !=, PandoraApi::SetMCParentDaughterRelationship(this->GetPandora(), pParentAddress, pAddress));
+    }
+
+    ++eventSummary.m_nMCParticles;
+
+    return pAddress;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void SyntheticEventGenerationAlgorithm::CreateHits(const CartesianVector &startPosition, const CartesianVector &endPosition,
+    const void *const pMCParticleAddress, EventSummary &eventSummary)
+{
+    const float length((endPosition - startPosition).GetMagnitude());
+
+    if (length < std::numeric_limits<float>::epsilon())
+        return;
+
+    for (const HitType hitType : {TPC_VIEW_U, TPC_VIEW_V, TPC_VIEW_W})
+    {
+        const float wirePitch(LArGeometryHelper::GetWirePitch(this->GetPandora(), hitType));
+        const CartesianVector projectedStart(LArGeometryHelper::ProjectPosition(this->GetPandora(), startPosition, hitType));
+        const CartesianVector projectedEnd(LArGeometryHelper::ProjectPosition(this->GetPandora(), endPosition, hitType));
+
+        // One sample per wire crossed, or per hit width in the drift direction for deposits running (nearly) parallel to the wires
+        const float nWires(std::fabs(projectedEnd.GetZ() - projectedStart.GetZ()) / wirePitch);
+        const float nWidths(std::fabs(projectedEnd.GetX() - projectedStart.GetX()) / m_hitWidth);
+        const unsigned int nSamples(std::max(1u, static_cast<unsigned int>(std::ceil(std::max(nWires, nWidths)))));
+        const float sampleEnergy(length * m_energyPerLength / static_cast<float>(nSamples));
+
+        unsigned int &nHits(
+            (TPC_VIEW_U == hitType) ? eventSummary.m_nHitsU : (TPC_VIEW_V == hitType) ? eventSummary.m_nHitsV : eventSummary.m_nHitsW);
+
+        for (unsigned int iSample = 0; iSample < nSamples; ++iSample)
+        {
+            const float fraction((static_cast<float>(iSample) + 0.5f) / static_cast<float>(nSamples));
+
+            const CartesianVector samplePosition(startPosition + (endPosition - startPosition) * fraction);
+
+            if (this->CreateHit(samplePosition, hitType, wirePitch, sampleEnergy, pMCParticleAddress))
+                ++nHits;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool SyntheticEventGenerationAlgorithm::CreateHit(const CartesianVector &position3D, const HitType hitType, const float wirePitch,
+    const float energy, const void *const pMCParticleAddress)
+{
+    const LArTPC *pContainingLArTPC(nullptr);
+
+    for (const LArTPCMap::value_type &mapEntry : this->GetPandora().GetGeometry()->GetLArTPCMap())
+    {
+        const LArTPC *const pLArTPC(mapEntry.second);
+
+        if ((std::fabs(position3D.GetX() - pLArTPC->GetCenterX()) <= 0.5f * pLArTPC->GetWidthX()) &&
+            (std::fabs(position3D.GetY() - pLArTPC->GetCenterY()) <= 0.5f * pLArTPC->GetWidthY()) &&
+            (std::fabs(position3D.GetZ() - pLArTPC->GetCenterZ()) <= 0.5f * pLArTPC->GetWidthZ()))
+        {
+            pContainingLArTPC = pLArTPC;
+            break;
+        }
+    }
+
+    if (!pContainingLArTPC)
+        return false;
+
+    // Place the hit on the nearest wire
+    const CartesianVector projectedPosition(LArGeometryHelper::ProjectPosition(this->GetPandora(), position3D, hitType));
+    const float wirePosition(wirePitch * std::round(projectedPosition.GetZ() / wirePitch));
+    const void *const pAddress(this->GetNextAddress());
+
+    LArCaloHitParameters parameters;
+    parameters.m_positionVector = CartesianVector(projectedPosition.GetX(), 0.f, wirePosition);
+    parameters.m_expectedDirection = CartesianVector(0.f, 0.f, 1.f);
+    parameters.m_cellNormalVector = CartesianVector(0.f, 0.f, 1.f);
+    parameters.m_cellGeometry = RECTANGULAR;
+    parameters.m_cellSize0 = wirePitch;
+    parameters.m_cellSize1 = m_hitWidth;
+    parameters.m_cellThickness = wirePitch;
+    parameters.m_nCellRadiationLengths = wirePitch / m_radiationLength;
+    parameters.m_nCellInteractionLengths = wirePitch / m_interactionLength;
+    parameters.m_time = 0.f;
+    parameters.m_inputEnergy = energy;
+    parameters.m_mipEquivalentEnergy = energy / (m_energyPerLength * wirePitch);
+    parameters.m_electromagneticEnergy = energy;
+    parameters.m_hadronicEnergy = energy;
+    parameters.m_isDigital = false;
+    parameters.m_hitType = hitType;
+    parameters.m_hitRegion = SINGLE_REGION;
+    parameters.m_layer = 0;
+    parameters.m_isInOuterSamplingLayer = false;
+    parameters.m_pParentAddress = pAddress;
+    parameters.m_larTPCVolumeId = pContainingLArTPC->GetLArTPCVolumeId();
+    parameters.m_daughterVolumeId = 0;
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::CaloHit::Create(this->GetPandora(), parameters, m_larCaloHitFactory));
+    PANDORA_THROW_RESULT_IF(
+        STATUS_CODE_SUCCESS, !=, PandoraApi::SetCaloHitToMCParticleRelationship(this->GetPandora(), pAddress, pMCParticleAddress, 1.f));
+
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const void *SyntheticEventGenerationAlgorithm::GetNextAddress()
+{
+    // ATTN Synthetic objects have no external counterpart, so unique integers stand in for the usual parent addresses
+    return reinterpret_cast<const void *>(m_nextAddress++);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float SyntheticEventGenerationAlgorithm::GetUniformRandom(const float minValue, const float maxValue)
+{
+    // Open interval (0, 1), built from the 32-bit generator output, whose sequence is fully specified by the standard
+    const double uniform((static_cast<double>(m_randomNumberGenerator()) + 0.5) / 4294967296.);
+    return static_cast<float>(minValue + (maxValue - minValue) * uniform);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float SyntheticEventGenerationAlgorithm::GetGaussianRandom()
+{
+    const float uniform1(this->GetUniformRandom(0.f, 1.f)), uniform2(this->GetUniformRandom(0.f, 1.f));
+    return std::sqrt(-2.f * std::log(uniform1)) * std::cos(2.f * static_cast<float>(M_PI) * uniform2);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+CartesianVector SyntheticEventGenerationAlgorithm::GetSmearedDirection(const CartesianVector &direction, const float angularSpread)
+{
+    const CartesianVector seedAxis((std::fabs(direction.GetX()) < 0.9f) ? CartesianVector(1.f, 0.f, 0.f) : CartesianVector(0.f, 1.f, 0.f));
+    const CartesianVector axis1(direction.GetCrossProduct(seedAxis).GetUnitVector());
+    const CartesianVector axis2(direction.GetCrossProduct(axis1).GetUnitVector());
+    const float smear1(angularSpread * this->GetGaussianRandom()), smear2(angularSpread * this->GetGaussianRandom());
+
+    return (direction + axis1 * smear1 + axis2 * smear2).GetUnitVector();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode SyntheticEventGenerationAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
+{
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "RandomSeed", m_randomSeed));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NTracks", m_nTracks));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NShowers", m_nShowers));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NCosmicRays", m_nCosmicRays));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadVectorOfValues(xmlHandle, "ScalingFactors", m_scalingFactors));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "MinTrackLength", m_minTrackLength));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "MaxTrackLength", m_maxTrackLength));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "MinShowerEnergy", m_minShowerEnergy));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "MaxShowerEnergy", m_maxShowerEnergy));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "CriticalEnergy", m_criticalEnergy));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "RadiationLength", m_radiationLength));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "InteractionLength", m_interactionLength));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "ShowerAngularSpread", m_showerAngularSpread));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "FiducialFraction", m_fiducialFraction));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "HitWidth", m_hitWidth));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "EnergyPerLength", m_energyPerLength));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "SummaryFileName", m_summaryFileName));
+
+    if ((m_minTrackLength > m_maxTrackLength) || (m_minShowerEnergy > m_maxShowerEnergy) || !(m_criticalEnergy > 0.f) ||
+        !(m_radiationLength > 0.f) || !(m_interactionLength > 0.f) || !(m_hitWidth > 0.f) || !(m_energyPerLength > 0.f))
+    {
+        std::cout << "SyntheticEventGenerationAlgorithm::ReadSettings - invalid track, shower or hit settings" << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
+    for (const float scalingFactor : m_scalingFactors)
+    {
+        if (scalingFactor < 0.f)
+        {
+            std::cout << "SyntheticEventGenerationAlgorithm::ReadSettings - scaling factors must not be negative" << std::endl;
+            return STATUS_CODE_INVALID_PARAMETER;
+        }
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+} // namespace lar_content
@@ -0,0 +1,207 @@
+/**
+ *  @file   larpandoracontent/LArPersistency/SyntheticEventGenerationAlgorithm.h
+ *
+ *  @brief  Header file for the synthetic event generation algorithm class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_SYNTHETIC_EVENT_GENERATION_ALGORITHM_H
+#define LAR_SYNTHETIC_EVENT_GENERATION_ALGORITHM_H 1
+
+#include "Pandora/Algorithm.h"
+
+#include "larpandoracontent/LArObjects/LArCaloHit.h"
+#include "larpandoracontent/LArObjects/LArMCParticle.h"
+
+#include <cstdint>
+#include <random>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  SyntheticEventGenerationAlgorithm class, which creates reproducible, synthetic lar tpc events (a neutrino-like interaction with
+ *          straight tracks and em showers, plus an optional overlay of cosmic-ray muons) directly in the pandora input lists. Hits are
+ *          sampled at the wire pitch in each view, using the registered lar tpc geometry and transformation plugin, and hits outside every
+ *          lar tpc are dropped, so multi-tpc geometries are supported. Run as the first algorithm, in place of event reading, and profile
+ *          the subsequent algorithm chain using the LArProfiling algorithm. Multiplicity scaling factors, cycled event by event, provide
+ *          events of increasing hit count for scaling studies.
+ */
+class SyntheticEventGenerationAlgorithm : public pandora::Algorithm
+{
+public:
+    /**
+     *  @brief  Default constructor
+     */
+    SyntheticEventGenerationAlgorithm();
+
+private:
+    /**
+     *  @brief  Event summary class
+     */
+    class EventSummary
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        EventSummary();
+
+        unsigned int m_nMCParticles; ///< The number of mc particles created
+        unsigned int m_nHitsU;       ///< The number of u hits created
+        unsigned int m_nHitsV;       ///< The number of v hits created
+        unsigned int m_nHitsW;       ///< The number of w hits created
+    };
+
+    pandora::StatusCode Run();
+
+    /**
+     *  @brief  Get the region spanned by the registered lar tpcs
+     *
+     *  @param  minPosition to receive the minimum coordinates of the region
+     *  @param  maxPosition to receive the maximum coordinates of the region
+     */
+    void GetDetectorBounds(pandora::CartesianVector &minPosition, pandora::CartesianVector &maxPosition) const;
+
+    /**
+     *  @brief  Create the straight tracks and em showers of a neutrino-like interaction
+     *
+     *  @param  minPosition the minimum coordinates of the detector
+     *  @param  maxPosition the maximum coordinates of the detector
+     *  @param  scalingFactor the multiplicity scaling factor for this event
+     *  @param  eventSummary the event summary
+     */
+    void CreateInteraction(const pandora::CartesianVector &minPosition, const pandora::CartesianVector &maxPosition,
+        const float scalingFactor, EventSummary &eventSummary);
+
+    /**
+     *  @brief  Create a cosmic-ray muon, entering through the top face of the detector
+     *
+     *  @param  minPosition the minimum coordinates of the detector
+     *  @param  maxPosition the maximum coordinates of the detector
+     *  @param  eventSummary the event summary
+     */
+    void CreateCosmicRay(
+        const pandora::CartesianVector &minPosition, const pandora::CartesianVector &maxPosition, EventSummary &eventSummary);
+
+    /**
+     *  @brief  Create an em shower particle and, recursively, its daughters
+     *
+     *  @param  pdg the particle pdg code (electron or photon)
+     *  @param  energy the particle energy
+     *  @param  startPosition the particle start position
+     *  @param  direction the particle initial direction
+     *  @param  pParentAddress the address of the parent mc particle
+     *  @param  process the process creating the particle
+     *  @param  eventSummary the event summary
+     */
+    void CreateShowerParticle(const int pdg, const float energy, const pandora::CartesianVector &startPosition,
+        const pandora::CartesianVector &direction, const void *const pParentAddress, const MCProcess process, EventSummary &eventSummary);
+
+    /**
+     *  @brief  Create an mc particle
+     *
+     *  @param  pdg the particle pdg code
+     *  @param  energy the particle energy
+     *  @param  vertex the particle vertex
+     *  @param  endpoint the particle endpoint
+     *  @param  direction the particle initial direction
+     *  @param  nuanceCode the nuance code
+     *  @param  process the process creating the particle
+     *  @param  pParentAddress the address of the parent mc particle, if any
+     *  @param  eventSummary the event summary
+     *
+     *  @return the address of the new mc particle
+     */
+    const void *CreateMCParticle(const int pdg, const float energy, const pandora::CartesianVector &vertex,
+        const pandora::CartesianVector &endpoint, const pandora::CartesianVector &direction, const int nuanceCode, const MCProcess process,
+        const void *const pParentAddress, EventSummary &eventSummary);
+
+    /**
+     *  @brief  Create the hits, in all three views, of a straight energy deposit
+     *
+     *  @param  startPosition the deposit start position
+     *  @param  endPosition the deposit end position
+     *  @param  pMCParticleAddress the address of the depositing mc particle
+     *  @param  eventSummary the event summary
+     */
+    void CreateHits(const pandora::CartesianVector &startPosition, const pandora::CartesianVector &endPosition,
+        const void *const pMCParticleAddress, EventSummary &eventSummary);
+
+    /**
+     *  @brief  Create a single hit in a specified view
+     *
+     *  @param  position3D the three dimensional position of the deposit
+     *  @param  hitType the view
+     *  @param  wirePitch the wire pitch in the view
+     *  @param  energy the deposited energy
+     *  @param  pMCParticleAddress the address of the depositing mc particle
+     *
+     *  @return whether the hit lies within a lar tpc, and so was created
+     */
+    bool CreateHit(const pandora::CartesianVector &position3D, const pandora::HitType hitType, const float wirePitch, const float energy,
+        const void *const pMCParticleAddress);
+
+    /**
+     *  @brief  Get the next unique address, used to identify the synthetic mc particles and hits
+     *
+     *  @return the address
+     */
+    const void *GetNextAddress();
+
+    /**
+     *  @brief  Get a uniformly distributed random number, computed directly from the generator output so as to be platform independent
+     *
+     *  @param  minValue the minimum value
+     *  @param  maxValue the maximum value
+     *
+     *  @return the random number
+     */
+    float GetUniformRandom(const float minValue, const float maxValue);
+
+    /**
+     *  @brief  Get a normally distributed random number, with zero mean and unit width
+     *
+     *  @return the random number
+     */
+    float GetGaussianRandom();
+
+    /**
+     *  @brief  Get a random direction, smeared about a specified direction with a specified angular width
+     *
+     *  @param  direction the unit direction about which to smear
+     *  @param  angularSpread the angular width of the smearing
+     *
+     *  @return the smeared unit direction
+     */
+    pandora::CartesianVector GetSmearedDirection(const pandora::CartesianVector &direction, const float angularSpread);
+
+    pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
+
+    unsigned int m_randomSeed;                   ///< The random seed, combined with the event number to seed each event
+    unsigned int m_nTracks;                      ///< The number of straight tracks per interaction
+    unsigned int m_nShowers;                     ///< The number of em showers per interaction
+    unsigned int m_nCosmicRays;                  ///< The number of overlaid cosmic-ray muons per event
+    pandora::FloatVector m_scalingFactors;       ///< The multiplicity scaling factors, cycled event by event
+    float m_minTrackLength;                      ///< The minimum track length
+    float m_maxTrackLength;                      ///< The maximum track length
+    float m_minShowerEnergy;                     ///< The minimum em shower energy
+    float m_maxShowerEnergy;                     ///< The maximum em shower energy
+    float m_criticalEnergy;                      ///< The energy below which em shower particles no longer branch
+    float m_radiationLength;                     ///< The radiation length
+    float m_interactionLength;                   ///< The nuclear interaction length
+    float m_showerAngularSpread;                 ///< The angular width of the direction changes within em showers
+    float m_fiducialFraction;                    ///< The fraction of the detector extent, about its centre, in which vertices are placed
+    float m_hitWidth;                            ///< The width of each hit in the drift (x) direction
+    float m_energyPerLength;                     ///< The energy deposited per unit length
+    std::string m_summaryFileName;               ///< The name of the file to which the per event hit counts are appended, if any
+    unsigned int m_eventNumber;                  ///< The number of the current event
+    std::uintptr_t m_nextAddress;                ///< The next unique address
+    std::mt19937 m_randomNumberGenerator;        ///< The random number generator
+    const LArCaloHitFactory m_larCaloHitFactory; ///< Factory for creating LArCaloHits
+    const LArMCParticleFactory m_larMCParticleFactory; ///< Factory for creating LArMCParticles
+};
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_SYNTHETIC_EVENT_GENERATION_ALGORITHM_H
@@ -34,7 +34,7 @@ InitialRegionFeatureTool::InitialRegionFeatureTool() :
 
 void InitialRegionFeatureTool::Run(LArMvaHelper::MvaFeatureVector &featureVector, const Algorithm *const pAlgorithm,
     const ParticleFlowObject *const /*pShowerPfo*/, const CartesianVector &nuVertex3D, const ProtoShowerMatch &protoShowerMatch,
-    const CartesianPointVector & /*showerStarts3D*/)
+    const CartesianPointVector & /*showerStarts3D*/, const ViewHitSnapshotMap & /*viewHitSnapshotMap*/)
 {
     float initialGapSizeU(m_defaultFloat), initialGapSizeV(m_defaultFloat), initialGapSizeW(m_defaultFloat);
     float largestGapSizeU(m_defaultFloat), largestGapSizeV(m_defaultFloat), largestGapSizeW(m_defaultFloat);
@@ -55,10 +55,10 @@ void InitialRegionFeatureTool::Run(LArMvaHelper::MvaFeatureVector &featureVector
 
 void InitialRegionFeatureTool::Run(LArMvaHelper::MvaFeatureMap &featureMap, StringVector &featureOrder, const std::string &featureToolName,
     const Algorithm *const pAlgorithm, const ParticleFlowObject *const pShowerPfo, const CartesianVector &nuVertex3D,
-    const ProtoShowerMatch &protoShowerMatch, const CartesianPointVector &showerStarts3D)
+    const ProtoShowerMatch &protoShowerMatch, const CartesianPointVector &showerStarts3D, const ViewHitSnapshotMap &viewHitSnapshotMap)
 {
     LArMvaHelper::MvaFeatureVector toolFeatureVec;
-    this->Run(toolFeatureVec, pAlgorithm, pShowerPfo, nuVertex3D, protoShowerMatch, showerStarts3D);
+    this->Run(toolFeatureVec, pAlgorithm, pShowerPfo, nuVertex3D, protoShowerMatch, showerStarts3D, viewHitSnapshotMap);
 
     if (featureMap.find(featureToolName + "_initialGapSize") != featureMap.end())
     {
@@ -81,6 +81,13 @@ void InitialRegionFeatureTool::Run(LArMvaHelper::MvaFeatureMap &featureMap, Stri
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+bool InitialRegionFeatureTool::IsThreadSafe() const
+{
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void InitialRegionFeatureTool::GetViewInitialRegionVariables(const Algorithm *const pAlgorithm, const CartesianVector &nuVertex3D,
     const ProtoShowerMatch &protoShowerMatch, const HitType hitType, float &initialGapSize, float &largestGapSize) const
 {
@@ -145,7 +152,7 @@ ConnectionRegionFeatureTool::ConnectionRegionFeatureTool() :
 
 void ConnectionRegionFeatureTool::Run(LArMvaHelper::MvaFeatureVector &featureVector, const Algorithm *const pAlgorithm,
     const ParticleFlowObject *const /*pShowerPfo*/, const CartesianVector &nuVertex3D, const ProtoShowerMatch &protoShowerMatch,
-    const CartesianPointVector &showerStarts3D)
+    const CartesianPointVector &showerStarts3D, const ViewHitSnapshotMap & /*viewHitSnapshotMap*/)
 {
     const float pathwayLength = (nuVertex3D - showerStarts3D.front()).GetMagnitude();
     const float pathwayScatteringAngle2D = this->Get2DKink(pAlgorithm, protoShowerMatch, showerStarts3D.back());
@@ -158,10 +165,11 @@ void ConnectionRegionFeatureTool::Run(LArMvaHelper::MvaFeatureVector &featureVec
 
 void ConnectionRegionFeatureTool::Run(LArMvaHelper::MvaFeatureMap &featureMap, StringVector &featureOrder,
     const std::string &featureToolName, const Algorithm *const pAlgorithm, const ParticleFlowObject *const pShowerPfo,
-    const CartesianVector &nuVertex3D, const ProtoShowerMatch &protoShowerMatch, const CartesianPointVector &showerStarts3D)
+    const CartesianVector &nuVertex3D, const ProtoShowerMatch &protoShowerMatch, const CartesianPointVector &showerStarts3D,
+    const ViewHitSnapshotMap &viewHitSnapshotMap)
 {
     LArMvaHelper::MvaFeatureVector toolFeatureVec;
-    this->Run(toolFeatureVec, pAlgorithm, pShowerPfo, nuVertex3D, protoShowerMatch, showerStarts3D);
+    this->Run(toolFeatureVec, pAlgorithm, pShowerPfo, nuVertex3D, protoShowerMatch, showerStarts3D, viewHitSnapshotMap);
 
     if (featureMap.find(featureToolName + "_pathwayLength") != featureMap.end())
     {
@@ -184,6 +192,13 @@ void ConnectionRegionFeatureTool::Run(LArMvaHelper::MvaFeatureMap &featureMap, S
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+bool ConnectionRegionFeatureTool::IsThreadSafe() const
+{
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 float ConnectionRegionFeatureTool::Get2DKink(
     const Algorithm *const pAlgorithm, const ProtoShowerMatch &protoShowerMatch, const CartesianVector &showerStart3D) const
 {
@@ -353,7 +368,7 @@ ShowerRegionFeatureTool::ShowerRegionFeatureTool() :
 
 void ShowerRegionFeatureTool::Run(LArMvaHelper::MvaFeatureVector &featureVector, const Algorithm *const pAlgorithm,
     const ParticleFlowObject *const pShowerPfo, const CartesianVector &nuVertex3D, const ProtoShowerMatch &protoShowerMatch,
-    const CartesianPointVector &showerStarts3D)
+    const CartesianPointVector &showerStarts3D, const ViewHitSnapshotMap & /*viewHitSnapshotMap*/)
 {
     float nHitsU(m_defaultFloat), foundHitRatioU(m_defaultRatio), scatterAngleU(m_defaultFloat), openingAngleU(m_defaultFloat),
         nuVertexEnergyAsymmetryU(m_defaultRatio), nuVertexEnergyWeightedMeanRadialDistanceU(m_defaultFloat),
@@ -419,10 +434,10 @@ void ShowerRegionFeatureTool::Run(LArMvaHelper::MvaFeatureVector &featureVector,
 
 void ShowerRegionFeatureTool::Run(LArMvaHelper::MvaFeatureMap &featureMap, StringVector &featureOrder, const std::string &featureToolName,
     const Algorithm *const pAlgorithm, const ParticleFlowObject *const pShowerPfo, const CartesianVector &nuVertex3D,
-    const ProtoShowerMatch &protoShowerMatch, const CartesianPointVector &showerStarts3D)
+    const ProtoShowerMatch &protoShowerMatch, const CartesianPointVector &showerStarts3D, const ViewHitSnapshotMap &viewHitSnapshotMap)
 {
     LArMvaHelper::MvaFeatureVector toolFeatureVec;
-    this->Run(toolFeatureVec, pAlgorithm, pShowerPfo, nuVertex3D, protoShowerMatch, showerStarts3D);
+    this->Run(toolFeatureVec, pAlgorithm, pShowerPfo, nuVertex3D, protoShowerMatch, showerStarts3D, viewHitSnapshotMap);
 
     if (featureMap.find(featureToolName + "_nShowerHits") != featureMap.end())
     {
@@ -499,6 +514,13 @@ void ShowerRegionFeatureTool::Run(LArMvaHelper::MvaFeatureMap &featureMap, Strin
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+bool ShowerRegionFeatureTool::IsThreadSafe() const
+{
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void ShowerRegionFeatureTool::GetViewShowerRegionVariables(const Algorithm *const pAlgorithm, const ParticleFlowObject *const pShowerPfo,
     const CartesianVector &nuVertex3D, const ProtoShowerMatch &protoShowerMatch, const HitType hitType, const CartesianVector &showerStart3D,
     float &nHits, float &foundHitRatio, float &scatterAngle, float &openingAngle, float &nuVertexEnergyAsymmetry,
@@ -869,9 +891,6 @@ StatusCode ShowerRegionFeatureTool::ReadSettings(const TiXmlHandle xmlHandle)
 
 AmbiguousRegionFeatureTool::AmbiguousRegionFeatureTool() :
     m_defaultFloat(-10.f),
-    m_caloHitListNameU("CaloHitListU"),
-    m_caloHitListNameV("CaloHitListV"),
-    m_caloHitListNameW("CaloHitListW"),
     m_maxTransverseDistance(0.75f),
     m_maxSampleHits(3),
     m_maxHitSeparation(1.f),
@@ -883,7 +902,7 @@ AmbiguousRegionFeatureTool::AmbiguousRegionFeatureTool() :
 
 void AmbiguousRegionFeatureTool::Run(LArMvaHelper::MvaFeatureVector &featureVector, const Algorithm *const pAlgorithm,
     const ParticleFlowObject *const /*pShowerPfo*/, const CartesianVector &nuVertex3D, const ProtoShowerMatch &protoShowerMatch,
-    const CartesianPointVector & /*showerStarts3D*/)
+    const CartesianPointVector & /*showerStarts3D*/, const ViewHitSnapshotMap &viewHitSnapshotMap)
 {
     float nAmbiguousViews(0.f);
     this->CalculateNAmbiguousViews(protoShowerMatch, nAmbiguousViews);
@@ -891,13 +910,13 @@ void AmbiguousRegionFeatureTool::Run(LArMvaHelper::MvaFeatureVector &featureVect
     float maxUnaccountedEnergy(m_defaultFloat);
     float unaccountedHitEnergyU(m_defaultFloat), unaccountedHitEnergyV(m_defaultFloat), unaccountedHitEnergyW(m_defaultFloat);
 
-    if (this->GetViewAmbiguousHitVariables(pAlgorithm, protoShowerMatch, TPC_VIEW_U, nuVertex3D, unaccountedHitEnergyU))
+    if (this->GetViewAmbiguousHitVariables(pAlgorithm, protoShowerMatch, TPC_VIEW_U, nuVertex3D, viewHitSnapshotMap, unaccountedHitEnergyU))
         maxUnaccountedEnergy = std::max(maxUnaccountedEnergy, unaccountedHitEnergyU);
 
-    if (this->GetViewAmbiguousHitVariables(pAlgorithm, protoShowerMatch, TPC_VIEW_V, nuVertex3D, unaccountedHitEnergyV))
+    if (this->GetViewAmbiguousHitVariables(pAlgorithm, protoShowerMatch, TPC_VIEW_V, nuVertex3D, viewHitSnapshotMap, unaccountedHitEnergyV))
         maxUnaccountedEnergy = std::max(maxUnaccountedEnergy, unaccountedHitEnergyV);
 
-    if (this->GetViewAmbiguousHitVariables(pAlgorithm, protoShowerMatch, TPC_VIEW_W, nuVertex3D, unaccountedHitEnergyW))
+    if (this->GetViewAmbiguousHitVariables(pAlgorithm, protoShowerMatch, TPC_VIEW_W, nuVertex3D, viewHitSnapshotMap, unaccountedHitEnergyW))
         maxUnaccountedEnergy = std::max(maxUnaccountedEnergy, unaccountedHitEnergyW);
 
     featureVector.push_back(nAmbiguousViews);
@@ -908,10 +927,11 @@ void AmbiguousRegionFeatureTool::Run(LArMvaHelper::MvaFeatureVector &featureVect
 
 void AmbiguousRegionFeatureTool::Run(LArMvaHelper::MvaFeatureMap &featureMap, StringVector &featureOrder,
     const std::string &featureToolName, const Algorithm *const pAlgorithm, const ParticleFlowObject *const pShowerPfo,
-    const CartesianVector &nuVertex3D, const ProtoShowerMatch &protoShowerMatch, const CartesianPointVector &showerStarts3D)
+    const CartesianVector &nuVertex3D, const ProtoShowerMatch &protoShowerMatch, const CartesianPointVector &showerStarts3D,
+    const ViewHitSnapshotMap &viewHitSnapshotMap)
 {
     LArMvaHelper::MvaFeatureVector toolFeatureVec;
-    this->Run(toolFeatureVec, pAlgorithm, pShowerPfo, nuVertex3D, protoShowerMatch, showerStarts3D);
+    this->Run(toolFeatureVec, pAlgorithm, pShowerPfo, nuVertex3D, protoShowerMatch, showerStarts3D, viewHitSnapshotMap);
 
     if (featureMap.find(featureToolName + "_nAmbiguousViews") != featureMap.end())
     {
@@ -934,6 +954,13 @@ void AmbiguousRegionFeatureTool::Run(LArMvaHelper::MvaFeatureMap &featureMap, St
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+bool AmbiguousRegionFeatureTool::IsThreadSafe() const
+{
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void AmbiguousRegionFeatureTool::CalculateNAmbiguousViews(const ProtoShowerMatch &protoShowerMatch, float &nAmbiguousViews)
 {
     nAmbiguousViews = 0.f;
@@ -951,7 +978,7 @@ void AmbiguousRegionFeatureTool::CalculateNAmbiguousViews(const ProtoShowerMatch
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 bool AmbiguousRegionFeatureTool::GetViewAmbiguousHitVariables(const Algorithm *const pAlgorithm, const ProtoShowerMatch &protoShowerMatch,
-    const HitType hitType, const CartesianVector &nuVertex3D, float &unaccountedHitEnergy)
+    const HitType hitType, const CartesianVector &nuVertex3D, const ViewHitSnapshotMap &viewHitSnapshotMap, float &unaccountedHitEnergy)
 {
     std::map<int, CaloHitList> ambiguousHitSpines;
     CaloHitList hitsToExcludeInEnergyCalcs; // to avoid double  counting
@@ -960,7 +987,7 @@ bool AmbiguousRegionFeatureTool::GetViewAmbiguousHitVariables(const Algorithm *c
             ? protoShowerMatch.GetProtoShowerU()
             : (hitType == TPC_VIEW_V ? protoShowerMatch.GetProtoShowerV() : protoShowerMatch.GetProtoShowerW()));
 
-    this->BuildAmbiguousSpines(pAlgorithm, hitType, protoShower, nuVertex2D, ambiguousHitSpines, hitsToExcludeInEnergyCalcs);
+    this->BuildAmbiguousSpines(hitType, protoShower, nuVertex2D, viewHitSnapshotMap, ambiguousHitSpines, hitsToExcludeInEnergyCalcs);
 
     if (ambiguousHitSpines.empty())
         return false;
@@ -1037,18 +1064,22 @@ bool AmbiguousRegionFeatureTool::GetViewAmbiguousHitVariables(const Algorithm *c
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void AmbiguousRegionFeatureTool::BuildAmbiguousSpines(const Algorithm *const pAlgorithm, const HitType hitType, const ProtoShower &protoShower,
-    const CartesianVector &nuVertex2D, std::map<int, CaloHitList> &ambiguousHitSpines, CaloHitList &hitsToExcludeInEnergyCalcs)
+void AmbiguousRegionFeatureTool::BuildAmbiguousSpines(const HitType hitType, const ProtoShower &protoShower,
+    const CartesianVector &nuVertex2D, const ViewHitSnapshotMap &viewHitSnapshotMap, std::map<int, CaloHitList> &ambiguousHitSpines,
+    CaloHitList &hitsToExcludeInEnergyCalcs)
 {
-    const CaloHitList *pCaloHitList;
+    const HitSnapshot *pHitSnapshot(nullptr);
 
-    if (this->GetHitListOfType(pAlgorithm, hitType, pCaloHitList) != STATUS_CODE_SUCCESS)
+    if (this->GetHitSnapshotOfType(viewHitSnapshotMap, hitType, pHitSnapshot) != STATUS_CODE_SUCCESS)
         return;
 
+    const CaloHitVector &caloHitVector(pHitSnapshot->GetCaloHitVector());
     std::map<int, CaloHitList> ambiguousHitSpinesTemp;
 
-    for (const CaloHit *const pCaloHit : *pCaloHitList)
+    for (unsigned int index = 0; index < caloHitVector.size(); ++index)
     {
+        const CaloHit *const pCaloHit(caloHitVector[index]);
+
         if (std::find(protoShower.GetAmbiguousHitList().begin(), protoShower.GetAmbiguousHitList().end(), pCaloHit) !=
             protoShower.GetAmbiguousHitList().end())
             continue;
@@ -1058,12 +1089,7 @@ void AmbiguousRegionFeatureTool::BuildAmbiguousSpines(const Algorithm *const pAl
         // A hit can be in more than one spine
         for (unsigned int i = 0; i < protoShower.GetAmbiguousDirectionVector().size(); ++i)
         {
-            const CartesianVector &significantDirection(protoShower.GetAmbiguousDirectionVector()[i]);
-            const CartesianVector displacement(pCaloHit->GetPositionVector() - nuVertex2D);
-            const float thisT(significantDirection.GetCrossProduct(displacement).GetMagnitude());
-            const float thisL(significantDirection.GetDotProduct(displacement));
-
-            if ((thisL > 0.f) && (thisT < m_maxTransverseDistance))
+            if (pHitSnapshot->IsAlongAxis(index, nuVertex2D, protoShower.GetAmbiguousDirectionVector()[i], m_maxTransverseDistance))
             {
                 ++count;
                 ambiguousHitSpinesTemp[i].push_back(pCaloHit);
@@ -1089,18 +1115,17 @@ void AmbiguousRegionFeatureTool::BuildAmbiguousSpines(const Algorithm *const pAl
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-StatusCode AmbiguousRegionFeatureTool::GetHitListOfType(const Algorithm *const pAlgorithm, const HitType hitType, const CaloHitList *&pCaloHitList) const
+StatusCode AmbiguousRegionFeatureTool::GetHitSnapshotOfType(
+    const ViewHitSnapshotMap &viewHitSnapshotMap, const HitType hitType, const HitSnapshot *&pHitSnapshot) const
 {
-    const std::string typeHitListName(hitType == TPC_VIEW_U ? m_caloHitListNameU
-            : hitType == TPC_VIEW_V                         ? m_caloHitListNameV
-                                                            : m_caloHitListNameW);
+    // ATTN The event hit snapshots are built by the calling algorithm, as the list manager may not be queried concurrently
+    const ViewHitSnapshotMap::const_iterator iter(viewHitSnapshotMap.find(hitType));
 
-    PANDORA_THROW_RESULT_IF_AND_IF(
-        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_INITIALIZED, !=, PandoraContentApi::GetList(*pAlgorithm, typeHitListName, pCaloHitList));
-
-    if (!pCaloHitList || pCaloHitList->empty())
+    if ((viewHitSnapshotMap.end() == iter) || iter->second.GetCaloHitList().empty())
         return STATUS_CODE_NOT_INITIALIZED;
 
+    pHitSnapshot = &iter->second;
+
     return STATUS_CODE_SUCCESS;
 }
 
@@ -1165,15 +1190,6 @@ StatusCode AmbiguousRegionFeatureTool::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "DefaultFloat", m_defaultFloat));
 
-    PANDORA_RETURN_RESULT_IF_AND_IF(
-        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "CaloHitListNameU", m_caloHitListNameU));
-
-    PANDORA_RETURN_RESULT_IF_AND_IF(
-        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "CaloHitListNameV", m_caloHitListNameV));
-
-    PANDORA_RETURN_RESULT_IF_AND_IF(
-        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "CaloHitListNameW", m_caloHitListNameW));
-
     PANDORA_RETURN_RESULT_IF_AND_IF(
         STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "MaxTransverseDistance", m_maxTransverseDistance));
 
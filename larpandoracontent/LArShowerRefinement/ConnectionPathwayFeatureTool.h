@@ -12,6 +12,7 @@
 
 #include "larpandoracontent/LArHelpers/LArMvaHelper.h"
 
+#include "larpandoracontent/LArObjects/LArHitSnapshot.h"
 #include "larpandoracontent/LArObjects/LArTwoDSlidingFitResult.h"
 
 #include "larpandoracontent/LArShowerRefinement/LArProtoShower.h"
@@ -19,7 +20,11 @@
 namespace lar_content
 {
 
-typedef MvaFeatureTool<const pandora::Algorithm *const, const pandora::ParticleFlowObject *const, const pandora::CartesianVector &, const ProtoShowerMatch &, const pandora::CartesianPointVector &> ConnectionPathwayFeatureTool;
+typedef std::map<pandora::HitType, HitSnapshot> ViewHitSnapshotMap;
+
+typedef MvaFeatureTool<const pandora::Algorithm *const, const pandora::ParticleFlowObject *const, const pandora::CartesianVector &,
+    const ProtoShowerMatch &, const pandora::CartesianPointVector &, const ViewHitSnapshotMap &>
+    ConnectionPathwayFeatureTool;
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -36,11 +41,20 @@ public:
 
     void Run(LArMvaHelper::MvaFeatureVector &featureVector, const pandora::Algorithm *const pAlgorithm,
         const pandora::ParticleFlowObject *const pShowerPfo, const pandora::CartesianVector &nuVertex3D,
-        const ProtoShowerMatch &protoShowerMatch, const pandora::CartesianPointVector &showerStarts3D);
+        const ProtoShowerMatch &protoShowerMatch, const pandora::CartesianPointVector &showerStarts3D,
+        const ViewHitSnapshotMap &viewHitSnapshotMap);
 
     void Run(LArMvaHelper::MvaFeatureMap &featureMap, pandora::StringVector &featureOrder, const std::string &featureToolName,
         const pandora::Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pShowerPfo, const pandora::CartesianVector &nuVertex3D,
-        const ProtoShowerMatch &protoShowerMatch, const pandora::CartesianPointVector &showerStarts3D);
+        const ProtoShowerMatch &protoShowerMatch, const pandora::CartesianPointVector &showerStarts3D,
+        const ViewHitSnapshotMap &viewHitSnapshotMap);
+
+    /**
+     *  @brief  Whether the tool may be run concurrently for different showers
+     *
+     *  @return boolean
+     */
+    bool IsThreadSafe() const;
 
 private:
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
@@ -79,11 +93,20 @@ public:
 
     void Run(LArMvaHelper::MvaFeatureVector &featureVector, const pandora::Algorithm *const pAlgorithm,
         const pandora::ParticleFlowObject *const pShowerPfo, const pandora::CartesianVector &nuVertex3D,
-        const ProtoShowerMatch &protoShowerMatch, const pandora::CartesianPointVector &showerStarts3D);
+        const ProtoShowerMatch &protoShowerMatch, const pandora::CartesianPointVector &showerStarts3D,
+        const ViewHitSnapshotMap &viewHitSnapshotMap);
 
     void Run(LArMvaHelper::MvaFeatureMap &featureMap, pandora::StringVector &featureOrder, const std::string &featureToolName,
         const pandora::Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pShowerPfo, const pandora::CartesianVector &nuVertex3D,
-        const ProtoShowerMatch &protoShowerMatch, const pandora::CartesianPointVector &showerStarts3D);
+        const ProtoShowerMatch &protoShowerMatch, const pandora::CartesianPointVector &showerStarts3D,
+        const ViewHitSnapshotMap &viewHitSnapshotMap);
+
+    /**
+     *  @brief  Whether the tool may be run concurrently for different showers
+     *
+     *  @return boolean
+     */
+    bool IsThreadSafe() const;
 
 private:
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
@@ -135,11 +158,20 @@ public:
 
     void Run(LArMvaHelper::MvaFeatureVector &featureVector, const pandora::Algorithm *const pAlgorithm,
         const pandora::ParticleFlowObject *const pShowerPfo, const pandora::CartesianVector &nuVertex3D,
-        const ProtoShowerMatch &protoShowerMatch, const pandora::CartesianPointVector &showerStarts3D);
+        const ProtoShowerMatch &protoShowerMatch, const pandora::CartesianPointVector &showerStarts3D,
+        const ViewHitSnapshotMap &viewHitSnapshotMap);
 
     void Run(LArMvaHelper::MvaFeatureMap &featureMap, pandora::StringVector &featureOrder, const std::string &featureToolName,
         const pandora::Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pShowerPfo, const pandora::CartesianVector &nuVertex3D,
-        const ProtoShowerMatch &protoShowerMatch, const pandora::CartesianPointVector &showerStarts3D);
+        const ProtoShowerMatch &protoShowerMatch, const pandora::CartesianPointVector &showerStarts3D,
+        const ViewHitSnapshotMap &viewHitSnapshotMap);
+
+    /**
+     *  @brief  Whether the tool may be run concurrently for different showers
+     *
+     *  @return boolean
+     */
+    bool IsThreadSafe() const;
 
 private:
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
@@ -275,11 +307,20 @@ public:
 
     void Run(LArMvaHelper::MvaFeatureVector &featureVector, const pandora::Algorithm *const pAlgorithm,
         const pandora::ParticleFlowObject *const pShowerPfo, const pandora::CartesianVector &nuVertex3D,
-        const ProtoShowerMatch &protoShowerMatch, const pandora::CartesianPointVector &showerStarts3D);
+        const ProtoShowerMatch &protoShowerMatch, const pandora::CartesianPointVector &showerStarts3D,
+        const ViewHitSnapshotMap &viewHitSnapshotMap);
 
     void Run(LArMvaHelper::MvaFeatureMap &featureMap, pandora::StringVector &featureOrder, const std::string &featureToolName,
         const pandora::Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pShowerPfo, const pandora::CartesianVector &nuVertex3D,
-        const ProtoShowerMatch &protoShowerMatch, const pandora::CartesianPointVector &showerStarts3D);
+        const ProtoShowerMatch &protoShowerMatch, const pandora::CartesianPointVector &showerStarts3D,
+        const ViewHitSnapshotMap &viewHitSnapshotMap);
+
+    /**
+     *  @brief  Whether the tool may be run concurrently for different showers
+     *
+     *  @return boolean
+     */
+    bool IsThreadSafe() const;
 
 private:
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
@@ -299,38 +340,40 @@ private:
      *  @param  protoShowerMatch the ProtoShower match
      *  @param  hitType the 2D view
      *  @param  nuVertex3D the 3D neutrino vertex
+     *  @param  viewHitSnapshotMap the per-view event hit snapshots
      *  @param  unaccountedHitEnergy the output unaccounted hit energy
      *
      *  @return whether the ambiguous region variables could be calculated
      */
     bool GetViewAmbiguousHitVariables(const pandora::Algorithm *const pAlgorithm, const ProtoShowerMatch &protoShowerMatch,
-        const pandora::HitType hitType, const pandora::CartesianVector &nuVertex3D, float &unaccountedHitEnergy);
+        const pandora::HitType hitType, const pandora::CartesianVector &nuVertex3D, const ViewHitSnapshotMap &viewHitSnapshotMap,
+        float &unaccountedHitEnergy);
 
     /**
      *  @brief  Determine the spine hits of the particles with which the ambiguous hits are shared
      *
-     *  @param  pAlgorithm the algorithm
      *  @param  hitType the 2D view
      *  @param  protoShower the ProtoShower
      *  @param  nuVertex2D the 2D neutrino vertex
+     *  @param  viewHitSnapshotMap the per-view event hit snapshots
      *  @param  ambiguousHitSpines the output [particle index -> shower spine hits] map
      *  @param  hitsToExcludeInEnergyCalcs the list of hits to exclude in energy calculations
      */
-    void BuildAmbiguousSpines(const pandora::Algorithm *const pAlgorithm, const pandora::HitType hitType, const ProtoShower &protoShower,
-        const pandora::CartesianVector &nuVertex2D, std::map<int, pandora::CaloHitList> &ambiguousHitSpines,
+    void BuildAmbiguousSpines(const pandora::HitType hitType, const ProtoShower &protoShower, const pandora::CartesianVector &nuVertex2D,
+        const ViewHitSnapshotMap &viewHitSnapshotMap, std::map<int, pandora::CaloHitList> &ambiguousHitSpines,
         pandora::CaloHitList &hitsToExcludeInEnergyCalcs);
 
     /**
-     *  @brief  Obtain the event hit list of a given view
+     *  @brief  Obtain the event hit snapshot of a given view
      *
-     *  @param  pAlgorithm the algorithm
+     *  @param  viewHitSnapshotMap the per-view event hit snapshots
      *  @param  hitType the 2D view
-     *  @param  pCaloHitList the output 2D hit list
+     *  @param  pHitSnapshot the output 2D hit snapshot
      *
-     *  @return whether a valid 2D hit list could be found
+     *  @return whether a valid 2D hit snapshot could be found
      */
-    pandora::StatusCode GetHitListOfType(
-        const pandora::Algorithm *const pAlgorithm, const pandora::HitType hitType, const pandora::CaloHitList *&pCaloHitList) const;
+    pandora::StatusCode GetHitSnapshotOfType(
+        const ViewHitSnapshotMap &viewHitSnapshotMap, const pandora::HitType hitType, const HitSnapshot *&pHitSnapshot) const;
 
     /**
      *  @brief  Determine a continuous pathway of an ambigous particle's spine hits
@@ -344,14 +387,11 @@ private:
     pandora::CaloHitList FindAmbiguousContinuousSpine(
         const pandora::CaloHitList &caloHitList, const pandora::CaloHitList &ambiguousHitList, const pandora::CartesianVector &nuVertex2D);
 
-    float m_defaultFloat;           ///< Default float value
-    std::string m_caloHitListNameU; ///< The event U view hit list
-    std::string m_caloHitListNameV; ///< The event V view hit list
-    std::string m_caloHitListNameW; ///< The event W view hit list
-    float m_maxTransverseDistance;  ///< The max. proximity of a hits, included in a trajectory energy calcs.
-    unsigned int m_maxSampleHits;   ///< The max. number of hits considered in the spine energy calcs.
-    float m_maxHitSeparation;       ///< The max. separation of connected hits
-    float m_maxTrackFraction;       ///< The fraction of found hits which are considered in the energy calcs.
+    float m_defaultFloat;          ///< Default float value
+    float m_maxTransverseDistance; ///< The max. proximity of a hits, included in a trajectory energy calcs.
+    unsigned int m_maxSampleHits;  ///< The max. number of hits considered in the spine energy calcs.
+    float m_maxHitSeparation;      ///< The max. separation of connected hits
+    float m_maxTrackFraction;      ///< The fraction of found hits which are considered in the energy calcs.
 };
 
 } // namespace lar_content
@@ -15,6 +15,7 @@
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
 #include "larpandoracontent/LArHelpers/LArMCParticleHelper.h"
 #include "larpandoracontent/LArHelpers/LArMvaHelper.h"
+#include "larpandoracontent/LArHelpers/LArParallelHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
 
 #include "larpandoracontent/LArShowerRefinement/ElectronInitialRegionRefinementAlgorithm.h"
@@ -36,6 +37,7 @@ ElectronInitialRegionRefinementAlgorithm::ElectronInitialRegionRefinementAlgorit
     m_minSpinePurity(0.7f),
     m_trainingMode(false),
     m_trainingFileName("ConnectionPathwayTrain.txt"),
+    m_trainingOutputFormat(LArMvaHelper::TRAINING_OUTPUT_CSV),
     m_unambiguousThreshold(0.5f),
     m_maxConnectionDistance(1.f),
     m_minNConnectedHits(2),
@@ -43,7 +45,9 @@ ElectronInitialRegionRefinementAlgorithm::ElectronInitialRegionRefinementAlgorit
     m_minElectronPurity(0.5f),
     m_maxSeparationFromHit(3.f),
     m_maxProjectionSeparation(5.f),
-    m_maxXSeparation(0.5f)
+    m_maxXSeparation(0.5f),
+    m_hitGridCellSize(2.f),
+    m_maxShowerThreads(1)
 {
 }
 
@@ -57,18 +61,58 @@ StatusCode ElectronInitialRegionRefinementAlgorithm::Run()
     if (showerPfoVector.empty())
         return STATUS_CODE_SUCCESS;
 
+    CartesianVector nuVertex3D(0.f, 0.f, 0.f);
+
+    if (this->GetNeutrinoVertex(nuVertex3D) != STATUS_CODE_SUCCESS)
+        return STATUS_CODE_SUCCESS;
+
+    // Only consider significant showers
+    PfoVector significantShowerPfoVector;
+
     for (const ParticleFlowObject *const pShowerPfo : showerPfoVector)
     {
-        // Only consider significant showers
         CaloHitList caloHits3D;
         LArPfoHelper::GetCaloHits(pShowerPfo, TPC_3D, caloHits3D);
 
-        if (caloHits3D.size() < m_minShowerHits3D)
-            continue;
+        if (caloHits3D.size() >= m_minShowerHits3D)
+            significantShowerPfoVector.push_back(pShowerPfo);
+    }
 
-        this->RefineShower(pShowerPfo);
+    // Obtain, index and snapshot the event hits of each view once, on this thread, for use by the pathway finding and feature tools
+    m_caloHitGridMap.clear();
+    m_hitSnapshotMap.clear();
+
+    for (const HitType hitType : {TPC_VIEW_U, TPC_VIEW_V, TPC_VIEW_W})
+    {
+        const CaloHitList *pViewHitList(nullptr);
+
+        if (this->GetHitListOfType(hitType, pViewHitList) == STATUS_CODE_SUCCESS)
+        {
+            m_caloHitGridMap.emplace(hitType, CaloHitGrid(pViewHitList, m_hitGridCellSize));
+            m_hitSnapshotMap.emplace(hitType, HitSnapshot(pViewHitList));
+        }
     }
 
+    // ATTN Showers are analysed concurrently into per-shower slots, without modifying the event, then committed serially and in order
+    ShowerFeaturesVector showerFeaturesVector(significantShowerPfoVector.size());
+    const unsigned int maxThreads(this->AreFeatureToolsThreadSafe() ? m_maxShowerThreads : 1);
+
+    LArParallelHelper::ForEachIndex(significantShowerPfoVector.size(), maxThreads, [&](const size_t index) {
+        this->AnalyseShower(significantShowerPfoVector.at(index), nuVertex3D, showerFeaturesVector.at(index));
+    });
+
+    // To truth match electrons
+    HitOwnershipMap electronHitMap;
+
+    if (m_trainingMode)
+        this->FillElectronHitMap(electronHitMap);
+
+    for (size_t index = 0; index < significantShowerPfoVector.size(); ++index)
+        this->CommitShowerFeatures(significantShowerPfoVector.at(index), showerFeaturesVector.at(index), electronHitMap);
+
+    m_caloHitGridMap.clear();
+    m_hitSnapshotMap.clear();
+
     return STATUS_CODE_SUCCESS;
 }
 
@@ -94,13 +138,23 @@ void ElectronInitialRegionRefinementAlgorithm::FillShowerPfoVector(PfoVector &sh
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void ElectronInitialRegionRefinementAlgorithm::RefineShower(const ParticleFlowObject *const pShowerPfo) const
+bool ElectronInitialRegionRefinementAlgorithm::AreFeatureToolsThreadSafe() const
 {
-    CartesianVector nuVertex3D(0.f, 0.f, 0.f);
+    // ATTN The pathway finding and matching tools read only their configuration and arguments, so only the feature tools are checked
+    for (const auto &mapEntry : m_featureToolMap)
+    {
+        if (!mapEntry.second->IsThreadSafe())
+            return false;
+    }
 
-    if (this->GetNeutrinoVertex(nuVertex3D) != STATUS_CODE_SUCCESS)
-        return;
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
 
+void ElectronInitialRegionRefinementAlgorithm::AnalyseShower(
+    const ParticleFlowObject *const pShowerPfo, const CartesianVector &nuVertex3D, PathwayFeaturesVector &pathwayFeaturesVector) const
+{
     // Create the 2D connetion pathways
     ProtoShowerVector protoShowerVectorU, protoShowerVectorV, protoShowerVectorW;
 
@@ -112,9 +166,6 @@ void ElectronInitialRegionRefinementAlgorithm::RefineShower(const ParticleFlowOb
     ProtoShowerMatchVector protoShowerMatchVector;
     m_pProtoShowerMatchingTool->Run(protoShowerVectorU, protoShowerVectorV, protoShowerVectorW, protoShowerMatchVector);
 
-    if (protoShowerMatchVector.empty())
-        return;
-
     for (ProtoShowerMatch &protoShowerMatch : protoShowerMatchVector)
     {
         // Remove ambiguous hits from hits to add list
@@ -137,26 +188,31 @@ void ElectronInitialRegionRefinementAlgorithm::RefineShower(const ParticleFlowOb
         }
 
         // Fill BDT information
-        StringVector featureOrder;
-        const LArMvaHelper::MvaFeatureMap featureMap(LArMvaHelper::CalculateFeatures(
-            m_algorithmToolNames, m_featureToolMap, featureOrder, this, pShowerPfo, nuVertex3D, protoShowerMatch, showerStarts3D));
+        PathwayFeatures pathwayFeatures;
+        pathwayFeatures.m_featureMap = LArMvaHelper::CalculateFeatures(m_algorithmToolNames, m_featureToolMap,
+            pathwayFeatures.m_featureOrder, this, pShowerPfo, nuVertex3D, protoShowerMatch, showerStarts3D, m_hitSnapshotMap);
 
-        this->SetMetadata(pShowerPfo, featureMap);
+        pathwayFeaturesVector.push_back(pathwayFeatures);
 
+        // In training mode, only the first pathway with features is used
         if (m_trainingMode)
-        {
-            // To truth match electrons
-            HitOwnershipMap electronHitMap;
-            this->FillElectronHitMap(electronHitMap);
+            break;
+    }
+}
 
-            if (this->IsElectron(pShowerPfo, electronHitMap))
-            {
-                LArMvaHelper::ProduceTrainingExample(m_trainingFileName, true, featureOrder, featureMap);
-                break;
-            }
+//------------------------------------------------------------------------------------------------------------------------------------------
 
-            LArMvaHelper::ProduceTrainingExample(m_trainingFileName, false, featureOrder, featureMap);
+void ElectronInitialRegionRefinementAlgorithm::CommitShowerFeatures(const ParticleFlowObject *const pShowerPfo,
+    const PathwayFeaturesVector &pathwayFeaturesVector, const HitOwnershipMap &electronHitMap) const
+{
+    for (const PathwayFeatures &pathwayFeatures : pathwayFeaturesVector)
+    {
+        this->SetMetadata(pShowerPfo, pathwayFeatures.m_featureMap);
 
+        if (m_trainingMode)
+        {
+            LArMvaHelper::ProduceTrainingExample(m_trainingFileName, this->IsElectron(pShowerPfo, electronHitMap),
+                pathwayFeatures.m_featureOrder, pathwayFeatures.m_featureMap, m_trainingOutputFormat);
             break;
         }
     }
@@ -191,9 +247,9 @@ StatusCode ElectronInitialRegionRefinementAlgorithm::GetNeutrinoVertex(Cartesian
 void ElectronInitialRegionRefinementAlgorithm::BuildViewProtoShowers(const ParticleFlowObject *const pShowerPfo,
     const CartesianVector &nuVertex3D, HitType hitType, ProtoShowerVector &protoShowerVector) const
 {
-    const CaloHitList *pViewHitList(nullptr);
+    const CaloHitGrid *pViewHitGrid(nullptr);
 
-    if (this->GetHitListOfType(hitType, pViewHitList) != STATUS_CODE_SUCCESS)
+    if (this->GetHitGridOfType(hitType, pViewHitGrid) != STATUS_CODE_SUCCESS)
         return;
 
     CartesianVector showerVertexPosition(0.f, 0.f, 0.f);
@@ -208,7 +264,7 @@ void ElectronInitialRegionRefinementAlgorithm::BuildViewProtoShowers(const Parti
 
     // Determine directions of pathways out of neutrino vertex
     CartesianPointVector peakDirectionVector;
-    if (m_pShowerPeakDirectionFinderTool->Run(pShowerPfo, nuVertex3D, pViewHitList, hitType, peakDirectionVector) != STATUS_CODE_SUCCESS)
+    if (m_pShowerPeakDirectionFinderTool->Run(pShowerPfo, nuVertex3D, *pViewHitGrid, hitType, peakDirectionVector) != STATUS_CODE_SUCCESS)
         return;
 
     // Investigate each direction
@@ -217,7 +273,8 @@ void ElectronInitialRegionRefinementAlgorithm::BuildViewProtoShowers(const Parti
     {
         // Collect the hits associated with the pathway (the shower spine)
         CaloHitList showerSpineHitList;
-        if (m_pShowerSpineFinderTool->Run(nuVertex3D, pViewHitList, hitType, peakDirection, unavailableHitList, showerSpineHitList) != STATUS_CODE_SUCCESS)
+        if (m_pShowerSpineFinderTool->Run(nuVertex3D, *pViewHitGrid, hitType, peakDirection, unavailableHitList, showerSpineHitList) !=
+            STATUS_CODE_SUCCESS)
             continue;
 
         this->RefineShowerVertex(pShowerPfo, hitType, nuVertex3D, peakDirection, showerVertexPosition);
@@ -286,6 +343,20 @@ StatusCode ElectronInitialRegionRefinementAlgorithm::GetHitListOfType(const HitT
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode ElectronInitialRegionRefinementAlgorithm::GetHitGridOfType(const HitType hitType, const CaloHitGrid *&pCaloHitGrid) const
+{
+    const CaloHitGridMap::const_iterator iter(m_caloHitGridMap.find(hitType));
+
+    if (m_caloHitGridMap.end() == iter)
+        return STATUS_CODE_NOT_INITIALIZED;
+
+    pCaloHitGrid = &iter->second;
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 CartesianVector ElectronInitialRegionRefinementAlgorithm::GetShowerVertex(
     const ParticleFlowObject *const pShowerPfo, const HitType hitType, const CartesianVector &nuVertex3D) const
 {
@@ -404,14 +475,14 @@ bool ElectronInitialRegionRefinementAlgorithm::IsSpineCoincident(const ParticleF
 void ElectronInitialRegionRefinementAlgorithm::BuildViewPathways(const ParticleFlowObject *const pShowerPfo,
     const CaloHitList &protectedHits, const CartesianVector &nuVertex3D, HitType hitType, ConnectionPathwayVector &viewPathways) const
 {
-    const CaloHitList *pViewHitList(nullptr);
+    const CaloHitGrid *pViewHitGrid(nullptr);
 
-    if (this->GetHitListOfType(hitType, pViewHitList) != STATUS_CODE_SUCCESS)
+    if (this->GetHitGridOfType(hitType, pViewHitGrid) != STATUS_CODE_SUCCESS)
         return;
 
     // Get the peak direction vector
     CartesianPointVector eventPeakDirectionVector;
-    m_pEventPeakDirectionFinderTool->Run(pShowerPfo, nuVertex3D, pViewHitList, hitType, eventPeakDirectionVector);
+    m_pEventPeakDirectionFinderTool->Run(pShowerPfo, nuVertex3D, *pViewHitGrid, hitType, eventPeakDirectionVector);
 
     CaloHitList unavailableHitList(protectedHits);
     LArPfoHelper::GetCaloHits(pShowerPfo, hitType, unavailableHitList);
@@ -419,7 +490,8 @@ void ElectronInitialRegionRefinementAlgorithm::BuildViewPathways(const ParticleF
     for (CartesianVector &eventPeakDirection : eventPeakDirectionVector)
     {
         CaloHitList pathwayHitList;
-        if (m_pEventPathwayFinderTool->Run(nuVertex3D, pViewHitList, hitType, eventPeakDirection, unavailableHitList, pathwayHitList) != STATUS_CODE_SUCCESS)
+        if (m_pEventPathwayFinderTool->Run(nuVertex3D, *pViewHitGrid, hitType, eventPeakDirection, unavailableHitList, pathwayHitList) !=
+            STATUS_CODE_SUCCESS)
             continue;
 
         const CartesianVector nuVertex2D(LArGeometryHelper::ProjectPosition(this->GetPandora(), nuVertex3D, hitType));
@@ -671,6 +743,14 @@ bool ElectronInitialRegionRefinementAlgorithm::IsElectron(const ParticleFlowObje
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode ElectronInitialRegionRefinementAlgorithm::Reset()
+{
+    LArMvaHelper::FlushTrainingExamples();
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode ElectronInitialRegionRefinementAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "ShowerPfoListName", m_showerPfoListName));
@@ -736,6 +816,8 @@ StatusCode ElectronInitialRegionRefinementAlgorithm::ReadSettings(const TiXmlHan
     PANDORA_RETURN_RESULT_IF_AND_IF(
         STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "TrainingFileName", m_trainingFileName));
 
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArMvaHelper::ReadTrainingOutputFormat(xmlHandle, m_trainingOutputFormat));
+
     PANDORA_RETURN_RESULT_IF_AND_IF(
         STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "UnambiguousThreshold", m_unambiguousThreshold));
 
@@ -759,6 +841,12 @@ StatusCode ElectronInitialRegionRefinementAlgorithm::ReadSettings(const TiXmlHan
 
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "MaxXSeparation", m_maxXSeparation));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "HitGridCellSize", m_hitGridCellSize));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "MaxShowerThreads", m_maxShowerThreads));
+
     AlgorithmToolVector algorithmToolVector;
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ProcessAlgorithmToolList(*this, xmlHandle, "FeatureTools", algorithmToolVector));
 
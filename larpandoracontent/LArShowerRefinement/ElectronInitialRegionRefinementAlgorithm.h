@@ -10,6 +10,9 @@
 
 #include "Pandora/Algorithm.h"
 
+#include "larpandoracontent/LArObjects/LArCaloHitGrid.h"
+#include "larpandoracontent/LArObjects/LArHitSnapshot.h"
+
 #include "larpandoracontent/LArShowerRefinement/ConnectionPathwayFeatureTool.h"
 #include "larpandoracontent/LArShowerRefinement/LArProtoShower.h"
 #include "larpandoracontent/LArShowerRefinement/PeakDirectionFinderTool.h"
@@ -32,8 +35,22 @@ public:
     ElectronInitialRegionRefinementAlgorithm();
 
 private:
+    /**
+     *  @brief  PathwayFeatures class, the features of a matched connection pathway of a shower
+     */
+    class PathwayFeatures
+    {
+    public:
+        pandora::StringVector m_featureOrder;     ///< The feature order
+        LArMvaHelper::MvaFeatureMap m_featureMap; ///< The feature map
+    };
+
+    typedef std::vector<PathwayFeatures> PathwayFeaturesVector;
+    typedef std::vector<PathwayFeaturesVector> ShowerFeaturesVector;
     typedef std::map<const pandora::MCParticle *, pandora::CaloHitList> HitOwnershipMap;
+    typedef std::map<pandora::HitType, CaloHitGrid> CaloHitGridMap;
 
+    pandora::StatusCode Reset();
     pandora::StatusCode Run();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
@@ -45,11 +62,32 @@ private:
     void FillShowerPfoVector(pandora::PfoVector &showerPfoVector) const;
 
     /**
-     *  @brief  Find and evaluate shower connection pathway, removing if necessary
+     *  @brief  Whether all feature tools may be run concurrently for different showers
+     *
+     *  @return boolean
+     */
+    bool AreFeatureToolsThreadSafe() const;
+
+    /**
+     *  @brief  Find the shower connection pathways and calculate their features. Only reads the event, so may be called concurrently
+     *          for different showers if all feature tools are thread safe
+     *
+     *  @param  pShowerPfo the input shower pfo
+     *  @param  nuVertex3D the 3D neutrino vertex
+     *  @param  pathwayFeaturesVector to receive the features of each matched connection pathway, in match order
+     */
+    void AnalyseShower(const pandora::ParticleFlowObject *const pShowerPfo, const pandora::CartesianVector &nuVertex3D,
+        PathwayFeaturesVector &pathwayFeaturesVector) const;
+
+    /**
+     *  @brief  Record the connection pathway features of a shower in its metadata and, in training mode, write the training example
      *
      *  @param  pShowerPfo the input shower pfo
+     *  @param  pathwayFeaturesVector the features of each matched connection pathway, in match order
+     *  @param  electronHitMap the mapping of [MCParticle leading electrons -> their associated hits], filled in training mode only
      */
-    void RefineShower(const pandora::ParticleFlowObject *const pShowerPfo) const;
+    void CommitShowerFeatures(const pandora::ParticleFlowObject *const pShowerPfo, const PathwayFeaturesVector &pathwayFeaturesVector,
+        const HitOwnershipMap &electronHitMap) const;
 
     /**
      *  @brief  Obtain the reconstructed neutrino vertex
@@ -81,6 +119,16 @@ private:
      */
     pandora::StatusCode GetHitListOfType(const pandora::HitType hitType, const pandora::CaloHitList *&pCaloHitList) const;
 
+    /**
+     *  @brief  Obtain the grid index over the event hits of a given view, built at the start of the event
+     *
+     *  @param  hitType the 2D view
+     *  @param  pCaloHitGrid the output 2D hit grid
+     *
+     *  @return whether a valid 2D hit grid could be found
+     */
+    pandora::StatusCode GetHitGridOfType(const pandora::HitType hitType, const CaloHitGrid *&pCaloHitGrid) const;
+
     /**
      *  @brief  Fit the shower to obtain a 2D shower vertex
      *
@@ -204,6 +252,7 @@ private:
     float m_minSpinePurity;                     ///< The min. purity of a coincident shower spine downstream of the shower vertex
     bool m_trainingMode;                        ///< Whether to run the algorithm to train the BDT
     std::string m_trainingFileName;             ///< The name of the output training file name
+    LArMvaHelper::TrainingOutputFormat m_trainingOutputFormat; ///< The format of the output training file
     float m_unambiguousThreshold;     ///< The min. transverse distance of an unambiguous shower hit from another pathway direction
     float m_maxConnectionDistance;    ///< The max. distance between connected hits
     unsigned int m_minNConnectedHits; ///< The number of connected hits needed for a conntected pathway
@@ -212,8 +261,12 @@ private:
     float m_maxSeparationFromHit;     ///< The max. separation between the projected 3D shower start and the closest 2D shower hit
     float m_maxProjectionSeparation;  ///< The max. separation between the projected 3D shower start and the shower start of that view
     float m_maxXSeparation;           ///< The max. drift-coordinate separation between a 3D shower start and a matched 2D shower hit
+    float m_hitGridCellSize;          ///< The cell size of the per-view event hit grids
+    unsigned int m_maxShowerThreads;  ///< The maximum number of threads with which to analyse showers
     ConnectionPathwayFeatureTool::FeatureToolMap m_featureToolMap; ///< The feature tool map
     pandora::StringVector m_algorithmToolNames;                    ///< The algorithm tool names
+    CaloHitGridMap m_caloHitGridMap;                               ///< The per-view event hit grids, for the current event
+    ViewHitSnapshotMap m_hitSnapshotMap;                           ///< The per-view event hit snapshots, for the current event
 };
 
 } // namespace lar_content
@@ -30,7 +30,7 @@ PeakDirectionFinderTool::PeakDirectionFinderTool() :
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 StatusCode PeakDirectionFinderTool::Run(const ParticleFlowObject *const pShowerPfo, const CartesianVector &nuVertex3D,
-    const CaloHitList *const pViewHitList, const HitType hitType, CartesianPointVector &peakDirectionVector)
+    const CaloHitGrid &viewHitGrid, const HitType hitType, CartesianPointVector &peakDirectionVector)
 {
     CaloHitList viewShowerHitList;
     LArPfoHelper::GetCaloHits(pShowerPfo, hitType, viewShowerHitList);
@@ -39,7 +39,7 @@ StatusCode PeakDirectionFinderTool::Run(const ParticleFlowObject *const pShowerP
 
     // Get event hits in region of interest
     CaloHitList viewROIHits;
-    this->CollectHitsWithinROI(viewShowerHitList, pViewHitList, nuVertex2D, viewROIHits);
+    this->CollectHitsWithinROI(viewShowerHitList, viewHitGrid, nuVertex2D, viewROIHits);
 
     if (viewROIHits.empty())
         return STATUS_CODE_NOT_FOUND;
@@ -65,12 +65,17 @@ StatusCode PeakDirectionFinderTool::Run(const ParticleFlowObject *const pShowerP
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void PeakDirectionFinderTool::CollectHitsWithinROI(const CaloHitList &showerHitList, const CaloHitList *const pViewHitList,
-    const CartesianVector &nuVertex2D, CaloHitList &viewROIHits) const
+void PeakDirectionFinderTool::CollectHitsWithinROI(
+    const CaloHitList &showerHitList, const CaloHitGrid &viewHitGrid, const CartesianVector &nuVertex2D, CaloHitList &viewROIHits) const
 {
     if (m_ambiguousParticleMode)
     {
-        for (const CaloHit *const pCaloHit : *pViewHitList)
+        const CartesianVector searchRegionExtent(m_pathwaySearchRegion, 0.f, m_pathwaySearchRegion);
+
+        CaloHitList candidateHitList;
+        viewHitGrid.FindHitsInBox(nuVertex2D - searchRegionExtent, nuVertex2D + searchRegionExtent, candidateHitList);
+
+        for (const CaloHit *const pCaloHit : candidateHitList)
         {
             if (std::find(showerHitList.begin(), showerHitList.end(), pCaloHit) != showerHitList.end())
                 continue;
@@ -83,7 +88,7 @@ void PeakDirectionFinderTool::CollectHitsWithinROI(const CaloHitList &showerHitL
         float lowestTheta(std::numeric_limits<float>::max()), highestTheta((-1.f) * std::numeric_limits<float>::max());
 
         this->GetAngularExtrema(showerHitList, nuVertex2D, lowestTheta, highestTheta);
-        this->CollectHitsWithinExtrema(pViewHitList, nuVertex2D, lowestTheta, highestTheta, viewROIHits);
+        this->CollectHitsWithinExtrema(viewHitGrid, nuVertex2D, lowestTheta, highestTheta, viewROIHits);
     }
 }
 
@@ -117,12 +122,22 @@ void PeakDirectionFinderTool::GetAngularExtrema(
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void PeakDirectionFinderTool::CollectHitsWithinExtrema(const CaloHitList *const pViewHitList, const CartesianVector &nuVertex2D,
+void PeakDirectionFinderTool::CollectHitsWithinExtrema(const CaloHitGrid &viewHitGrid, const CartesianVector &nuVertex2D,
     const float lowestTheta, const float highestTheta, CaloHitList &viewROIHits) const
 {
+    if (lowestTheta > highestTheta)
+        return;
+
+    // ATTN Pad the cone half angle, as theta is obtained from an arc cosine and so is imprecise close to the drift-axis
+    const float coneTheta(0.5f * (lowestTheta + highestTheta)), coneHalfAngle(0.5f * (highestTheta - lowestTheta) + 0.01f);
+    const CartesianVector coneDirection(std::cos(coneTheta), 0.f, std::sin(coneTheta));
+
+    CaloHitList candidateHitList;
+    viewHitGrid.FindHitsInCone(nuVertex2D, coneDirection, m_pathwaySearchRegion, coneHalfAngle, candidateHitList);
+
     const CartesianVector xAxis(1.f, 0.f, 0.f);
 
-    for (const CaloHit *const pCaloHit : *pViewHitList)
+    for (const CaloHit *const pCaloHit : candidateHitList)
     {
         const CartesianVector &hitPosition(pCaloHit->GetPositionVector());
         const CartesianVector displacementVector(hitPosition - nuVertex2D);
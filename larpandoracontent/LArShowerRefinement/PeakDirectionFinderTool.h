@@ -11,6 +11,8 @@
 #include "Pandora/AlgorithmHeaders.h"
 #include "Pandora/AlgorithmTool.h"
 
+#include "larpandoracontent/LArObjects/LArCaloHitGrid.h"
+
 namespace lar_content
 {
 
@@ -23,7 +25,7 @@ public:
     PeakDirectionFinderTool();
 
     pandora::StatusCode Run(const pandora::ParticleFlowObject *const pShowerPfo, const pandora::CartesianVector &nuVertex3D,
-        const pandora::CaloHitList *const pViewHitList, const pandora::HitType hitType, pandora::CartesianPointVector &peakDirectionVector);
+        const CaloHitGrid &viewHitGrid, const pandora::HitType hitType, pandora::CartesianPointVector &peakDirectionVector);
 
 private:
     typedef std::map<int, float> AngularDecompositionMap;
@@ -32,14 +34,15 @@ private:
 
     /**
      *  @brief  Collect the 2D hits within a region of interest
-     *          (m_ambiguousParticleMode ? hits not in the shower : hits within the initial shower cone [originating from the nu vertex])
+     *          (m_ambiguousParticleMode ? hits not in the shower : hits within the initial shower cone [originating from the nu vertex]),
+     *          considering only the hits within the pathway search region, which are the only ones to enter the angular decomposition
      *
      *  @param  showerHitList the 2D shower hit list
-     *  @param  pViewHitList the event 2D hits list
+     *  @param  viewHitGrid the grid index over the event 2D hits
      *  @param  nuVertex2D the 2D neutrino vertex
      *  @param  viewROIHits the region of interest 2D hit list
      */
-    void CollectHitsWithinROI(const pandora::CaloHitList &showerHitList, const pandora::CaloHitList *const pViewHitList,
+    void CollectHitsWithinROI(const pandora::CaloHitList &showerHitList, const CaloHitGrid &viewHitGrid,
         const pandora::CartesianVector &nuVertex2D, pandora::CaloHitList &viewROIHits) const;
 
     /**
@@ -56,14 +59,14 @@ private:
     /**
      *  @brief  Collect the hits that lie within the initial shower cone (originating from the nu vertex)
      *
-     *  @param  pViewHitList the event 2D hits list
+     *  @param  viewHitGrid the grid index over the event 2D hits
      *  @param  nuVertex2D the 2D neutrino vertex
      *  @param  lowestTheta the lower angle (from the +ve drift-axis) boundary
      *  @param  highestTheta the higher angle (from the +ve drift-axis) boundary
      *  @param  viewROIHits the region of interest 2D hit list
      */
-    void CollectHitsWithinExtrema(const pandora::CaloHitList *const pViewHitList, const pandora::CartesianVector &nuVertex2D,
-        const float lowestTheta, const float highestTheta, pandora::CaloHitList &viewROIHits) const;
+    void CollectHitsWithinExtrema(const CaloHitGrid &viewHitGrid, const pandora::CartesianVector &nuVertex2D, const float lowestTheta,
+        const float highestTheta, pandora::CaloHitList &viewROIHits) const;
 
     /**
      *  @brief  Determine the angular distribution of the ROI hits
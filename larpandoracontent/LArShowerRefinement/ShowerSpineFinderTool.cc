@@ -38,12 +38,12 @@ ShowerSpineFinderTool::ShowerSpineFinderTool() :
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-StatusCode ShowerSpineFinderTool::Run(const CartesianVector &nuVertex3D, const CaloHitList *const pViewHitList, const HitType hitType,
+StatusCode ShowerSpineFinderTool::Run(const CartesianVector &nuVertex3D, const CaloHitGrid &viewHitGrid, const HitType hitType,
     const CartesianVector &peakDirection, CaloHitList &unavailableHitList, CaloHitList &showerSpineHitList)
 {
     const CartesianVector nuVertex2D(LArGeometryHelper::ProjectPosition(this->GetPandora(), nuVertex3D, hitType));
 
-    this->FindShowerSpine(pViewHitList, nuVertex2D, peakDirection, unavailableHitList, showerSpineHitList);
+    this->FindShowerSpine(viewHitGrid, nuVertex2D, peakDirection, unavailableHitList, showerSpineHitList);
 
     // Demand that spine is significant, be lenient here as some have small stubs and a gap
     if (showerSpineHitList.size() < m_hitThresholdForSpine)
@@ -54,14 +54,18 @@ StatusCode ShowerSpineFinderTool::Run(const CartesianVector &nuVertex3D, const C
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void ShowerSpineFinderTool::FindShowerSpine(const CaloHitList *const pViewHitList, const CartesianVector &nuVertex2D,
+void ShowerSpineFinderTool::FindShowerSpine(const CaloHitGrid &viewHitGrid, const CartesianVector &nuVertex2D,
     const CartesianVector &initialDirection, CaloHitList &unavailableHitList, CaloHitList &showerSpineHitList) const
 {
     // Use initial direction to find seed hits for a starting fit
     float highestL(0.f);
     CartesianPointVector runningFitPositionVector;
 
-    for (const CaloHit *const pCaloHit : *pViewHitList)
+    CaloHitList seedCandidateHitList;
+    viewHitGrid.FindHitsInCorridor(
+        nuVertex2D, initialDirection, 0.f, m_growingFitInitialLength, m_initialFitDistanceToLine, seedCandidateHitList);
+
+    for (const CaloHit *const pCaloHit : seedCandidateHitList)
     {
         const CartesianVector &hitPosition(pCaloHit->GetPositionVector());
         const CartesianVector &displacementVector(hitPosition - nuVertex2D);
@@ -125,7 +129,7 @@ void ShowerSpineFinderTool::FindShowerSpine(const CaloHitList *const pViewHitLis
             extrapolatedEndPosition = extrapolatedStartPosition + (extrapolatedDirection * m_growingFitSegmentLength);
 
             hitsCollected = this->CollectSubsectionHits(extrapolatedFit, extrapolatedStartPosition, extrapolatedEndPosition,
-                extrapolatedDirection, isEndDownstream, pViewHitList, runningFitPositionVector, unavailableHitList, showerSpineHitList);
+                extrapolatedDirection, isEndDownstream, viewHitGrid, runningFitPositionVector, unavailableHitList, showerSpineHitList);
 
             // If no hits found, as a final effort, reduce the sliding fit window
             if (!hitsCollected)
@@ -140,7 +144,7 @@ void ShowerSpineFinderTool::FindShowerSpine(const CaloHitList *const pViewHitLis
                 extrapolatedEndPosition = extrapolatedStartPosition + (extrapolatedDirection * m_growingFitSegmentLength);
 
                 hitsCollected = this->CollectSubsectionHits(microExtrapolatedFit, extrapolatedStartPosition, extrapolatedEndPosition,
-                    extrapolatedDirection, isEndDownstream, pViewHitList, runningFitPositionVector, unavailableHitList, showerSpineHitList);
+                    extrapolatedDirection, isEndDownstream, viewHitGrid, runningFitPositionVector, unavailableHitList, showerSpineHitList);
             }
         }
         catch (const StatusCodeException &)
@@ -154,7 +158,7 @@ void ShowerSpineFinderTool::FindShowerSpine(const CaloHitList *const pViewHitLis
 
 bool ShowerSpineFinderTool::CollectSubsectionHits(const TwoDSlidingFitResult &extrapolatedFit,
     const CartesianVector &extrapolatedStartPosition, const CartesianVector &extrapolatedEndPosition,
-    const CartesianVector &extrapolatedDirection, const bool isEndDownstream, const CaloHitList *const pViewHitList,
+    const CartesianVector &extrapolatedDirection, const bool isEndDownstream, const CaloHitGrid &viewHitGrid,
     CartesianPointVector &runningFitPositionVector, CaloHitList &unavailableHitList, CaloHitList &showerSpineHitList) const
 {
     float extrapolatedStartL(0.f), extrapolatedStartT(0.f);
@@ -163,9 +167,28 @@ bool ShowerSpineFinderTool::CollectSubsectionHits(const TwoDSlidingFitResult &ex
     float extrapolatedEndL(0.f), extrapolatedEndT(0.f);
     extrapolatedFit.GetLocalPosition(extrapolatedEndPosition, extrapolatedEndL, extrapolatedEndT);
 
+    // Candidate hits lie within the section boundaries and, allowing for the hit width, close to the connecting line
+    CaloHitList candidateHitList;
+    const float corridorHalfWidth(m_distanceToLine + viewHitGrid.GetMaxHalfWidth());
+    const float axisDotDirection(extrapolatedFit.GetAxisDirection().GetDotProduct(extrapolatedDirection));
+
+    if (std::fabs(axisDotDirection) < std::numeric_limits<float>::epsilon())
+    {
+        candidateHitList = viewHitGrid.GetCaloHitList();
+    }
+    else
+    {
+        const float minDeltaL(std::min(extrapolatedStartL, extrapolatedEndL) - extrapolatedStartL - corridorHalfWidth);
+        const float maxDeltaL(std::max(extrapolatedStartL, extrapolatedEndL) - extrapolatedStartL + corridorHalfWidth);
+        const float corridorL1(minDeltaL / axisDotDirection), corridorL2(maxDeltaL / axisDotDirection);
+
+        viewHitGrid.FindHitsInCorridor(extrapolatedStartPosition, extrapolatedDirection, std::min(corridorL1, corridorL2),
+            std::max(corridorL1, corridorL2), corridorHalfWidth, candidateHitList);
+    }
+
     CaloHitList collectedHits;
 
-    for (const CaloHit *const pCaloHit : *pViewHitList)
+    for (const CaloHit *const pCaloHit : candidateHitList)
     {
         if (std::find(showerSpineHitList.begin(), showerSpineHitList.end(), pCaloHit) != showerSpineHitList.end())
             continue;
@@ -11,6 +11,7 @@
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
+#include "larpandoracontent/LArHelpers/LArPointingClusterHelper.h"
 
 #include "larpandoracontent/LArThreeDReco/LArCosmicRay/CosmicRayVertexBuildingAlgorithm.h"
 
@@ -104,7 +105,8 @@ void CosmicRayVertexBuildingAlgorithm::BuildPointingClusterMap(const PfoVector &
 
             try
             {
-                const LArPointingCluster pointingCluster(pCluster, m_halfWindowLayers, slidingFitPitch);
+                const LArPointingCluster &pointingCluster(
+                    LArPointingClusterHelper::GetPointingCluster(pCluster, m_halfWindowLayers, slidingFitPitch));
 
                 if (!pointingClusterMap.insert(LArPointingClusterMap::value_type(pCluster, pointingCluster)).second)
                     throw StatusCodeException(STATUS_CODE_FAILURE);
@@ -15,6 +15,8 @@
 
 #include "larpandoracontent/LArThreeDReco/LArCosmicRay/DeltaRayMatchingContainers.h"
 
+#include <algorithm>
+
 using namespace pandora;
 
 namespace lar_content
@@ -54,15 +56,17 @@ void DeltaRayMatchingContainers::FillHitToClusterMap(const ClusterList &inputClu
 void DeltaRayMatchingContainers::AddToClusterMap(const Cluster *const pCluster)
 {
     const HitType hitType(LArClusterHelper::GetClusterHitType(pCluster));
-    HitToClusterMap &hitToClusterMap((hitType == TPC_VIEW_U) ? m_hitToClusterMapU
-            : (hitType == TPC_VIEW_V)                        ? m_hitToClusterMapV
-                                                             : m_hitToClusterMapW);
+    HitToClusterMap &hitToClusterMap(this->GetHitToClusterMap(hitType));
+    HitKDTreeIndex &kdTree(this->GetKDTreeIndex(hitType));
 
     CaloHitList caloHitList;
     pCluster->GetOrderedCaloHitList().FillCaloHitList(caloHitList);
 
     for (const CaloHit *const pCaloHit : caloHitList)
+    {
         hitToClusterMap[pCaloHit] = pCluster;
+        kdTree.Insert(pCaloHit);
+    }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -84,20 +88,8 @@ void DeltaRayMatchingContainers::FillClusterProximityMap(const ClusterList &inpu
 
 void DeltaRayMatchingContainers::BuildKDTree(const HitType hitType)
 {
-    const HitToClusterMap &hitToClusterMap((hitType == TPC_VIEW_U) ? m_hitToClusterMapU
-            : (hitType == TPC_VIEW_V)                              ? m_hitToClusterMapV
-                                                                   : m_hitToClusterMapW);
-    HitKDTree2D &kdTree((hitType == TPC_VIEW_U) ? m_kdTreeU : (hitType == TPC_VIEW_V) ? m_kdTreeV : m_kdTreeW);
-
-    CaloHitList allCaloHits;
-
-    for (auto &entry : hitToClusterMap)
-        allCaloHits.push_back(entry.first);
-
-    HitKDNode2DList hitKDNode2DList;
-    KDTreeBox hitsBoundingRegion2D(fill_and_bound_2d_kd_tree(allCaloHits, hitKDNode2DList));
-
-    kdTree.build(hitKDNode2DList, hitsBoundingRegion2D);
+    // The kd tree index already holds the hits of the hit to cluster map, so only needs to absorb its pending insertions
+    this->GetKDTreeIndex(hitType).Rebuild();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -105,10 +97,8 @@ void DeltaRayMatchingContainers::BuildKDTree(const HitType hitType)
 void DeltaRayMatchingContainers::AddToClusterProximityMap(const Cluster *const pCluster)
 {
     const HitType hitType(LArClusterHelper::GetClusterHitType(pCluster));
-    const HitToClusterMap &hitToClusterMap((hitType == TPC_VIEW_U) ? m_hitToClusterMapU
-            : (hitType == TPC_VIEW_V)                              ? m_hitToClusterMapV
-                                                                   : m_hitToClusterMapW);
-    HitKDTree2D &kdTree((hitType == TPC_VIEW_U) ? m_kdTreeU : (hitType == TPC_VIEW_V) ? m_kdTreeV : m_kdTreeW);
+    const HitToClusterMap &hitToClusterMap(this->GetHitToClusterMap(hitType));
+    const HitKDTreeIndex &kdTree(this->GetKDTreeIndex(hitType));
     ClusterProximityMap &clusterProximityMap((hitType == TPC_VIEW_U) ? m_clusterProximityMapU
             : (hitType == TPC_VIEW_V)                                ? m_clusterProximityMapV
                                                                      : m_clusterProximityMapW);
@@ -121,7 +111,7 @@ void DeltaRayMatchingContainers::AddToClusterProximityMap(const Cluster *const p
         HitKDNode2DList found;
         KDTreeBox searchRegionHits(build_2d_kd_search_region(pCaloHit, m_searchRegion1D, m_searchRegion1D));
 
-        kdTree.search(searchRegionHits, found);
+        kdTree.Search(searchRegionHits, found);
 
         for (const auto &hit : found)
         {
@@ -198,9 +188,8 @@ void DeltaRayMatchingContainers::AddClustersToContainers(const ClusterVector &ne
 void DeltaRayMatchingContainers::RemoveClusterFromContainers(const Cluster *const pDeletedCluster)
 {
     const HitType hitType(LArClusterHelper::GetClusterHitType(pDeletedCluster));
-    HitToClusterMap &hitToClusterMap((hitType == TPC_VIEW_U) ? m_hitToClusterMapU
-            : (hitType == TPC_VIEW_V)                        ? m_hitToClusterMapV
-                                                             : m_hitToClusterMapW);
+    HitToClusterMap &hitToClusterMap(this->GetHitToClusterMap(hitType));
+    HitKDTreeIndex &kdTree(this->GetKDTreeIndex(hitType));
     ClusterProximityMap &clusterProximityMap((hitType == TPC_VIEW_U) ? m_clusterProximityMapU
             : (hitType == TPC_VIEW_V)                                ? m_clusterProximityMapV
                                                                      : m_clusterProximityMapW);
@@ -219,6 +208,7 @@ void DeltaRayMatchingContainers::RemoveClusterFromContainers(const Cluster *cons
             throw StatusCodeException(STATUS_CODE_FAILURE);
 
         hitToClusterMap.erase(iter);
+        kdTree.Remove(pCaloHit);
     }
 
     const ClusterProximityMap::const_iterator clusterProximityIter(clusterProximityMap.find(pDeletedCluster));
@@ -257,9 +247,9 @@ void DeltaRayMatchingContainers::ClearContainers()
     m_hitToClusterMapV.clear();
     m_hitToClusterMapW.clear();
 
-    m_kdTreeU.clear();
-    m_kdTreeV.clear();
-    m_kdTreeW.clear();
+    m_kdTreeU.Clear();
+    m_kdTreeV.Clear();
+    m_kdTreeW.Clear();
 
     m_clusterProximityMapU.clear();
     m_clusterProximityMapV.clear();
@@ -270,4 +260,136 @@ void DeltaRayMatchingContainers::ClearContainers()
     m_clusterToPfoMapW.clear();
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+DeltaRayMatchingContainers::HitKDTreeIndex::HitKDTreeIndex() :
+    m_nTombstones(0)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void DeltaRayMatchingContainers::HitKDTreeIndex::Insert(const CaloHit *const pCaloHit)
+{
+    if (!m_liveHitSet.insert(pCaloHit).second)
+        return;
+
+    if (m_treeHitSet.count(pCaloHit))
+    {
+        --m_nTombstones;
+        return;
+    }
+
+    const CartesianVector &position(pCaloHit->GetPositionVector());
+    m_pendingNodes.emplace_back(pCaloHit, position.GetX(), position.GetZ());
+
+    this->RebuildIfRequired();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void DeltaRayMatchingContainers::HitKDTreeIndex::Remove(const CaloHit *const pCaloHit)
+{
+    if (!m_liveHitSet.erase(pCaloHit))
+        return;
+
+    if (m_treeHitSet.count(pCaloHit))
+    {
+        ++m_nTombstones;
+    }
+    else
+    {
+        HitKDNode2DList::iterator iter(std::find_if(
+            m_pendingNodes.begin(), m_pendingNodes.end(), [pCaloHit](const HitKDNode2D &node) { return node.data == pCaloHit; }));
+
+        if (m_pendingNodes.end() == iter)
+            throw StatusCodeException(STATUS_CODE_FAILURE);
+
+        m_pendingNodes.erase(iter);
+    }
+
+    this->RebuildIfRequired();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void DeltaRayMatchingContainers::HitKDTreeIndex::Rebuild()
+{
+    if (m_pendingNodes.empty() && (0 == m_nTombstones))
+        return;
+
+    // Preserve the order of the hits across rebuilds, so that the tree (and the order of search results) is reproducible
+    CaloHitList liveTreeHits;
+
+    for (const CaloHit *const pCaloHit : m_treeHits)
+    {
+        if (m_liveHitSet.count(pCaloHit))
+            liveTreeHits.push_back(pCaloHit);
+    }
+
+    for (const HitKDNode2D &node : m_pendingNodes)
+        liveTreeHits.push_back(node.data);
+
+    m_kdTree.clear();
+    m_treeHits = liveTreeHits;
+    m_treeHitSet.clear();
+    m_treeHitSet.insert(m_treeHits.begin(), m_treeHits.end());
+    m_pendingNodes.clear();
+    m_nTombstones = 0;
+
+    HitKDNode2DList hitKDNode2DList;
+    KDTreeBox hitsBoundingRegion2D(fill_and_bound_2d_kd_tree(liveTreeHits, hitKDNode2DList));
+
+    m_kdTree.build(hitKDNode2DList, hitsBoundingRegion2D);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void DeltaRayMatchingContainers::HitKDTreeIndex::Search(const KDTreeBox &searchRegion, HitKDNode2DList &found) const
+{
+    const std::size_t nInitialNodes(found.size());
+    m_kdTree.search(searchRegion, found);
+
+    if (m_nTombstones > 0)
+    {
+        found.erase(std::remove_if(found.begin() + nInitialNodes, found.end(),
+                        [this](const HitKDNode2D &node) { return !m_liveHitSet.count(node.data); }),
+            found.end());
+    }
+
+    // Apply the same (inclusive) containment test as the kd tree leaves
+    for (const HitKDNode2D &node : m_pendingNodes)
+    {
+        if ((node.dims[0] >= searchRegion.dimmin[0]) && (node.dims[0] <= searchRegion.dimmax[0]) &&
+            (node.dims[1] >= searchRegion.dimmin[1]) && (node.dims[1] <= searchRegion.dimmax[1]))
+        {
+            found.push_back(node);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void DeltaRayMatchingContainers::HitKDTreeIndex::Clear()
+{
+    m_kdTree.clear();
+    m_treeHits.clear();
+    m_treeHitSet.clear();
+    m_liveHitSet.clear();
+    m_pendingNodes.clear();
+    m_nTombstones = 0;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void DeltaRayMatchingContainers::HitKDTreeIndex::RebuildIfRequired()
+{
+    // ATTN Pending nodes are searched linearly and tombstones are visited by tree searches, so bound both relative to the tree size
+    const std::size_t maxStaleEntries(std::max(static_cast<std::size_t>(64), m_treeHits.size() / 4));
+
+    if (m_pendingNodes.size() + m_nTombstones > maxStaleEntries)
+        this->Rebuild();
+}
+
 } // namespace lar_content
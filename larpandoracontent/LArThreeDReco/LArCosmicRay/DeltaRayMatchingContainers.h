@@ -10,6 +10,9 @@
 
 #include "Pandora/PandoraInternal.h"
 
+#include <unordered_map>
+#include <unordered_set>
+
 #include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
 
 namespace lar_content
@@ -85,11 +88,69 @@ public:
     float m_searchRegion1D; ///< Search region, applied to each dimension, for look-up from kd-tree
 
 private:
-    typedef std::map<const pandora::CaloHit *, const pandora::Cluster *> HitToClusterMap;
+    typedef std::unordered_map<const pandora::CaloHit *, const pandora::Cluster *> HitToClusterMap;
     typedef KDTreeLinkerAlgo<const pandora::CaloHit *, 2> HitKDTree2D;
     typedef KDTreeNodeInfoT<const pandora::CaloHit *, 2> HitKDNode2D;
     typedef std::vector<HitKDNode2D> HitKDNode2DList;
 
+    /**
+     *  @brief  HitKDTreeIndex class, a 2D kd tree over a changing set of hits. Inserted hits are held in a pending list and removed
+     *          hits are left in the tree as tombstones, with the tree rebuilt from the live hits once these become a significant fraction
+     */
+    class HitKDTreeIndex
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        HitKDTreeIndex();
+
+        /**
+         *  @brief  Insert a hit, which is then returned by searches (no effect if the hit is already present)
+         *
+         *  @param  pCaloHit the address of the hit
+         */
+        void Insert(const pandora::CaloHit *const pCaloHit);
+
+        /**
+         *  @brief  Remove a hit, which is then no longer returned by searches (no effect if the hit is not present)
+         *
+         *  @param  pCaloHit the address of the hit
+         */
+        void Remove(const pandora::CaloHit *const pCaloHit);
+
+        /**
+         *  @brief  Rebuild the kd tree from the live hits, absorbing any pending insertions and tombstones
+         */
+        void Rebuild();
+
+        /**
+         *  @brief  Find the live hits within a search region
+         *
+         *  @param  searchRegion the search region
+         *  @param  found to receive the nodes of the live hits within the search region
+         */
+        void Search(const KDTreeBox &searchRegion, HitKDNode2DList &found) const;
+
+        /**
+         *  @brief  Remove all hits
+         */
+        void Clear();
+
+    private:
+        /**
+         *  @brief  Rebuild the kd tree if the pending insertions and tombstones have become a significant fraction of its hits
+         */
+        void RebuildIfRequired();
+
+        HitKDTree2D m_kdTree;            ///< The kd tree
+        pandora::CaloHitList m_treeHits; ///< The hits in the kd tree, live or tombstoned, in the order in which the tree was built
+        std::unordered_set<const pandora::CaloHit *> m_treeHitSet; ///< The hits in the kd tree, live or tombstoned
+        std::unordered_set<const pandora::CaloHit *> m_liveHitSet; ///< The live hits, in the kd tree or pending
+        HitKDNode2DList m_pendingNodes;                            ///< The nodes of the live hits inserted since the kd tree was built
+        unsigned int m_nTombstones;                                ///< The number of removed hits still held in the kd tree
+    };
+
     /**
      *  @brief  Populate the hit to cluster map from a list of clusters
      *
@@ -125,6 +186,24 @@ private:
      */
     void BuildKDTree(const pandora::HitType hitType);
 
+    /**
+     *  @brief  Get the hit to cluster map of a given view
+     *
+     *  @param  hitType the hit type
+     *
+     *  @return the hit to cluster map
+     */
+    HitToClusterMap &GetHitToClusterMap(const pandora::HitType hitType);
+
+    /**
+     *  @brief  Get the KD tree index of a given view
+     *
+     *  @param  hitType the hit type
+     *
+     *  @return the KD tree index
+     */
+    HitKDTreeIndex &GetKDTreeIndex(const pandora::HitType hitType);
+
     /**
      *  @brief  Add a cluster to the cluster proximity map
      *
@@ -135,9 +214,9 @@ private:
     HitToClusterMap m_hitToClusterMapU;         ///< The mapping of hits to the clusters to which they belong (in the U view)
     HitToClusterMap m_hitToClusterMapV;         ///< The mapping of hits to the clusters to which they belong (in the V view)
     HitToClusterMap m_hitToClusterMapW;         ///< The mapping of hits to the clusters to which they belong (in the W view)
-    HitKDTree2D m_kdTreeU;                      ///< The KD tree (in the U view)
-    HitKDTree2D m_kdTreeV;                      ///< The KD tree (in the V view)
-    HitKDTree2D m_kdTreeW;                      ///< The KD tree (in the W view)
+    HitKDTreeIndex m_kdTreeU;                   ///< The KD tree index (in the U view)
+    HitKDTreeIndex m_kdTreeV;                   ///< The KD tree index (in the V view)
+    HitKDTreeIndex m_kdTreeW;                   ///< The KD tree index (in the W view)
     ClusterProximityMap m_clusterProximityMapU; ///< The mapping of clusters to their neighbouring clusters (in the U view)
     ClusterProximityMap m_clusterProximityMapV; ///< The mapping of clusters to their neighbouring clusters (in the V view)
     ClusterProximityMap m_clusterProximityMapW; ///< The mapping of clusters to their neighbouring clusters (in the W view)
@@ -165,6 +244,22 @@ inline const DeltaRayMatchingContainers::ClusterToPfoMap &DeltaRayMatchingContai
                                                : m_clusterToPfoMapW);
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline DeltaRayMatchingContainers::HitToClusterMap &DeltaRayMatchingContainers::GetHitToClusterMap(const pandora::HitType hitType)
+{
+    return ((hitType == pandora::TPC_VIEW_U)   ? m_hitToClusterMapU
+            : (hitType == pandora::TPC_VIEW_V) ? m_hitToClusterMapV
+                                               : m_hitToClusterMapW);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline DeltaRayMatchingContainers::HitKDTreeIndex &DeltaRayMatchingContainers::GetKDTreeIndex(const pandora::HitType hitType)
+{
+    return ((hitType == pandora::TPC_VIEW_U) ? m_kdTreeU : (hitType == pandora::TPC_VIEW_V) ? m_kdTreeV : m_kdTreeW);
+}
+
 } // namespace lar_content
 
 #endif // #ifndef LAR_DELTA_RAY_MATCHING_CONTAINERS_H
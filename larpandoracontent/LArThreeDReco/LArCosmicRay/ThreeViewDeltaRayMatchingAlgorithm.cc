@@ -8,6 +8,8 @@
 
 #include "Pandora/AlgorithmHeaders.h"
 
+#include "larpandoracontent/LArHelpers/LArProfilingHelper.h"
+
 #include "larpandoracontent/LArThreeDReco/LArCosmicRay/ThreeViewDeltaRayMatchingAlgorithm.h"
 
 using namespace pandora;
@@ -115,6 +117,7 @@ void ThreeViewDeltaRayMatchingAlgorithm::ExamineOverlapContainer()
     for (auto toolIter = m_algorithmToolVector.begin(); toolIter != m_algorithmToolVector.end();)
     {
         DeltaRayTensorTool *const pTool(*toolIter);
+        const LArProfilingHelper::ScopedTimer timer(pTool);
         const bool repeatTools(pTool->Run(this, this->GetMatchingControl().GetOverlapTensor()));
 
         toolIter = repeatTools ? m_algorithmToolVector.begin() : toolIter + 1;
@@ -11,6 +11,7 @@
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArMuonLeadingHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
+#include "larpandoracontent/LArHelpers/LArProfilingHelper.h"
 
 #include "larpandoracontent/LArObjects/LArTwoDSlidingFitResult.h"
 
@@ -408,6 +409,7 @@ void TwoViewDeltaRayMatchingAlgorithm::ExamineOverlapContainer()
     for (auto toolIter = m_algorithmToolVector.begin(); toolIter != m_algorithmToolVector.end();)
     {
         DeltaRayMatrixTool *const pTool(*toolIter);
+        const LArProfilingHelper::ScopedTimer timer(pTool);
         const bool repeatTools(pTool->Run(this, this->GetMatchingControl().GetOverlapMatrix()));
 
         toolIter = repeatTools ? m_algorithmToolVector.begin() : toolIter + 1;
@@ -171,14 +171,14 @@ void EventSlicingTool::GetClusterSliceList(const ClusterList &trackClusters3D, c
     const float pitchMax{std::max({pitchU, pitchV, pitchW})};
     const float layerPitch(pitchMax);
 
-    ThreeDSlidingFitResultMap trackFitResults;
+    LArPointingClusterMap trackPointingClusters;
 
     for (const Cluster *const pCluster3D : trackClusters3D)
     {
         try
         {
-            trackFitResults.insert(
-                ThreeDSlidingFitResultMap::value_type(pCluster3D, ThreeDSlidingFitResult(pCluster3D, m_halfWindowLayers, layerPitch)));
+            trackPointingClusters.insert(LArPointingClusterMap::value_type(
+                pCluster3D, LArPointingClusterHelper::GetPointingCluster(pCluster3D, m_halfWindowLayers, layerPitch)));
         }
         catch (StatusCodeException &)
         {
@@ -219,14 +219,15 @@ void EventSlicingTool::GetClusterSliceList(const ClusterList &trackClusters3D, c
         usedClusters.insert(pCluster3D);
 
         ClusterVector &clusterSlice(clusterSliceList.back());
-        this->CollectAssociatedClusters(pCluster3D, sortedClusters3D, trackFitResults, showerConeFitResults, clusterSlice, usedClusters);
+        this->CollectAssociatedClusters(
+            pCluster3D, sortedClusters3D, trackPointingClusters, showerConeFitResults, clusterSlice, usedClusters);
     }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void EventSlicingTool::CollectAssociatedClusters(const Cluster *const pClusterInSlice, const ClusterVector &candidateClusters,
-    const ThreeDSlidingFitResultMap &trackFitResults, const ThreeDSlidingConeFitResultMap &showerConeFitResults,
+    const LArPointingClusterMap &trackPointingClusters, const ThreeDSlidingConeFitResultMap &showerConeFitResults,
     ClusterVector &clusterSlice, ClusterSet &usedClusters) const
 {
     ClusterVector addedClusters;
@@ -236,7 +237,7 @@ void EventSlicingTool::CollectAssociatedClusters(const Cluster *const pClusterIn
         if (usedClusters.count(pCandidateCluster) || (pClusterInSlice == pCandidateCluster))
             continue;
 
-        if ((m_usePointingAssociation && this->PassPointing(pClusterInSlice, pCandidateCluster, trackFitResults)) ||
+        if ((m_usePointingAssociation && this->PassPointing(pClusterInSlice, pCandidateCluster, trackPointingClusters)) ||
             (m_useProximityAssociation && this->PassProximity(pClusterInSlice, pCandidateCluster)) ||
             (m_useShowerConeAssociation &&
                 (this->PassShowerCone(pClusterInSlice, pCandidateCluster, showerConeFitResults) ||
@@ -250,22 +251,23 @@ void EventSlicingTool::CollectAssociatedClusters(const Cluster *const pClusterIn
     clusterSlice.insert(clusterSlice.end(), addedClusters.begin(), addedClusters.end());
 
     for (const Cluster *const pAddedCluster : addedClusters)
-        this->CollectAssociatedClusters(pAddedCluster, candidateClusters, trackFitResults, showerConeFitResults, clusterSlice, usedClusters);
+        this->CollectAssociatedClusters(
+            pAddedCluster, candidateClusters, trackPointingClusters, showerConeFitResults, clusterSlice, usedClusters);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 bool EventSlicingTool::PassPointing(
-    const Cluster *const pClusterInSlice, const Cluster *const pCandidateCluster, const ThreeDSlidingFitResultMap &trackFitResults) const
+    const Cluster *const pClusterInSlice, const Cluster *const pCandidateCluster, const LArPointingClusterMap &trackPointingClusters) const
 {
-    ThreeDSlidingFitResultMap::const_iterator inSliceIter = trackFitResults.find(pClusterInSlice);
-    ThreeDSlidingFitResultMap::const_iterator candidateIter = trackFitResults.find(pCandidateCluster);
+    LArPointingClusterMap::const_iterator inSliceIter = trackPointingClusters.find(pClusterInSlice);
+    LArPointingClusterMap::const_iterator candidateIter = trackPointingClusters.find(pCandidateCluster);
 
-    if ((trackFitResults.end() == inSliceIter) || (trackFitResults.end() == candidateIter))
+    if ((trackPointingClusters.end() == inSliceIter) || (trackPointingClusters.end() == candidateIter))
         return false;
 
-    const LArPointingCluster inSlicePointingCluster(inSliceIter->second);
-    const LArPointingCluster candidatePointingCluster(candidateIter->second);
+    const LArPointingCluster &inSlicePointingCluster(inSliceIter->second);
+    const LArPointingCluster &candidatePointingCluster(candidateIter->second);
 
     if (this->CheckClosestApproach(inSlicePointingCluster, candidatePointingCluster) ||
         this->IsEmission(inSlicePointingCluster, candidatePointingCluster) || this->IsNode(inSlicePointingCluster, candidatePointingCluster))
@@ -325,14 +327,18 @@ bool EventSlicingTool::PassShowerCone(
         return false;
     }
 
-    for (const SimpleCone &simpleCone : simpleConeList)
-    {
-        const float coneLength(std::min(m_coneLengthMultiplier * clusterLength, m_maxConeLength));
+    const float coneLength(std::min(m_coneLengthMultiplier * clusterLength, m_maxConeLength));
+    const ConeHitPositions hitPositions(pNearbyCluster);
+
+    SimpleConeScoreList coneScoreList;
+    SimpleCone::GetConeScores(simpleConeList, hitPositions, coneLength, m_coneTanHalfAngle1, m_coneTanHalfAngle2, coneScoreList);
 
-        if (simpleCone.GetBoundedHitFraction(pNearbyCluster, coneLength, m_coneTanHalfAngle1) < m_coneBoundedFraction1)
+    for (const SimpleConeScore &coneScore : coneScoreList)
+    {
+        if (coneScore.m_boundedFraction1 < m_coneBoundedFraction1)
             continue;
 
-        if (simpleCone.GetBoundedHitFraction(pNearbyCluster, coneLength, m_coneTanHalfAngle2) < m_coneBoundedFraction2)
+        if (coneScore.m_boundedFraction2 < m_coneBoundedFraction2)
             continue;
 
         return true;
@@ -10,6 +10,7 @@
 
 #include "larpandoracontent/LArControlFlow/EventSlicingBaseTool.h"
 
+#include "larpandoracontent/LArObjects/LArPointingCluster.h"
 #include "larpandoracontent/LArObjects/LArThreeDSlidingConeFitResult.h"
 
 #include <unordered_map>
@@ -83,13 +84,13 @@ private:
      *
      *  @param  pClusterInSlice the address of the cluster already in a slice
      *  @param  candidateClusters the list of candidate clusters
-     *  @param  trackFitResults the map of sliding fit results for track candidate clusters
+     *  @param  trackPointingClusters the map of pointing clusters for track candidate clusters
      *  @param  showerConeFitResults the map of sliding const fit results for shower candidate clusters
      *  @param  clusterSlice the cluster slice
      *  @param  usedClusters the list of clusters already added to slices
      */
     void CollectAssociatedClusters(const pandora::Cluster *const pClusterInSlice, const pandora::ClusterVector &candidateClusters,
-        const ThreeDSlidingFitResultMap &trackFitResults, const ThreeDSlidingConeFitResultMap &showerConeFitResults,
+        const LArPointingClusterMap &trackPointingClusters, const ThreeDSlidingConeFitResultMap &showerConeFitResults,
         pandora::ClusterVector &clusterSlice, pandora::ClusterSet &usedClusters) const;
 
     /**
@@ -97,12 +98,12 @@ private:
      *
      *  @param  pClusterInSlice address of a cluster already in the slice
      *  @param  pCandidateCluster address of the candidate cluster
-     *  @param  trackFitResults the map of sliding fit results for track candidate clusters
+     *  @param  trackPointingClusters the map of pointing clusters for track candidate clusters
      *
      *  @return whether an addition to the cluster slice should be made
      */
     bool PassPointing(const pandora::Cluster *const pClusterInSlice, const pandora::Cluster *const pCandidateCluster,
-        const ThreeDSlidingFitResultMap &trackFitResults) const;
+        const LArPointingClusterMap &trackPointingClusters) const;
 
     /**
      *  @brief  Compare the provided clusters to assess whether they are associated via pointing
@@ -11,6 +11,7 @@
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
+#include "larpandoracontent/LArHelpers/LArProfilingHelper.h"
 
 #include "larpandoracontent/LArThreeDReco/LArEventBuilding/NeutrinoHierarchyAlgorithm.h"
 
@@ -82,7 +83,10 @@ StatusCode NeutrinoHierarchyAlgorithm::Run()
             this->GetInitialPfoInfoMap(candidateDaughterPfoList, pfoInfoMap);
 
             for (PfoRelationTool *const pPfoRelationTool : m_algorithmToolVector)
+            {
+                const LArProfilingHelper::ScopedTimer timer(pPfoRelationTool);
                 pPfoRelationTool->Run(this, pNeutrinoVertex, pfoInfoMap);
+            }
         }
 
         this->ProcessPfoInfoMap(pNeutrinoPfo, candidateDaughterPfoList, pfoInfoMap);
@@ -279,7 +283,10 @@ void NeutrinoHierarchyAlgorithm::AdjustVertexAndPfoInfo(
     pfoInfoMap.clear();
 
     for (PfoRelationTool *const pPfoRelationTool : m_algorithmToolVector)
+    {
+        const LArProfilingHelper::ScopedTimer timer(pPfoRelationTool);
         pPfoRelationTool->Run(this, pNewNeutrinoVertex, pfoInfoMap);
+    }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
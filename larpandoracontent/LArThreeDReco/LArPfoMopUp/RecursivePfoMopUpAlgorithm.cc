@@ -9,6 +9,7 @@
 #include "Pandora/AlgorithmHeaders.h"
 
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
+#include "larpandoracontent/LArHelpers/LArProfilingHelper.h"
 
 #include "larpandoracontent/LArThreeDReco/LArPfoMopUp/RecursivePfoMopUpAlgorithm.h"
 
@@ -24,7 +25,7 @@ StatusCode RecursivePfoMopUpAlgorithm::Run()
     for (unsigned int iter = 0; iter < m_maxIterations; ++iter)
     {
         for (auto const &mopUpAlg : m_mopUpAlgorithms)
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::RunDaughterAlgorithm(*this, mopUpAlg));
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArProfilingHelper::RunDaughterAlgorithm(*this, mopUpAlg));
 
         PfoMergeStatsList mergeStatsListAfter(this->GetPfoMergeStats());
 
@@ -130,6 +130,12 @@ void SlidingConePfoMopUpAlgorithm::GetClusterMergeMap(const Vertex *const pVerte
     const float pitchW{LArGeometryHelper::GetWirePitch(this->GetPandora(), TPC_VIEW_W)};
     const float pitchMax{std::max({pitchU, pitchV, pitchW})};
 
+    ConeHitPositionsList hitPositionsList;
+    hitPositionsList.reserve(clusters3D.size());
+
+    for (const Cluster *const pCluster3D : clusters3D)
+        hitPositionsList.emplace_back(pCluster3D);
+
     for (const Cluster *const pShowerCluster : clusters3D)
     {
         if ((pShowerCluster->GetNCaloHits() < m_minHitsToConsider3DShower) || !LArPfoHelper::IsShower(clusterToPfoMap.at(pShowerCluster)))
@@ -169,18 +175,22 @@ void SlidingConePfoMopUpAlgorithm::GetClusterMergeMap(const Vertex *const pVerte
             continue;
         }
 
-        for (const Cluster *const pNearbyCluster : clusters3D)
+        SimpleConeScoreList coneScoreList;
+
+        for (unsigned int iNearby = 0; iNearby < clusters3D.size(); ++iNearby)
         {
+            const Cluster *const pNearbyCluster(clusters3D.at(iNearby));
+
             if (pNearbyCluster == pShowerCluster)
                 continue;
 
             ClusterMerge bestClusterMerge(nullptr, 0.f, 0.f);
+            SimpleCone::GetConeScores(
+                simpleConeList, hitPositionsList.at(iNearby), coneLength, m_coneTanHalfAngle1, m_coneTanHalfAngle2, coneScoreList);
 
-            for (const SimpleCone &simpleCone : simpleConeList)
+            for (const SimpleConeScore &coneScore : coneScoreList)
             {
-                const float boundedFraction1(simpleCone.GetBoundedHitFraction(pNearbyCluster, coneLength, m_coneTanHalfAngle1));
-                const float boundedFraction2(simpleCone.GetBoundedHitFraction(pNearbyCluster, coneLength, m_coneTanHalfAngle2));
-                const ClusterMerge clusterMerge(pShowerCluster, boundedFraction1, boundedFraction2);
+                const ClusterMerge clusterMerge(pShowerCluster, coneScore.m_boundedFraction1, coneScore.m_boundedFraction2);
 
                 if (clusterMerge < bestClusterMerge)
                     bestClusterMerge = clusterMerge;
@@ -237,8 +247,9 @@ bool SlidingConePfoMopUpAlgorithm::IsVertexAssociated(
         else
             layerPitch = pitchMax;
 
-        const LArPointingCluster pointingCluster(
-            pSlidingFitResult ? LArPointingCluster(*pSlidingFitResult) : LArPointingCluster(pCluster, m_halfWindowLayers, layerPitch));
+        const LArPointingCluster pointingCluster(pSlidingFitResult
+                ? LArPointingCluster(*pSlidingFitResult)
+                : LArPointingClusterHelper::GetPointingCluster(pCluster, m_halfWindowLayers, layerPitch));
 
         const bool useInner((pointingCluster.GetInnerVertex().GetPosition() - vertexPosition).GetMagnitudeSquared() <
             (pointingCluster.GetOuterVertex().GetPosition() - vertexPosition).GetMagnitudeSquared());
@@ -139,7 +139,7 @@ bool VertexBasedPfoMopUpAlgorithm::IsVertexAssociated(const Pfo *const pPfo, con
 
         try
         {
-            const LArPointingCluster pointingCluster(pCluster);
+            const LArPointingCluster &pointingCluster(LArPointingClusterHelper::GetPointingCluster(pCluster));
 
             if (this->IsVertexAssociated(vertex2D, pointingCluster))
                 hitTypeSet.insert(hitType);
@@ -148,7 +148,7 @@ void ParticleRecoveryAlgorithm::VertexClusterSelection(const ClusterList &inputC
         {
             if (!(*iter)->IsAvailable())
             {
-                const LArPointingCluster pointingCluster(*iter);
+                const LArPointingCluster &pointingCluster(LArPointingClusterHelper::GetPointingCluster(*iter));
                 vertexList.push_back(pointingCluster.GetInnerVertex().GetPosition());
                 vertexList.push_back(pointingCluster.GetOuterVertex().GetPosition());
             }
@@ -167,7 +167,7 @@ void ParticleRecoveryAlgorithm::VertexClusterSelection(const ClusterList &inputC
             if (!pCluster->IsAvailable())
                 continue;
 
-            const LArPointingCluster pointingCluster(pCluster);
+            const LArPointingCluster &pointingCluster(LArPointingClusterHelper::GetPointingCluster(pCluster));
 
             for (CartesianPointVector::const_iterator vIter = vertexList.begin(), vIterEnd = vertexList.end(); vIter != vIterEnd; ++vIter)
             {
@@ -12,6 +12,7 @@
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
+#include "larpandoracontent/LArHelpers/LArProfilingHelper.h"
 
 using namespace pandora;
 
@@ -94,6 +95,8 @@ void ThreeViewRemnantsAlgorithm::ExamineOverlapContainer()
 
     for (RemnantTensorToolVector::const_iterator iter = m_algorithmToolVector.begin(), iterEnd = m_algorithmToolVector.end(); iter != iterEnd;)
     {
+        const LArProfilingHelper::ScopedTimer timer(*iter);
+
         if ((*iter)->Run(this, this->GetMatchingControl().GetOverlapTensor()))
         {
             iter = m_algorithmToolVector.begin();
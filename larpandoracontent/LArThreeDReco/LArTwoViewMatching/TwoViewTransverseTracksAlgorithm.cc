@@ -12,6 +12,7 @@
 #include "larpandoracontent/LArHelpers/LArDiscreteProbabilityHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
 #include "larpandoracontent/LArHelpers/LArPcaHelper.h"
+#include "larpandoracontent/LArHelpers/LArProfilingHelper.h"
 
 #include "larpandoracontent/LArThreeDReco/LArTwoViewMatching/TwoViewTransverseTracksAlgorithm.h"
 
@@ -26,6 +27,8 @@ TwoViewTransverseTracksAlgorithm::TwoViewTransverseTracksAlgorithm() :
     m_minSamples(11),
     m_nPermutations(1000),
     m_localMatchingScoreThreshold(0.99f),
+    m_useLocalEarlyStopping(false),
+    m_earlyStoppingSignificance(3.f),
     m_maxDotProduct(0.998f),
     m_minOverallMatchingScore(0.1f),
     m_minOverallLocallyMatchedFraction(0.1f),
@@ -155,6 +158,10 @@ unsigned int TwoViewTransverseTracksAlgorithm::CalculateNumberOfLocallyMatchingS
     pandora::FloatVector localValues1, localValues2;
     unsigned int nMatchedComparisons(0);
 
+    const std::function<bool(const float)> isLocallyMatched([this](const float localPValue) {
+        return ((1.f - localPValue) - m_localMatchingScoreThreshold > std::numeric_limits<float>::epsilon());
+    });
+
     for (unsigned int iValue = 0; iValue < discreteProbabilityVector1.GetSize(); ++iValue)
     {
         localValues1.emplace_back(discreteProbabilityVector1.GetProbability(iValue));
@@ -164,8 +171,12 @@ unsigned int TwoViewTransverseTracksAlgorithm::CalculateNumberOfLocallyMatchingS
             float localPValue(0);
             try
             {
-                localPValue = LArDiscreteProbabilityHelper::CalculateCorrelationCoefficientPValueFromPermutationTest(
-                    localValues1, localValues2, randomNumberGenerator, m_nPermutations);
+                // ATTN Only the local matching decision is used, so the test may stop once that exact decision is settled
+                localPValue = m_useLocalEarlyStopping
+                    ? LArDiscreteProbabilityHelper::CalculateCorrelationCoefficientPValueFromPermutationTest(localValues1, localValues2,
+                          randomNumberGenerator, m_nPermutations, isLocallyMatched, m_earlyStoppingSignificance)
+                    : LArDiscreteProbabilityHelper::CalculateCorrelationCoefficientPValueFromPermutationTest(
+                          localValues1, localValues2, randomNumberGenerator, m_nPermutations);
             }
             catch (const StatusCodeException &)
             {
@@ -181,7 +192,7 @@ unsigned int TwoViewTransverseTracksAlgorithm::CalculateNumberOfLocallyMatchingS
                 std::cout << std::endl;
             }
 
-            if ((1.f - localPValue) - m_localMatchingScoreThreshold > std::numeric_limits<float>::epsilon())
+            if (isLocallyMatched(localPValue))
                 nMatchedComparisons++;
 
             localValues1.erase(localValues1.begin());
@@ -195,8 +206,8 @@ unsigned int TwoViewTransverseTracksAlgorithm::CalculateNumberOfLocallyMatchingS
 
 float TwoViewTransverseTracksAlgorithm::GetPrimaryAxisDotDriftAxis(const pandora::Cluster *const pCluster)
 {
-    pandora::CartesianPointVector pointVector;
-    LArClusterHelper::GetCoordinateVector(pCluster, pointVector);
+    // ATTN The principal axis is independent of the hit order, so the unsorted cluster positions are used in place
+    const pandora::CartesianPointVector &pointVector(LArClusterHelper::GetClusterSummary(pCluster).GetPositions());
 
     pandora::CartesianVector centroid(0.f, 0.f, 0.f);
     LArPcaHelper::EigenVectors eigenVecs;
@@ -215,6 +226,8 @@ void TwoViewTransverseTracksAlgorithm::ExamineOverlapContainer()
     unsigned int repeatCounter(0);
     for (MatrixToolVector::const_iterator iter = m_algorithmToolVector.begin(), iterEnd = m_algorithmToolVector.end(); iter != iterEnd;)
     {
+        const LArProfilingHelper::ScopedTimer timer(*iter);
+
         if ((*iter)->Run(this, this->GetMatchingControl().GetOverlapMatrix()))
         {
             iter = m_algorithmToolVector.begin();
@@ -259,6 +272,12 @@ StatusCode TwoViewTransverseTracksAlgorithm::ReadSettings(const TiXmlHandle xmlH
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
         XmlHelper::ReadValue(xmlHandle, "LocalMatchingScoreThreshold", m_localMatchingScoreThreshold));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ReadValue(xmlHandle, "UseLocalEarlyStopping", m_useLocalEarlyStopping));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ReadValue(xmlHandle, "EarlyStoppingSignificance", m_earlyStoppingSignificance));
+
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "MaxDotProduct", m_maxDotProduct));
 
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
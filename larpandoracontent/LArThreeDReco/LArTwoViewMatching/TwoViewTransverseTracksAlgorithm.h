@@ -85,6 +85,8 @@ private:
     unsigned int m_minSamples;                ///< The minimum number of samples needed for comparing charges
     unsigned int m_nPermutations;             ///< The number of permutations for calculating p-values
     float m_localMatchingScoreThreshold;      ///< The minimum score to classify a local region as matching
+    bool m_useLocalEarlyStopping;             ///< Whether to stop local permutation tests once the local matching decision is settled
+    float m_earlyStoppingSignificance;        ///< The significance, in standard deviations, at which a local matching decision is settled
     float m_maxDotProduct;                    ///M The maximum allowed cluster primary qxis Dot drift axis to fill the overlap result
     float m_minOverallMatchingScore;          ///< The minimum required global matching score to fill the overlap result
     float m_minOverallLocallyMatchedFraction; ///< The minimum required lcoally matched fraction to fill the overlap result
@@ -9,6 +9,7 @@
 #include "Pandora/AlgorithmHeaders.h"
 
 #include "larpandoracontent/LArHelpers/LArFileHelper.h"
+#include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
 
 #include "larpandoracontent/LArObjects/LArTwoDSlidingFitResult.h"
@@ -37,6 +38,7 @@ MvaPfoCharacterisationAlgorithm<T>::MvaPfoCharacterisationAlgorithm() :
     m_fiducialMinZ(-std::numeric_limits<float>::max()),
     m_fiducialMaxZ(std::numeric_limits<float>::max()),
     m_applyReconstructabilityChecks(false),
+    m_trainingOutputFormat(LArMvaHelper::TRAINING_OUTPUT_CSV),
     m_filePathEnvironmentVariable("FW_SEARCH_PATH")
 {
 }
@@ -50,7 +52,9 @@ bool MvaPfoCharacterisationAlgorithm<T>::IsClearTrack(const Cluster *const pClus
         return false;
 
     StringVector featureOrder;
-    const LArMvaHelper::MvaFeatureMap featureMap(LArMvaHelper::CalculateFeatures(m_algorithmToolNames, m_featureToolMap, featureOrder, this, pCluster));
+    TrackShowerIdFeatureContext featureContext(LArGeometryHelper::GetWireZPitch(this->GetPandora()));
+    const LArMvaHelper::MvaFeatureMap featureMap(
+        LArMvaHelper::CalculateFeatures(m_algorithmToolNames, m_featureToolMap, featureOrder, this, pCluster, featureContext));
 
     if (m_trainingSetMode)
     {
@@ -65,7 +69,7 @@ bool MvaPfoCharacterisationAlgorithm<T>::IsClearTrack(const Cluster *const pClus
         {
         }
 
-        LArMvaHelper::ProduceTrainingExample(m_trainingOutputFile, isTrueTrack, featureOrder, featureMap);
+        LArMvaHelper::ProduceTrainingExample(m_trainingOutputFile, isTrueTrack, featureOrder, featureMap, m_trainingOutputFormat);
         return isTrueTrack;
     }
 
@@ -102,8 +106,9 @@ bool MvaPfoCharacterisationAlgorithm<T>::IsClearTrack(const pandora::ParticleFlo
     const PfoCharacterisationFeatureTool::FeatureToolMap &chosenFeatureToolMap(wClusterList.empty() ? m_featureToolMapNoChargeInfo : m_featureToolMapThreeD);
     const StringVector chosenFeatureToolOrder(wClusterList.empty() ? m_algorithmToolNamesNoChargeInfo : m_algorithmToolNames);
     StringVector featureOrder;
+    TrackShowerIdFeatureContext featureContext(LArGeometryHelper::GetWireZPitch(this->GetPandora()));
     const LArMvaHelper::MvaFeatureMap featureMap(
-        LArMvaHelper::CalculateFeatures(chosenFeatureToolOrder, chosenFeatureToolMap, featureOrder, this, pPfo));
+        LArMvaHelper::CalculateFeatures(chosenFeatureToolOrder, chosenFeatureToolMap, featureOrder, this, pPfo, featureContext));
 
     for (auto const &[featureKey, featureValue] : featureMap)
     {
@@ -231,7 +236,7 @@ bool MvaPfoCharacterisationAlgorithm<T>::IsClearTrack(const pandora::ParticleFlo
                 std::string outputFile(m_trainingOutputFile);
                 const std::string end = ((wClusterList.empty()) ? "noChargeInfo.txt" : ".txt");
                 outputFile.append(end);
-                LArMvaHelper::ProduceTrainingExample(outputFile, isTrueTrack, featureOrder, featureMap);
+                LArMvaHelper::ProduceTrainingExample(outputFile, isTrueTrack, featureOrder, featureMap, m_trainingOutputFormat);
             }
         }
 
@@ -256,7 +261,7 @@ bool MvaPfoCharacterisationAlgorithm<T>::IsClearTrack(const pandora::ParticleFlo
         {
             std::string outputFile(m_trainingOutputFile);
             outputFile.append(wClusterList.empty() ? "noChargeInfo.txt" : ".txt");
-            LArMvaHelper::ProduceTrainingExample(outputFile, isTrueTrack, featureOrder, featureMap);
+            LArMvaHelper::ProduceTrainingExample(outputFile, isTrueTrack, featureOrder, featureMap, m_trainingOutputFormat);
         }
 
         return isTrueTrack;
@@ -286,6 +291,15 @@ bool MvaPfoCharacterisationAlgorithm<T>::IsClearTrack(const pandora::ParticleFlo
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+StatusCode MvaPfoCharacterisationAlgorithm<T>::Reset()
+{
+    LArMvaHelper::FlushTrainingExamples();
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 StatusCode MvaPfoCharacterisationAlgorithm<T>::ReadSettings(const TiXmlHandle xmlHandle)
 {
@@ -359,6 +373,7 @@ StatusCode MvaPfoCharacterisationAlgorithm<T>::ReadSettings(const TiXmlHandle xm
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "CaloHitListName", m_caloHitListName));
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "MCParticleListName", m_mcParticleListName));
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "TrainingOutputFileName", m_trainingOutputFile));
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArMvaHelper::ReadTrainingOutputFormat(xmlHandle, m_trainingOutputFormat));
         PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "TestBeamMode", m_testBeamMode));
         PANDORA_RETURN_RESULT_IF_AND_IF(
             STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "ApplyFiducialCut", m_applyFiducialCut));
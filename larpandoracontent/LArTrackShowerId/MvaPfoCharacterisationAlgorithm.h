@@ -36,6 +36,7 @@ public:
 protected:
     virtual bool IsClearTrack(const pandora::ParticleFlowObject *const pPfo) const;
     virtual bool IsClearTrack(const pandora::Cluster *const pCluster) const;
+    pandora::StatusCode Reset();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
     ClusterCharacterisationFeatureTool::FeatureToolMap m_featureToolMap; ///< The feature tool map
@@ -68,12 +69,13 @@ protected:
     std::string m_caloHitListName;    ///< Name of input calo hit list
     std::string m_mcParticleListName; ///< Name of input MC particle list
 
-    std::string m_trainingOutputFile;          ///< The training output file
-    std::string m_filePathEnvironmentVariable; ///< The environment variable providing a list of paths to mva files
-    std::string m_mvaFileName;                 ///< The mva input file
-    std::string m_mvaName;                     ///< The name of the mva to find
-    std::string m_mvaFileNameNoChargeInfo;     ///< The mva input file for PFOs missing the W view, and thus charge info
-    std::string m_mvaNameNoChargeInfo;         ///< The name of the mva to find for PFOs missing the W view, and thus charge info
+    std::string m_trainingOutputFile;                          ///< The training output file
+    LArMvaHelper::TrainingOutputFormat m_trainingOutputFormat; ///< The format of the training output file
+    std::string m_filePathEnvironmentVariable;                 ///< The environment variable providing a list of paths to mva files
+    std::string m_mvaFileName;                                 ///< The mva input file
+    std::string m_mvaName;                                     ///< The name of the mva to find
+    std::string m_mvaFileNameNoChargeInfo;                     ///< The mva input file for PFOs missing the W view, and thus charge info
+    std::string m_mvaNameNoChargeInfo; ///< The name of the mva to find for PFOs missing the W view, and thus charge info
 
     LArMCParticleHelper::PrimaryParameters m_primaryParameters; ///< The mc particle primary selection parameters
 
@@ -185,7 +185,7 @@ void ShowerGrowingAlgorithm::GetAllVertexSeedCandidates(const ClusterList *const
 
         try
         {
-            if (this->IsVertexAssociated(LArPointingCluster(pCluster), vertexPosition2D))
+            if (this->IsVertexAssociated(LArPointingClusterHelper::GetPointingCluster(pCluster), vertexPosition2D))
                 seedClusters.push_back(pCluster);
         }
         catch (StatusCodeException &)
@@ -382,7 +382,7 @@ float ShowerGrowingAlgorithm::GetFigureOfMerit(const SeedAssociationList &seedAs
         LArPointingClusterList pointingClusterSeedList;
         try
         {
-            pointingClusterSeedList.push_back(LArPointingCluster(pSeedCluster));
+            pointingClusterSeedList.push_back(LArPointingClusterHelper::GetPointingCluster(pSeedCluster));
         }
         catch (StatusCodeException &)
         {
@@ -393,7 +393,7 @@ float ShowerGrowingAlgorithm::GetFigureOfMerit(const SeedAssociationList &seedAs
         {
             try
             {
-                pointingClusterNonSeedList.push_back(LArPointingCluster(pAssociatedCluster));
+                pointingClusterNonSeedList.push_back(LArPointingClusterHelper::GetPointingCluster(pAssociatedCluster));
             }
             catch (StatusCodeException &)
             {
@@ -24,6 +24,124 @@ using namespace pandora;
 namespace lar_content
 {
 
+TrackShowerIdFeatureContext::PcaResults::PcaResults() :
+    m_centroid(0.f, 0.f, 0.f),
+    m_eigenValues(0.f, 0.f, 0.f)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+TrackShowerIdFeatureContext::TrackShowerIdFeatureContext(const float slidingFitPitch) :
+    m_slidingFitPitch(slidingFitPitch)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const TwoDSlidingFitResult &TrackShowerIdFeatureContext::GetSlidingFitResult(
+    const Cluster *const pCluster, const unsigned int slidingFitWindow)
+{
+    const ClusterWindowPair clusterWindowPair(pCluster, slidingFitWindow);
+    SlidingFitResultMap::const_iterator iter(m_slidingFitResultMap.find(clusterWindowPair));
+
+    if (m_slidingFitResultMap.end() != iter)
+        return iter->second;
+
+    SlidingFitStatusCodeMap::const_iterator statusIter(m_slidingFitStatusCodeMap.find(clusterWindowPair));
+
+    if (m_slidingFitStatusCodeMap.end() != statusIter)
+        throw StatusCodeException(statusIter->second);
+
+    try
+    {
+        const TwoDSlidingFitResult slidingFitResult(pCluster, slidingFitWindow, m_slidingFitPitch);
+        return m_slidingFitResultMap.emplace(clusterWindowPair, slidingFitResult).first->second;
+    }
+    catch (const StatusCodeException &statusCodeException)
+    {
+        m_slidingFitStatusCodeMap.emplace(clusterWindowPair, statusCodeException.GetStatusCode());
+        throw;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const CaloHitList &TrackShowerIdFeatureContext::GetCaloHitList(const Cluster *const pCluster)
+{
+    CaloHitListMap::const_iterator iter(m_caloHitListMap.find(pCluster));
+
+    if (m_caloHitListMap.end() != iter)
+        return iter->second;
+
+    CaloHitList &caloHitList(m_caloHitListMap[pCluster]);
+    pCluster->GetOrderedCaloHitList().FillCaloHitList(caloHitList);
+
+    return caloHitList;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const CaloHitList &TrackShowerIdFeatureContext::GetThreeDCaloHitList(const ParticleFlowObject *const pPfo)
+{
+    CaloHitListMap::const_iterator iter(m_caloHitListMap.find(pPfo));
+
+    if (m_caloHitListMap.end() != iter)
+        return iter->second;
+
+    CaloHitList &caloHitList(m_caloHitListMap[pPfo]);
+    LArPfoHelper::GetCaloHits(pPfo, TPC_3D, caloHitList);
+
+    return caloHitList;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const TrackShowerIdFeatureContext::PcaResults &TrackShowerIdFeatureContext::GetPcaResults(const Cluster *const pCluster)
+{
+    return this->GetPcaResults(pCluster, this->GetCaloHitList(pCluster));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const TrackShowerIdFeatureContext::PcaResults &TrackShowerIdFeatureContext::GetThreeDPcaResults(const ParticleFlowObject *const pPfo)
+{
+    return this->GetPcaResults(pPfo, this->GetThreeDCaloHitList(pPfo));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const TrackShowerIdFeatureContext::PcaResults &TrackShowerIdFeatureContext::GetPcaResults(
+    const void *const pObject, const CaloHitList &caloHitList)
+{
+    PcaResultsMap::const_iterator iter(m_pcaResultsMap.find(pObject));
+
+    if (m_pcaResultsMap.end() != iter)
+        return iter->second;
+
+    PcaStatusCodeMap::const_iterator statusIter(m_pcaStatusCodeMap.find(pObject));
+
+    if (m_pcaStatusCodeMap.end() != statusIter)
+        throw StatusCodeException(statusIter->second);
+
+    PcaResults pcaResults;
+
+    try
+    {
+        LArPcaHelper::RunPca(caloHitList, pcaResults.m_centroid, pcaResults.m_eigenValues, pcaResults.m_eigenVecs);
+    }
+    catch (const StatusCodeException &statusCodeException)
+    {
+        m_pcaStatusCodeMap.emplace(pObject, statusCodeException.GetStatusCode());
+        throw;
+    }
+
+    return m_pcaResultsMap.emplace(pObject, pcaResults).first->second;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 TwoDShowerFitFeatureTool::TwoDShowerFitFeatureTool() :
     m_slidingShowerFitWindow(3),
     m_slidingLinearFitWindow(10000)
@@ -32,7 +150,8 @@ TwoDShowerFitFeatureTool::TwoDShowerFitFeatureTool() :
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void TwoDShowerFitFeatureTool::Run(LArMvaHelper::MvaFeatureVector &featureVector, const Algorithm *const pAlgorithm, const pandora::Cluster *const pCluster)
+void TwoDShowerFitFeatureTool::Run(LArMvaHelper::MvaFeatureVector &featureVector, const Algorithm *const pAlgorithm,
+    const pandora::Cluster *const pCluster, TrackShowerIdFeatureContext &featureContext)
 {
     if (PandoraContentApi::GetSettings(*pAlgorithm)->ShouldDisplayAlgorithmInfo())
         std::cout << "----> Running Algorithm Tool: " << this->GetInstanceName() << ", " << this->GetType() << std::endl;
@@ -40,7 +159,7 @@ void TwoDShowerFitFeatureTool::Run(LArMvaHelper::MvaFeatureVector &featureVector
     float ratio(-1.f);
     try
     {
-        const TwoDSlidingFitResult slidingFitResultLarge(pCluster, m_slidingLinearFitWindow, LArGeometryHelper::GetWireZPitch(this->GetPandora()));
+        const TwoDSlidingFitResult &slidingFitResultLarge(featureContext.GetSlidingFitResult(pCluster, m_slidingLinearFitWindow));
         const float straightLineLength =
             (slidingFitResultLarge.GetGlobalMaxLayerPosition() - slidingFitResultLarge.GetGlobalMinLayerPosition()).GetMagnitude();
         if (straightLineLength > std::numeric_limits<float>::epsilon())
@@ -56,10 +175,10 @@ void TwoDShowerFitFeatureTool::Run(LArMvaHelper::MvaFeatureVector &featureVector
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void TwoDShowerFitFeatureTool::Run(LArMvaHelper::MvaFeatureMap &featureMap, StringVector &featureOrder, const std::string &featureToolName,
-    const Algorithm *const pAlgorithm, const pandora::Cluster *const pCluster)
+    const Algorithm *const pAlgorithm, const pandora::Cluster *const pCluster, TrackShowerIdFeatureContext &featureContext)
 {
     LArMvaHelper::MvaFeatureVector toolFeatureVec;
-    this->Run(toolFeatureVec, pAlgorithm, pCluster);
+    this->Run(toolFeatureVec, pAlgorithm, pCluster, featureContext);
 
     if (featureMap.find(featureToolName + "_WidthLenRatio") != featureMap.end())
     {
@@ -95,15 +214,16 @@ TwoDLinearFitFeatureTool::TwoDLinearFitFeatureTool() :
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void TwoDLinearFitFeatureTool::Run(LArMvaHelper::MvaFeatureVector &featureVector, const Algorithm *const pAlgorithm, const pandora::Cluster *const pCluster)
+void TwoDLinearFitFeatureTool::Run(LArMvaHelper::MvaFeatureVector &featureVector, const Algorithm *const pAlgorithm,
+    const pandora::Cluster *const pCluster, TrackShowerIdFeatureContext &featureContext)
 {
     if (PandoraContentApi::GetSettings(*pAlgorithm)->ShouldDisplayAlgorithmInfo())
         std::cout << "----> Running Algorithm Tool: " << this->GetInstanceName() << ", " << this->GetType() << std::endl;
 
     float dTdLWidth(-1.f), straightLineLengthLarge(-1.f), diffWithStraightLineMean(-1.f), diffWithStraightLineSigma(-1.f),
         maxFitGapLength(-1.f), rmsSlidingLinearFit(-1.f);
-    this->CalculateVariablesSlidingLinearFit(pCluster, straightLineLengthLarge, diffWithStraightLineMean, diffWithStraightLineSigma,
-        dTdLWidth, maxFitGapLength, rmsSlidingLinearFit);
+    this->CalculateVariablesSlidingLinearFit(pCluster, featureContext, straightLineLengthLarge, diffWithStraightLineMean,
+        diffWithStraightLineSigma, dTdLWidth, maxFitGapLength, rmsSlidingLinearFit);
 
     if (straightLineLengthLarge > std::numeric_limits<float>::epsilon())
     {
@@ -125,10 +245,10 @@ void TwoDLinearFitFeatureTool::Run(LArMvaHelper::MvaFeatureVector &featureVector
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void TwoDLinearFitFeatureTool::Run(LArMvaHelper::MvaFeatureMap &featureMap, StringVector &featureOrder, const std::string &featureToolName,
-    const Algorithm *const pAlgorithm, const pandora::Cluster *const pCluster)
+    const Algorithm *const pAlgorithm, const pandora::Cluster *const pCluster, TrackShowerIdFeatureContext &featureContext)
 {
     LArMvaHelper::MvaFeatureVector toolFeatureVec;
-    this->Run(toolFeatureVec, pAlgorithm, pCluster);
+    this->Run(toolFeatureVec, pAlgorithm, pCluster, featureContext);
 
     if (featureMap.find(featureToolName + "_StLineLenLarge") != featureMap.end() ||
         featureMap.find(featureToolName + "_DiffStLineMean") != featureMap.end() ||
@@ -158,14 +278,14 @@ void TwoDLinearFitFeatureTool::Run(LArMvaHelper::MvaFeatureMap &featureMap, Stri
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void TwoDLinearFitFeatureTool::CalculateVariablesSlidingLinearFit(const pandora::Cluster *const pCluster, float &straightLineLengthLarge,
-    float &diffWithStraightLineMean, float &diffWithStraightLineSigma, float &dTdLWidth, float &maxFitGapLength, float &rmsSlidingLinearFit) const
+void TwoDLinearFitFeatureTool::CalculateVariablesSlidingLinearFit(const pandora::Cluster *const pCluster,
+    TrackShowerIdFeatureContext &featureContext, float &straightLineLengthLarge, float &diffWithStraightLineMean,
+    float &diffWithStraightLineSigma, float &dTdLWidth, float &maxFitGapLength, float &rmsSlidingLinearFit) const
 {
     try
     {
-        const TwoDSlidingFitResult slidingFitResult(pCluster, m_slidingLinearFitWindow, LArGeometryHelper::GetWireZPitch(this->GetPandora()));
-        const TwoDSlidingFitResult slidingFitResultLarge(
-            pCluster, m_slidingLinearFitWindowLarge, LArGeometryHelper::GetWireZPitch(this->GetPandora()));
+        const TwoDSlidingFitResult &slidingFitResult(featureContext.GetSlidingFitResult(pCluster, m_slidingLinearFitWindow));
+        const TwoDSlidingFitResult &slidingFitResultLarge(featureContext.GetSlidingFitResult(pCluster, m_slidingLinearFitWindowLarge));
 
         if (slidingFitResult.GetLayerFitResultMap().empty())
             throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
@@ -267,8 +387,8 @@ TwoDVertexDistanceFeatureTool::TwoDVertexDistanceFeatureTool() :
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void TwoDVertexDistanceFeatureTool::Run(
-    LArMvaHelper::MvaFeatureVector &featureVector, const Algorithm *const pAlgorithm, const pandora::Cluster *const pCluster)
+void TwoDVertexDistanceFeatureTool::Run(LArMvaHelper::MvaFeatureVector &featureVector, const Algorithm *const pAlgorithm,
+    const pandora::Cluster *const pCluster, TrackShowerIdFeatureContext &featureContext)
 {
     if (PandoraContentApi::GetSettings(*pAlgorithm)->ShouldDisplayAlgorithmInfo())
         std::cout << "----> Running Algorithm Tool: " << this->GetInstanceName() << ", " << this->GetType() << std::endl;
@@ -276,7 +396,7 @@ void TwoDVertexDistanceFeatureTool::Run(
     float straightLineLength(-1.f), ratio(-1.f);
     try
     {
-        const TwoDSlidingFitResult slidingFitResultLarge(pCluster, m_slidingLinearFitWindow, LArGeometryHelper::GetWireZPitch(this->GetPandora()));
+        const TwoDSlidingFitResult &slidingFitResultLarge(featureContext.GetSlidingFitResult(pCluster, m_slidingLinearFitWindow));
         straightLineLength = (slidingFitResultLarge.GetGlobalMaxLayerPosition() - slidingFitResultLarge.GetGlobalMinLayerPosition()).GetMagnitude();
         if (straightLineLength > std::numeric_limits<float>::epsilon())
             ratio = (CutClusterCharacterisationAlgorithm::GetVertexDistance(pAlgorithm, pCluster)) / straightLineLength;
@@ -291,10 +411,11 @@ void TwoDVertexDistanceFeatureTool::Run(
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void TwoDVertexDistanceFeatureTool::Run(LArMvaHelper::MvaFeatureMap &featureMap, StringVector &featureOrder,
-    const std::string &featureToolName, const Algorithm *const pAlgorithm, const pandora::Cluster *const pCluster)
+    const std::string &featureToolName, const Algorithm *const pAlgorithm, const pandora::Cluster *const pCluster,
+    TrackShowerIdFeatureContext &featureContext)
 {
     LArMvaHelper::MvaFeatureVector toolFeatureVec;
-    this->Run(toolFeatureVec, pAlgorithm, pCluster);
+    this->Run(toolFeatureVec, pAlgorithm, pCluster, featureContext);
 
     if (featureMap.find(featureToolName + "_DistLenRatio") != featureMap.end())
     {
@@ -325,15 +446,13 @@ PfoHierarchyFeatureTool::PfoHierarchyFeatureTool()
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void PfoHierarchyFeatureTool::Run(
-    LArMvaHelper::MvaFeatureVector &featureVector, const Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pInputPfo)
+void PfoHierarchyFeatureTool::Run(LArMvaHelper::MvaFeatureVector &featureVector, const Algorithm *const pAlgorithm,
+    const pandora::ParticleFlowObject *const pInputPfo, TrackShowerIdFeatureContext &featureContext)
 {
     if (PandoraContentApi::GetSettings(*pAlgorithm)->ShouldDisplayAlgorithmInfo())
         std::cout << "----> Running Algorithm Tool: " << this->GetInstanceName() << ", " << this->GetType() << std::endl;
 
-    CaloHitList parent3DHitList;
-    LArPfoHelper::GetCaloHits(pInputPfo, TPC_3D, parent3DHitList);
-    const unsigned int nParentHits3D(parent3DHitList.size());
+    const unsigned int nParentHits3D(featureContext.GetThreeDCaloHitList(pInputPfo).size());
 
     PfoList allDaughtersPfoList;
     LArPfoHelper::GetAllDownstreamPfos(pInputPfo, allDaughtersPfoList);
@@ -367,10 +486,11 @@ void PfoHierarchyFeatureTool::Run(
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void PfoHierarchyFeatureTool::Run(LArMvaHelper::MvaFeatureMap &featureMap, StringVector &featureOrder, const std::string &featureToolName,
-    const pandora::Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pInputPfo)
+    const pandora::Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pInputPfo,
+    TrackShowerIdFeatureContext &featureContext)
 {
     LArMvaHelper::MvaFeatureVector toolFeatureVec;
-    this->Run(toolFeatureVec, pAlgorithm, pInputPfo);
+    this->Run(toolFeatureVec, pAlgorithm, pInputPfo, featureContext);
 
     if (featureMap.find(featureToolName + "_NDaughters") != featureMap.end() ||
         featureMap.find(featureToolName + "_NDaughterHits3D") != featureMap.end() ||
@@ -410,8 +530,8 @@ ConeChargeFeatureTool::ConeChargeFeatureTool() :
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void ConeChargeFeatureTool::Run(
-    LArMvaHelper::MvaFeatureVector &featureVector, const Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pInputPfo)
+void ConeChargeFeatureTool::Run(LArMvaHelper::MvaFeatureVector &featureVector, const Algorithm *const pAlgorithm,
+    const pandora::ParticleFlowObject *const pInputPfo, TrackShowerIdFeatureContext &featureContext)
 {
     if (PandoraContentApi::GetSettings(*pAlgorithm)->ShouldDisplayAlgorithmInfo())
         std::cout << "----> Running Algorithm Tool: " << this->GetInstanceName() << ", " << this->GetType() << std::endl;
@@ -423,14 +543,10 @@ void ConeChargeFeatureTool::Run(
 
     if (!clusterListW.empty())
     {
-        CaloHitList clusterCaloHitList;
-        clusterListW.front()->GetOrderedCaloHitList().FillCaloHitList(clusterCaloHitList);
+        const CaloHitList &clusterCaloHitList(featureContext.GetCaloHitList(clusterListW.front()));
 
         const CartesianVector &pfoStart(clusterCaloHitList.front()->GetPositionVector());
-        CartesianVector centroid(0.f, 0.f, 0.f);
-        LArPcaHelper::EigenVectors eigenVecs;
-        LArPcaHelper::EigenValues eigenValues(0.f, 0.f, 0.f);
-        LArPcaHelper::RunPca(clusterCaloHitList, centroid, eigenValues, eigenVecs);
+        const LArPcaHelper::EigenVectors &eigenVecs(featureContext.GetPcaResults(clusterListW.front()).m_eigenVecs);
 
         float chargeCore(0.f), chargeHalo(0.f), chargeCon(0.f);
         this->CalculateChargeDistribution(clusterCaloHitList, pfoStart, eigenVecs[0], chargeCore, chargeHalo, chargeCon);
@@ -450,10 +566,11 @@ void ConeChargeFeatureTool::Run(
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void ConeChargeFeatureTool::Run(LArMvaHelper::MvaFeatureMap &featureMap, StringVector &featureOrder, const std::string &featureToolName,
-    const pandora::Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pInputPfo)
+    const pandora::Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pInputPfo,
+    TrackShowerIdFeatureContext &featureContext)
 {
     LArMvaHelper::MvaFeatureVector toolFeatureVec;
-    this->Run(toolFeatureVec, pAlgorithm, pInputPfo);
+    this->Run(toolFeatureVec, pAlgorithm, pInputPfo, featureContext);
 
     if (featureMap.find(featureToolName + "_HaloTotalRatio") != featureMap.end() ||
         featureMap.find(featureToolName + "_Concentration") != featureMap.end() ||
@@ -552,8 +669,8 @@ ThreeDLinearFitFeatureTool::ThreeDLinearFitFeatureTool() :
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void ThreeDLinearFitFeatureTool::Run(
-    LArMvaHelper::MvaFeatureVector &featureVector, const Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pInputPfo)
+void ThreeDLinearFitFeatureTool::Run(LArMvaHelper::MvaFeatureVector &featureVector, const Algorithm *const pAlgorithm,
+    const pandora::ParticleFlowObject *const pInputPfo, TrackShowerIdFeatureContext &featureContext)
 {
     if (PandoraContentApi::GetSettings(*pAlgorithm)->ShouldDisplayAlgorithmInfo())
         std::cout << "----> Running Algorithm Tool: " << this->GetInstanceName() << ", " << this->GetType() << std::endl;
@@ -569,8 +686,8 @@ void ThreeDLinearFitFeatureTool::Run(
         float straightLineLengthLargeCluster(-1.f), diffWithStraightLineMeanCluster(-1.f), maxFitGapLengthCluster(-1.f),
             rmsSlidingLinearFitCluster(-1.f);
 
-        this->CalculateVariablesSlidingLinearFit(
-            pCluster, straightLineLengthLargeCluster, diffWithStraightLineMeanCluster, maxFitGapLengthCluster, rmsSlidingLinearFitCluster);
+        this->CalculateVariablesSlidingLinearFit(pCluster, featureContext, straightLineLengthLargeCluster, diffWithStraightLineMeanCluster,
+            maxFitGapLengthCluster, rmsSlidingLinearFitCluster);
 
         if (straightLineLengthLargeCluster > std::numeric_limits<float>::epsilon())
         {
@@ -604,10 +721,11 @@ void ThreeDLinearFitFeatureTool::Run(
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void ThreeDLinearFitFeatureTool::Run(LArMvaHelper::MvaFeatureMap &featureMap, StringVector &featureOrder,
-    const std::string &featureToolName, const pandora::Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pInputPfo)
+    const std::string &featureToolName, const pandora::Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pInputPfo,
+    TrackShowerIdFeatureContext &featureContext)
 {
     LArMvaHelper::MvaFeatureVector toolFeatureVec;
-    this->Run(toolFeatureVec, pAlgorithm, pInputPfo);
+    this->Run(toolFeatureVec, pAlgorithm, pInputPfo, featureContext);
 
     if (featureMap.find(featureToolName + "_Length") != featureMap.end() ||
         featureMap.find(featureToolName + "_DiffStraightLineMean") != featureMap.end() ||
@@ -631,14 +749,14 @@ void ThreeDLinearFitFeatureTool::Run(LArMvaHelper::MvaFeatureMap &featureMap, St
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void ThreeDLinearFitFeatureTool::CalculateVariablesSlidingLinearFit(const pandora::Cluster *const pCluster, float &straightLineLengthLarge,
-    float &diffWithStraightLineMean, float &maxFitGapLength, float &rmsSlidingLinearFit) const
+void ThreeDLinearFitFeatureTool::CalculateVariablesSlidingLinearFit(const pandora::Cluster *const pCluster,
+    TrackShowerIdFeatureContext &featureContext, float &straightLineLengthLarge, float &diffWithStraightLineMean, float &maxFitGapLength,
+    float &rmsSlidingLinearFit) const
 {
     try
     {
-        const TwoDSlidingFitResult slidingFitResult(pCluster, m_slidingLinearFitWindow, LArGeometryHelper::GetWireZPitch(this->GetPandora()));
-        const TwoDSlidingFitResult slidingFitResultLarge(
-            pCluster, m_slidingLinearFitWindowLarge, LArGeometryHelper::GetWireZPitch(this->GetPandora()));
+        const TwoDSlidingFitResult &slidingFitResult(featureContext.GetSlidingFitResult(pCluster, m_slidingLinearFitWindow));
+        const TwoDSlidingFitResult &slidingFitResultLarge(featureContext.GetSlidingFitResult(pCluster, m_slidingLinearFitWindowLarge));
 
         if (slidingFitResult.GetLayerFitResultMap().empty())
             throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
@@ -731,8 +849,8 @@ ThreeDVertexDistanceFeatureTool::ThreeDVertexDistanceFeatureTool()
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void ThreeDVertexDistanceFeatureTool::Run(
-    LArMvaHelper::MvaFeatureVector &featureVector, const Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pInputPfo)
+void ThreeDVertexDistanceFeatureTool::Run(LArMvaHelper::MvaFeatureVector &featureVector, const Algorithm *const pAlgorithm,
+    const pandora::ParticleFlowObject *const pInputPfo, TrackShowerIdFeatureContext &featureContext)
 {
     if (PandoraContentApi::GetSettings(*pAlgorithm)->ShouldDisplayAlgorithmInfo())
         std::cout << "----> Running Algorithm Tool: " << this->GetInstanceName() << ", " << this->GetType() << std::endl;
@@ -768,8 +886,7 @@ void ThreeDVertexDistanceFeatureTool::Run(
         }
         catch (const StatusCodeException &)
         {
-            CaloHitList threeDCaloHitList;
-            LArPfoHelper::GetCaloHits(pInputPfo, TPC_3D, threeDCaloHitList);
+            const CaloHitList &threeDCaloHitList(featureContext.GetThreeDCaloHitList(pInputPfo));
 
             if (!threeDCaloHitList.empty())
                 vertexDistance = (pInteractionVertex->GetPosition() - (threeDCaloHitList.front())->GetPositionVector()).GetMagnitude();
@@ -782,10 +899,11 @@ void ThreeDVertexDistanceFeatureTool::Run(
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void ThreeDVertexDistanceFeatureTool::Run(LArMvaHelper::MvaFeatureMap &featureMap, StringVector &featureOrder,
-    const std::string &featureToolName, const pandora::Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pInputPfo)
+    const std::string &featureToolName, const pandora::Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pInputPfo,
+    TrackShowerIdFeatureContext &featureContext)
 {
     LArMvaHelper::MvaFeatureVector toolFeatureVec;
-    this->Run(toolFeatureVec, pAlgorithm, pInputPfo);
+    this->Run(toolFeatureVec, pAlgorithm, pInputPfo, featureContext);
 
     if (featureMap.find(featureToolName + "_VertexDistance") != featureMap.end())
     {
@@ -816,15 +934,14 @@ ThreeDOpeningAngleFeatureTool::ThreeDOpeningAngleFeatureTool() :
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void ThreeDOpeningAngleFeatureTool::Run(
-    LArMvaHelper::MvaFeatureVector &featureVector, const Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pInputPfo)
+void ThreeDOpeningAngleFeatureTool::Run(LArMvaHelper::MvaFeatureVector &featureVector, const Algorithm *const pAlgorithm,
+    const pandora::ParticleFlowObject *const pInputPfo, TrackShowerIdFeatureContext &featureContext)
 {
     if (PandoraContentApi::GetSettings(*pAlgorithm)->ShouldDisplayAlgorithmInfo())
         std::cout << "----> Running Algorithm Tool: " << this->GetInstanceName() << ", " << this->GetType() << std::endl;
 
     // Need the 3D hits to calculate PCA components
-    CaloHitList threeDCaloHitList;
-    LArPfoHelper::GetCaloHits(pInputPfo, TPC_3D, threeDCaloHitList);
+    const CaloHitList &threeDCaloHitList(featureContext.GetThreeDCaloHitList(pInputPfo));
 
     LArMvaHelper::MvaFeature diffAngle;
     if (!threeDCaloHitList.empty())
@@ -865,10 +982,11 @@ void ThreeDOpeningAngleFeatureTool::Run(
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void ThreeDOpeningAngleFeatureTool::Run(LArMvaHelper::MvaFeatureMap &featureMap, StringVector &featureOrder,
-    const std::string &featureToolName, const pandora::Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pInputPfo)
+    const std::string &featureToolName, const pandora::Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pInputPfo,
+    TrackShowerIdFeatureContext &featureContext)
 {
     LArMvaHelper::MvaFeatureVector toolFeatureVec;
-    this->Run(toolFeatureVec, pAlgorithm, pInputPfo);
+    this->Run(toolFeatureVec, pAlgorithm, pInputPfo, featureContext);
 
     if (featureMap.find(featureToolName + "_AngleDiff") != featureMap.end())
     {
@@ -987,8 +1105,8 @@ ThreeDPCAFeatureTool::ThreeDPCAFeatureTool()
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void ThreeDPCAFeatureTool::Run(
-    LArMvaHelper::MvaFeatureVector &featureVector, const Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pInputPfo)
+void ThreeDPCAFeatureTool::Run(LArMvaHelper::MvaFeatureVector &featureVector, const Algorithm *const pAlgorithm,
+    const pandora::ParticleFlowObject *const pInputPfo, TrackShowerIdFeatureContext &featureContext)
 {
     if (PandoraContentApi::GetSettings(*pAlgorithm)->ShouldDisplayAlgorithmInfo())
         std::cout << "----> Running Algorithm Tool: " << this->GetInstanceName() << ", " << this->GetType() << std::endl;
@@ -996,18 +1114,13 @@ void ThreeDPCAFeatureTool::Run(
     LArMvaHelper::MvaFeature pca1, pca2;
 
     // Need the 3D hits to calculate PCA components
-    CaloHitList threeDCaloHitList;
-    LArPfoHelper::GetCaloHits(pInputPfo, TPC_3D, threeDCaloHitList);
+    const CaloHitList &threeDCaloHitList(featureContext.GetThreeDCaloHitList(pInputPfo));
 
     if (!threeDCaloHitList.empty())
     {
         try
         {
-            CartesianVector centroid(0.f, 0.f, 0.f);
-            LArPcaHelper::EigenVectors eigenVecs;
-            LArPcaHelper::EigenValues eigenValues(0.f, 0.f, 0.f);
-
-            LArPcaHelper::RunPca(threeDCaloHitList, centroid, eigenValues, eigenVecs);
+            const LArPcaHelper::EigenValues &eigenValues(featureContext.GetThreeDPcaResults(pInputPfo).m_eigenValues);
             const float principalEigenvalue(eigenValues.GetX()), secondaryEigenvalue(eigenValues.GetY()), tertiaryEigenvalue(eigenValues.GetZ());
 
             if (principalEigenvalue > std::numeric_limits<float>::epsilon())
@@ -1034,10 +1147,11 @@ void ThreeDPCAFeatureTool::Run(
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void ThreeDPCAFeatureTool::Run(LArMvaHelper::MvaFeatureMap &featureMap, StringVector &featureOrder, const std::string &featureToolName,
-    const pandora::Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pInputPfo)
+    const pandora::Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pInputPfo,
+    TrackShowerIdFeatureContext &featureContext)
 {
     LArMvaHelper::MvaFeatureVector toolFeatureVec;
-    this->Run(toolFeatureVec, pAlgorithm, pInputPfo);
+    this->Run(toolFeatureVec, pAlgorithm, pInputPfo, featureContext);
 
     if (featureMap.find(featureToolName + "_SecondaryPCARatio") != featureMap.end() ||
         featureMap.find(featureToolName + "_TertiaryPCARatio") != featureMap.end())
@@ -1070,8 +1184,8 @@ ThreeDChargeFeatureTool::ThreeDChargeFeatureTool() :
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void ThreeDChargeFeatureTool::Run(
-    LArMvaHelper::MvaFeatureVector &featureVector, const Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pInputPfo)
+void ThreeDChargeFeatureTool::Run(LArMvaHelper::MvaFeatureVector &featureVector, const Algorithm *const pAlgorithm,
+    const pandora::ParticleFlowObject *const pInputPfo, TrackShowerIdFeatureContext &featureContext)
 {
     if (PandoraContentApi::GetSettings(*pAlgorithm)->ShouldDisplayAlgorithmInfo())
         std::cout << "----> Running Algorithm Tool: " << this->GetInstanceName() << ", " << this->GetType() << std::endl;
@@ -1083,7 +1197,7 @@ void ThreeDChargeFeatureTool::Run(
     LArPfoHelper::GetClusters(pInputPfo, TPC_VIEW_W, clusterListW);
 
     if (!clusterListW.empty())
-        this->CalculateChargeVariables(pAlgorithm, clusterListW.front(), totalCharge, chargeSigma, chargeMean, endCharge);
+        this->CalculateChargeVariables(pAlgorithm, clusterListW.front(), featureContext, totalCharge, chargeSigma, chargeMean, endCharge);
 
     if (chargeMean > std::numeric_limits<float>::epsilon())
         charge1 = chargeSigma / chargeMean;
@@ -1098,10 +1212,11 @@ void ThreeDChargeFeatureTool::Run(
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void ThreeDChargeFeatureTool::Run(LArMvaHelper::MvaFeatureMap &featureMap, StringVector &featureOrder, const std::string &featureToolName,
-    const pandora::Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pInputPfo)
+    const pandora::Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pInputPfo,
+    TrackShowerIdFeatureContext &featureContext)
 {
     LArMvaHelper::MvaFeatureVector toolFeatureVec;
-    this->Run(toolFeatureVec, pAlgorithm, pInputPfo);
+    this->Run(toolFeatureVec, pAlgorithm, pInputPfo, featureContext);
 
     if (featureMap.find(featureToolName + "_FractionalSpread") != featureMap.end() ||
         featureMap.find(featureToolName + "_EndFraction") != featureMap.end())
@@ -1120,7 +1235,7 @@ void ThreeDChargeFeatureTool::Run(LArMvaHelper::MvaFeatureMap &featureMap, Strin
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void ThreeDChargeFeatureTool::CalculateChargeVariables(const Algorithm *const pAlgorithm, const pandora::Cluster *const pCluster,
-    float &totalCharge, float &chargeSigma, float &chargeMean, float &endCharge)
+    TrackShowerIdFeatureContext &featureContext, float &totalCharge, float &chargeSigma, float &chargeMean, float &endCharge)
 {
     totalCharge = 0.f;
     chargeSigma = 0.f;
@@ -1128,7 +1243,7 @@ void ThreeDChargeFeatureTool::CalculateChargeVariables(const Algorithm *const pA
     endCharge = 0.f;
 
     CaloHitList orderedCaloHitList;
-    this->OrderCaloHitsByDistanceToVertex(pAlgorithm, pCluster, orderedCaloHitList);
+    this->OrderCaloHitsByDistanceToVertex(pAlgorithm, pCluster, featureContext, orderedCaloHitList);
 
     FloatVector chargeVector;
     unsigned int hitCounter(0);
@@ -1162,8 +1277,8 @@ void ThreeDChargeFeatureTool::CalculateChargeVariables(const Algorithm *const pA
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void ThreeDChargeFeatureTool::OrderCaloHitsByDistanceToVertex(
-    const Algorithm *const pAlgorithm, const pandora::Cluster *const pCluster, CaloHitList &caloHitList)
+void ThreeDChargeFeatureTool::OrderCaloHitsByDistanceToVertex(const Algorithm *const pAlgorithm, const pandora::Cluster *const pCluster,
+    TrackShowerIdFeatureContext &featureContext, CaloHitList &caloHitList)
 {
     const VertexList *pVertexList(nullptr);
     (void)PandoraContentApi::GetCurrentList(*pAlgorithm, pVertexList);
@@ -1188,9 +1303,7 @@ void ThreeDChargeFeatureTool::OrderCaloHitsByDistanceToVertex(
         const HitType hitType(LArClusterHelper::GetClusterHitType(pCluster));
         const CartesianVector vertexPosition2D(LArGeometryHelper::ProjectPosition(pAlgorithm->GetPandora(), pInteractionVertex->GetPosition(), hitType));
 
-        CaloHitList clusterCaloHitList;
-        pCluster->GetOrderedCaloHitList().FillCaloHitList(clusterCaloHitList);
-
+        CaloHitList clusterCaloHitList(featureContext.GetCaloHitList(pCluster));
         clusterCaloHitList.sort(ThreeDChargeFeatureTool::VertexComparator(vertexPosition2D));
         caloHitList.insert(caloHitList.end(), clusterCaloHitList.begin(), clusterCaloHitList.end());
     }
@@ -9,14 +9,123 @@
 #define LAR_TRACK_SHOWER_ID_FEATURE_TOOLS_H 1
 
 #include "larpandoracontent/LArHelpers/LArMvaHelper.h"
+#include "larpandoracontent/LArHelpers/LArPcaHelper.h"
+
+#include "larpandoracontent/LArObjects/LArTwoDSlidingFitResult.h"
 
 #include "Pandora/PandoraInternal.h"
 
+#include <unordered_map>
+
 namespace lar_content
 {
 
-typedef MvaFeatureTool<const pandora::Algorithm *const, const pandora::Cluster *const> ClusterCharacterisationFeatureTool;
-typedef MvaFeatureTool<const pandora::Algorithm *const, const pandora::ParticleFlowObject *const> PfoCharacterisationFeatureTool;
+/**
+ *  @brief  TrackShowerIdFeatureContext class, lazily calculating and memoising the intermediate products shared by the track shower id
+ *          feature tools when characterising an object. Failed calculations are memoised too, and rethrow the original status code.
+ */
+class TrackShowerIdFeatureContext
+{
+public:
+    /**
+     *  @brief  PcaResults class
+     */
+    class PcaResults
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        PcaResults();
+
+        pandora::CartesianVector m_centroid;     ///< The centroid
+        LArPcaHelper::EigenValues m_eigenValues; ///< The eigenvalues
+        LArPcaHelper::EigenVectors m_eigenVecs;  ///< The eigenvectors
+    };
+
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  slidingFitPitch the sliding fit z pitch, units cm
+     */
+    TrackShowerIdFeatureContext(const float slidingFitPitch);
+
+    /**
+     *  @brief  Get the sliding linear fit to a cluster, for a given sliding fit window
+     *
+     *  @param  pCluster address of the cluster
+     *  @param  slidingFitWindow the sliding fit window
+     *
+     *  @return the sliding fit result
+     */
+    const TwoDSlidingFitResult &GetSlidingFitResult(const pandora::Cluster *const pCluster, const unsigned int slidingFitWindow);
+
+    /**
+     *  @brief  Get the calo hits in a cluster, in ordered calo hit list order
+     *
+     *  @param  pCluster address of the cluster
+     *
+     *  @return the calo hit list
+     */
+    const pandora::CaloHitList &GetCaloHitList(const pandora::Cluster *const pCluster);
+
+    /**
+     *  @brief  Get the three dimensional calo hits in a pfo
+     *
+     *  @param  pPfo address of the pfo
+     *
+     *  @return the calo hit list
+     */
+    const pandora::CaloHitList &GetThreeDCaloHitList(const pandora::ParticleFlowObject *const pPfo);
+
+    /**
+     *  @brief  Get the results of principal component analysis of the calo hits in a cluster
+     *
+     *  @param  pCluster address of the cluster
+     *
+     *  @return the pca results
+     */
+    const PcaResults &GetPcaResults(const pandora::Cluster *const pCluster);
+
+    /**
+     *  @brief  Get the results of principal component analysis of the three dimensional calo hits in a pfo
+     *
+     *  @param  pPfo address of the pfo
+     *
+     *  @return the pca results
+     */
+    const PcaResults &GetThreeDPcaResults(const pandora::ParticleFlowObject *const pPfo);
+
+private:
+    typedef std::pair<const pandora::Cluster *, unsigned int> ClusterWindowPair;
+    typedef std::map<ClusterWindowPair, TwoDSlidingFitResult> SlidingFitResultMap;
+    typedef std::map<ClusterWindowPair, pandora::StatusCode> SlidingFitStatusCodeMap;
+    typedef std::unordered_map<const void *, pandora::CaloHitList> CaloHitListMap;
+    typedef std::unordered_map<const void *, PcaResults> PcaResultsMap;
+    typedef std::unordered_map<const void *, pandora::StatusCode> PcaStatusCodeMap;
+
+    /**
+     *  @brief  Get memoised pca results for an object, running the pca over the provided calo hits if not already attempted
+     *
+     *  @param  pObject address of the object, used as the memoisation key
+     *  @param  caloHitList the calo hits of the object
+     *
+     *  @return the pca results
+     */
+    const PcaResults &GetPcaResults(const void *const pObject, const pandora::CaloHitList &caloHitList);
+
+    float m_slidingFitPitch;                           ///< The sliding fit z pitch, units cm
+    SlidingFitResultMap m_slidingFitResultMap;         ///< The memoised sliding fit results
+    SlidingFitStatusCodeMap m_slidingFitStatusCodeMap; ///< The status codes of failed sliding fits
+    CaloHitListMap m_caloHitListMap;                   ///< The memoised calo hit lists, keyed by cluster or pfo
+    PcaResultsMap m_pcaResultsMap;                     ///< The memoised pca results, keyed by cluster or pfo
+    PcaStatusCodeMap m_pcaStatusCodeMap;               ///< The status codes of failed pca calculations, keyed by cluster or pfo
+};
+
+typedef MvaFeatureTool<const pandora::Algorithm *const, const pandora::Cluster *const, TrackShowerIdFeatureContext &>
+    ClusterCharacterisationFeatureTool;
+typedef MvaFeatureTool<const pandora::Algorithm *const, const pandora::ParticleFlowObject *const, TrackShowerIdFeatureContext &>
+    PfoCharacterisationFeatureTool;
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -31,9 +140,10 @@ public:
      */
     TwoDShowerFitFeatureTool();
 
-    void Run(LArMvaHelper::MvaFeatureVector &featureVector, const pandora::Algorithm *const pAlgorithm, const pandora::Cluster *const pCluster);
+    void Run(LArMvaHelper::MvaFeatureVector &featureVector, const pandora::Algorithm *const pAlgorithm,
+        const pandora::Cluster *const pCluster, TrackShowerIdFeatureContext &featureContext);
     void Run(LArMvaHelper::MvaFeatureMap &featureMap, pandora::StringVector &featureOrder, const std::string &featureToolName,
-        const pandora::Algorithm *const pAlgorithm, const pandora::Cluster *const pCluster);
+        const pandora::Algorithm *const pAlgorithm, const pandora::Cluster *const pCluster, TrackShowerIdFeatureContext &featureContext);
 
 private:
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
@@ -65,9 +175,10 @@ public:
      */
     TwoDLinearFitFeatureTool();
 
-    void Run(LArMvaHelper::MvaFeatureVector &featureVector, const pandora::Algorithm *const pAlgorithm, const pandora::Cluster *const pCluster);
+    void Run(LArMvaHelper::MvaFeatureVector &featureVector, const pandora::Algorithm *const pAlgorithm,
+        const pandora::Cluster *const pCluster, TrackShowerIdFeatureContext &featureContext);
     void Run(LArMvaHelper::MvaFeatureMap &featureMap, pandora::StringVector &featureOrder, const std::string &featureToolName,
-        const pandora::Algorithm *const pAlgorithm, const pandora::Cluster *const pCluster);
+        const pandora::Algorithm *const pAlgorithm, const pandora::Cluster *const pCluster, TrackShowerIdFeatureContext &featureContext);
 
 private:
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
@@ -76,6 +187,7 @@ private:
      *  @brief  Calculation of several variables related to sliding linear fit
      *
      *  @param  pCluster the cluster we are characterizing
+     *  @param  featureContext the feature context, providing the sliding fits
      *  @param  straightLineLengthLarge to receive to length reported by the straight line fit
      *  @param  diffWithStraigthLineMean to receive the difference with straight line mean variable
      *  @param  diffWithStraightLineSigma to receive the difference with straight line sigma variable
@@ -83,8 +195,9 @@ private:
      *  @param  maxFitGapLength to receive the max fit gap length variable
      *  @param  rmsSlidingLinearFit to receive the RMS from the linear fit
      */
-    void CalculateVariablesSlidingLinearFit(const pandora::Cluster *const pCluster, float &straightLineLengthLarge, float &diffWithStraigthLineMean,
-        float &diffWithStraightLineSigma, float &dTdLWidth, float &maxFitGapLength, float &rmsSlidingLinearFit) const;
+    void CalculateVariablesSlidingLinearFit(const pandora::Cluster *const pCluster, TrackShowerIdFeatureContext &featureContext,
+        float &straightLineLengthLarge, float &diffWithStraigthLineMean, float &diffWithStraightLineSigma, float &dTdLWidth,
+        float &maxFitGapLength, float &rmsSlidingLinearFit) const;
 
     unsigned int m_slidingLinearFitWindow;      ///< The sliding linear fit window
     unsigned int m_slidingLinearFitWindowLarge; ///< The sliding linear fit window - should be large, providing a simple linear fit
@@ -103,9 +216,10 @@ public:
      */
     TwoDVertexDistanceFeatureTool();
 
-    void Run(LArMvaHelper::MvaFeatureVector &featureVector, const pandora::Algorithm *const pAlgorithm, const pandora::Cluster *const pCluster);
+    void Run(LArMvaHelper::MvaFeatureVector &featureVector, const pandora::Algorithm *const pAlgorithm,
+        const pandora::Cluster *const pCluster, TrackShowerIdFeatureContext &featureContext);
     void Run(LArMvaHelper::MvaFeatureMap &featureMap, pandora::StringVector &featureOrder, const std::string &featureToolName,
-        const pandora::Algorithm *const pAlgorithm, const pandora::Cluster *const pCluster);
+        const pandora::Algorithm *const pAlgorithm, const pandora::Cluster *const pCluster, TrackShowerIdFeatureContext &featureContext);
 
 private:
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
@@ -135,9 +249,11 @@ public:
      */
     PfoHierarchyFeatureTool();
 
-    void Run(LArMvaHelper::MvaFeatureVector &featureVector, const pandora::Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pInputPfo);
+    void Run(LArMvaHelper::MvaFeatureVector &featureVector, const pandora::Algorithm *const pAlgorithm,
+        const pandora::ParticleFlowObject *const pInputPfo, TrackShowerIdFeatureContext &featureContext);
     void Run(LArMvaHelper::MvaFeatureMap &featureMap, pandora::StringVector &featureOrder, const std::string &featureToolName,
-        const pandora::Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pInputPfo);
+        const pandora::Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pInputPfo,
+        TrackShowerIdFeatureContext &featureContext);
 
 private:
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
@@ -156,9 +272,11 @@ public:
      */
     ThreeDLinearFitFeatureTool();
 
-    void Run(LArMvaHelper::MvaFeatureVector &featureVector, const pandora::Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pInputPfo);
+    void Run(LArMvaHelper::MvaFeatureVector &featureVector, const pandora::Algorithm *const pAlgorithm,
+        const pandora::ParticleFlowObject *const pInputPfo, TrackShowerIdFeatureContext &featureContext);
     void Run(LArMvaHelper::MvaFeatureMap &featureMap, pandora::StringVector &featureOrder, const std::string &featureToolName,
-        const pandora::Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pInputPfo);
+        const pandora::Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pInputPfo,
+        TrackShowerIdFeatureContext &featureContext);
 
 private:
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
@@ -167,6 +285,7 @@ private:
      *  @brief  Calculation of several variables related to sliding linear fit
      *
      *  @param  pCluster the cluster we are characterizing
+     *  @param  featureContext the feature context, providing the sliding fits
      *  @param  straightLineLengthLarge to receive to length reported by the straight line fit
      *  @param  diffWithStraigthLineMean to receive the difference with straight line mean variable
      *  @param  diffWithStraightLineSigma to receive the difference with straight line sigma variable
@@ -174,8 +293,8 @@ private:
      *  @param  maxFitGapLength to receive the max fit gap length variable
      *  @param  rmsSlidingLinearFit to receive the RMS from the linear fit
      */
-    void CalculateVariablesSlidingLinearFit(const pandora::Cluster *const pCluster, float &straightLineLengthLarge,
-        float &diffWithStraigthLineMean, float &maxFitGapLength, float &rmsSlidingLinearFit) const;
+    void CalculateVariablesSlidingLinearFit(const pandora::Cluster *const pCluster, TrackShowerIdFeatureContext &featureContext,
+        float &straightLineLengthLarge, float &diffWithStraigthLineMean, float &maxFitGapLength, float &rmsSlidingLinearFit) const;
 
     unsigned int m_slidingLinearFitWindow;      ///< The sliding linear fit window
     unsigned int m_slidingLinearFitWindowLarge; ///< The sliding linear fit window - should be large, providing a simple linear fit
@@ -194,9 +313,11 @@ public:
      */
     ThreeDVertexDistanceFeatureTool();
 
-    void Run(LArMvaHelper::MvaFeatureVector &featureVector, const pandora::Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pInputPfo);
+    void Run(LArMvaHelper::MvaFeatureVector &featureVector, const pandora::Algorithm *const pAlgorithm,
+        const pandora::ParticleFlowObject *const pInputPfo, TrackShowerIdFeatureContext &featureContext);
     void Run(LArMvaHelper::MvaFeatureMap &featureMap, pandora::StringVector &featureOrder, const std::string &featureToolName,
-        const pandora::Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pInputPfo);
+        const pandora::Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pInputPfo,
+        TrackShowerIdFeatureContext &featureContext);
 
 private:
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
@@ -215,9 +336,11 @@ public:
      */
     ConeChargeFeatureTool();
 
-    void Run(LArMvaHelper::MvaFeatureVector &featureVector, const pandora::Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pInputPfo);
+    void Run(LArMvaHelper::MvaFeatureVector &featureVector, const pandora::Algorithm *const pAlgorithm,
+        const pandora::ParticleFlowObject *const pInputPfo, TrackShowerIdFeatureContext &featureContext);
     void Run(LArMvaHelper::MvaFeatureMap &featureMap, pandora::StringVector &featureOrder, const std::string &featureToolName,
-        const pandora::Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pInputPfo);
+        const pandora::Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pInputPfo,
+        TrackShowerIdFeatureContext &featureContext);
 
 private:
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
@@ -276,9 +399,11 @@ public:
      */
     ThreeDOpeningAngleFeatureTool();
 
-    void Run(LArMvaHelper::MvaFeatureVector &featureVector, const pandora::Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pInputPfo);
+    void Run(LArMvaHelper::MvaFeatureVector &featureVector, const pandora::Algorithm *const pAlgorithm,
+        const pandora::ParticleFlowObject *const pInputPfo, TrackShowerIdFeatureContext &featureContext);
     void Run(LArMvaHelper::MvaFeatureMap &featureMap, pandora::StringVector &featureOrder, const std::string &featureToolName,
-        const pandora::Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pInputPfo);
+        const pandora::Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pInputPfo,
+        TrackShowerIdFeatureContext &featureContext);
 
 private:
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
@@ -322,9 +447,11 @@ public:
      */
     ThreeDPCAFeatureTool();
 
-    void Run(LArMvaHelper::MvaFeatureVector &featureVector, const pandora::Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pInputPfo);
+    void Run(LArMvaHelper::MvaFeatureVector &featureVector, const pandora::Algorithm *const pAlgorithm,
+        const pandora::ParticleFlowObject *const pInputPfo, TrackShowerIdFeatureContext &featureContext);
     void Run(LArMvaHelper::MvaFeatureMap &featureMap, pandora::StringVector &featureOrder, const std::string &featureToolName,
-        const pandora::Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pInputPfo);
+        const pandora::Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pInputPfo,
+        TrackShowerIdFeatureContext &featureContext);
 
 private:
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
@@ -366,9 +493,11 @@ public:
         pandora::CartesianVector m_neutrinoVertex; //The neutrino vertex used to sort
     };
 
-    void Run(LArMvaHelper::MvaFeatureVector &featureVector, const pandora::Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pInputPfo);
+    void Run(LArMvaHelper::MvaFeatureVector &featureVector, const pandora::Algorithm *const pAlgorithm,
+        const pandora::ParticleFlowObject *const pInputPfo, TrackShowerIdFeatureContext &featureContext);
     void Run(LArMvaHelper::MvaFeatureMap &featureMap, pandora::StringVector &featureOrder, const std::string &featureToolName,
-        const pandora::Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pInputPfo);
+        const pandora::Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pInputPfo,
+        TrackShowerIdFeatureContext &featureContext);
 
 private:
     /**
@@ -376,25 +505,27 @@ private:
      *
      *  @param  pAlgorithm, the algorithm
      *  @param  pCluster the cluster we are characterizing
+     *  @param  featureContext, the feature context
      *  @param  totalCharge, to receive the total charge
      *  @param  chargeSigma, to receive the charge sigma
      *  @param  chargeMean, to receive the charge mean
      *  @param  startCharge, to receive the charge in the initial 10% hits
      *  @param  endCharge, to receive the charge in the last 10% hits
      */
-    void CalculateChargeVariables(const pandora::Algorithm *const pAlgorithm, const pandora::Cluster *const pCluster, float &totalCharge,
-        float &chargeSigma, float &chargeMean, float &endCharge);
+    void CalculateChargeVariables(const pandora::Algorithm *const pAlgorithm, const pandora::Cluster *const pCluster,
+        TrackShowerIdFeatureContext &featureContext, float &totalCharge, float &chargeSigma, float &chargeMean, float &endCharge);
 
     /**
      *  @brief  Function to order the calo hit list by distance to neutrino vertex
      *
      *  @param  pAlgorithm, the algorithm
      *  @param  pCluster the cluster we are characterizing
+     *  @param  featureContext, the feature context
      *  @param  caloHitList to receive the ordered calo hit list
      *
      */
-    void OrderCaloHitsByDistanceToVertex(
-        const pandora::Algorithm *const pAlgorithm, const pandora::Cluster *const pCluster, pandora::CaloHitList &caloHitList);
+    void OrderCaloHitsByDistanceToVertex(const pandora::Algorithm *const pAlgorithm, const pandora::Cluster *const pCluster,
+        TrackShowerIdFeatureContext &featureContext, pandora::CaloHitList &caloHitList);
 
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
@@ -98,7 +98,7 @@ void CrossGapsExtensionAlgorithm::BuildPointingClusterList(const ClusterVector &
     {
         try
         {
-            pointingClusterList.push_back(LArPointingCluster(pCluster));
+            pointingClusterList.push_back(LArPointingClusterHelper::GetPointingCluster(pCluster));
         }
         catch (StatusCodeException &)
         {
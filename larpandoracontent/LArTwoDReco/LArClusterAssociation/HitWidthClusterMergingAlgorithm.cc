@@ -101,13 +101,13 @@ void HitWidthClusterMergingAlgorithm::PopulateClusterAssociationMap(const Cluste
 
 bool HitWidthClusterMergingAlgorithm::IsExtremalCluster(const bool isForward, const Cluster *const pCurrentCluster, const Cluster *const pTestCluster) const
 {
-    //ATTN - cannot use map since higherXExtrema may have changed during merging
-    const LArHitWidthHelper::ConstituentHitVector currentConstituentHitVector(
-        LArHitWidthHelper::GetConstituentHits(pCurrentCluster, m_maxConstituentHitWidth, m_hitWidthScalingFactor, false));
-    const LArHitWidthHelper::ConstituentHitVector testConstituentHitVector(
-        LArHitWidthHelper::GetConstituentHits(pTestCluster, m_maxConstituentHitWidth, m_hitWidthScalingFactor, false));
-    const CartesianVector currentHigherXExtrema(LArHitWidthHelper::GetExtremalCoordinatesHigherX(currentConstituentHitVector));
-    const CartesianVector testHigherXExtrema(LArHitWidthHelper::GetExtremalCoordinatesHigherX(testConstituentHitVector));
+    //ATTN - cannot use map since higherXExtrema may have changed during merging, whereas cached constituent hits track cluster changes
+    const LArHitWidthHelper::ClusterConstituentHits &currentConstituentHits(
+        LArHitWidthHelper::GetClusterConstituentHits(pCurrentCluster, m_maxConstituentHitWidth, m_hitWidthScalingFactor, false));
+    const LArHitWidthHelper::ClusterConstituentHits &testConstituentHits(
+        LArHitWidthHelper::GetClusterConstituentHits(pTestCluster, m_maxConstituentHitWidth, m_hitWidthScalingFactor, false));
+    const CartesianVector &currentHigherXExtrema(currentConstituentHits.GetHigherXExtrema());
+    const CartesianVector &testHigherXExtrema(testConstituentHits.GetHigherXExtrema());
     float currentMaxX(currentHigherXExtrema.GetX()), testMaxX(testHigherXExtrema.GetX());
 
     if (isForward)
@@ -60,7 +60,7 @@ void LongitudinalExtensionAlgorithm::FillClusterAssociationMatrix(const ClusterV
     {
         try
         {
-            pointingClusterList.push_back(LArPointingCluster(*iter));
+            pointingClusterList.push_back(LArPointingClusterHelper::GetPointingCluster(*iter));
         }
         catch (StatusCodeException &)
         {
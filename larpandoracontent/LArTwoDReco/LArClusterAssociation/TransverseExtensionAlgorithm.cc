@@ -52,7 +52,7 @@ void TransverseExtensionAlgorithm::FillClusterAssociationMatrix(const ClusterVec
 
         try
         {
-            pointingClusterList.push_back(LArPointingCluster(*iter));
+            pointingClusterList.push_back(LArPointingClusterHelper::GetPointingCluster(*iter));
         }
         catch (StatusCodeException &)
         {
@@ -10,6 +10,8 @@
 
 #include "larpandoracontent/LArTwoDReco/LArClusterCreation/ClusteringParentAlgorithm.h"
 
+#include "larpandoracontent/LArHelpers/LArProfilingHelper.h"
+
 using namespace pandora;
 
 namespace lar_content
@@ -53,7 +55,7 @@ StatusCode ClusteringParentAlgorithm::Run()
 
     // Run the topological association algorithms to modify clusters
     if (!pClusterList->empty() && !m_associationAlgorithmName.empty())
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::RunDaughterAlgorithm(*this, m_associationAlgorithmName));
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArProfilingHelper::RunDaughterAlgorithm(*this, m_associationAlgorithmName));
 
     // Save the new cluster list
     if (!pClusterList->empty())
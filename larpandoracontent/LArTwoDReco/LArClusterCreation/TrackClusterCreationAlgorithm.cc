@@ -10,6 +10,7 @@
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
+#include "larpandoracontent/LArHelpers/LArScratchHelper.h"
 
 #include "larpandoracontent/LArTwoDReco/LArClusterCreation/TrackClusterCreationAlgorithm.h"
 
@@ -79,7 +80,7 @@ StatusCode TrackClusterCreationAlgorithm::FilterCaloHits(
 
     for (OrderedCaloHitList::const_iterator iter = selectedCaloHitList.begin(), iterEnd = selectedCaloHitList.end(); iter != iterEnd; ++iter)
     {
-        CaloHitVector caloHits(iter->second->begin(), iter->second->end());
+        LArScratchHelper::ScratchCaloHitVector caloHits(iter->second->begin(), iter->second->end(), LArScratchHelper::GetScratchResource());
         std::sort(caloHits.begin(), caloHits.end(), LArClusterHelper::SortHitsByPosition);
 
         for (const CaloHit *const pCaloHitI : caloHits)
@@ -126,10 +127,12 @@ StatusCode TrackClusterCreationAlgorithm::AddFilteredCaloHits(
 
         CaloHitSet unavailableHits;
 
-        CaloHitVector inputAvailableHits(iter->second->begin(), iter->second->end());
+        LArScratchHelper::ScratchCaloHitVector inputAvailableHits(
+            iter->second->begin(), iter->second->end(), LArScratchHelper::GetScratchResource());
         std::sort(inputAvailableHits.begin(), inputAvailableHits.end(), LArClusterHelper::SortHitsByPosition);
 
-        CaloHitVector clusteredHits(pCaloHitList->begin(), pCaloHitList->end());
+        LArScratchHelper::ScratchCaloHitVector clusteredHits(
+            pCaloHitList->begin(), pCaloHitList->end(), LArScratchHelper::GetScratchResource());
         std::sort(clusteredHits.begin(), clusteredHits.end(), LArClusterHelper::SortHitsByPosition);
 
         bool carryOn(true);
@@ -137,7 +140,7 @@ StatusCode TrackClusterCreationAlgorithm::AddFilteredCaloHits(
         while (carryOn)
         {
             carryOn = false;
-            CaloHitVector newClusteredHits;
+            LArScratchHelper::ScratchCaloHitVector newClusteredHits(LArScratchHelper::GetScratchResource());
 
             for (const CaloHit *const pCaloHitI : inputAvailableHits)
             {
@@ -200,7 +203,8 @@ void TrackClusterCreationAlgorithm::MakePrimaryAssociations(const OrderedCaloHit
     {
         unsigned int nLayersConsidered(0);
 
-        CaloHitVector caloHitsI(iterI->second->begin(), iterI->second->end());
+        LArScratchHelper::ScratchCaloHitVector caloHitsI(
+            iterI->second->begin(), iterI->second->end(), LArScratchHelper::GetScratchResource());
         std::sort(caloHitsI.begin(), caloHitsI.end(), LArClusterHelper::SortHitsByPosition);
 
         for (OrderedCaloHitList::const_iterator iterJ = iterI, iterJEnd = orderedCaloHitList.end();
@@ -209,7 +213,8 @@ void TrackClusterCreationAlgorithm::MakePrimaryAssociations(const OrderedCaloHit
             if (iterJ->first == iterI->first || iterJ->first > iterI->first + m_maxGapLayers + 1)
                 continue;
 
-            CaloHitVector caloHitsJ(iterJ->second->begin(), iterJ->second->end());
+            LArScratchHelper::ScratchCaloHitVector caloHitsJ(
+                iterJ->second->begin(), iterJ->second->end(), LArScratchHelper::GetScratchResource());
             std::sort(caloHitsJ.begin(), caloHitsJ.end(), LArClusterHelper::SortHitsByPosition);
 
             for (const CaloHit *const pCaloHitI : caloHitsI)
@@ -228,7 +233,7 @@ void TrackClusterCreationAlgorithm::MakeSecondaryAssociations(const OrderedCaloH
 {
     for (OrderedCaloHitList::const_iterator iter = orderedCaloHitList.begin(), iterEnd = orderedCaloHitList.end(); iter != iterEnd; ++iter)
     {
-        CaloHitVector caloHits(iter->second->begin(), iter->second->end());
+        LArScratchHelper::ScratchCaloHitVector caloHits(iter->second->begin(), iter->second->end(), LArScratchHelper::GetScratchResource());
         std::sort(caloHits.begin(), caloHits.end(), LArClusterHelper::SortHitsByPosition);
 
         for (const CaloHit *const pCaloHit : caloHits)
@@ -261,7 +266,7 @@ void TrackClusterCreationAlgorithm::IdentifyJoins(const OrderedCaloHitList &orde
 {
     for (OrderedCaloHitList::const_iterator iter = orderedCaloHitList.begin(), iterEnd = orderedCaloHitList.end(); iter != iterEnd; ++iter)
     {
-        CaloHitVector caloHits(iter->second->begin(), iter->second->end());
+        LArScratchHelper::ScratchCaloHitVector caloHits(iter->second->begin(), iter->second->end(), LArScratchHelper::GetScratchResource());
         std::sort(caloHits.begin(), caloHits.end(), LArClusterHelper::SortHitsByPosition);
 
         for (const CaloHit *const pCaloHit : caloHits)
@@ -290,7 +295,7 @@ void TrackClusterCreationAlgorithm::CreateClusters(
 {
     for (OrderedCaloHitList::const_iterator iter = orderedCaloHitList.begin(), iterEnd = orderedCaloHitList.end(); iter != iterEnd; ++iter)
     {
-        CaloHitVector caloHits(iter->second->begin(), iter->second->end());
+        LArScratchHelper::ScratchCaloHitVector caloHits(iter->second->begin(), iter->second->end(), LArScratchHelper::GetScratchResource());
         std::sort(caloHits.begin(), caloHits.end(), LArClusterHelper::SortHitsByPosition);
 
         for (const CaloHit *const pCaloHit : caloHits)
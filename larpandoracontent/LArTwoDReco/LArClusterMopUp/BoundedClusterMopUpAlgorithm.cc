@@ -37,6 +37,8 @@ void BoundedClusterMopUpAlgorithm::ClusterMopUp(const ClusterList &pfoClusters,
     ClusterVector sortedRemnantClusters(remnantClusters.begin(), remnantClusters.end());
     std::sort(sortedRemnantClusters.begin(), sortedRemnantClusters.end(), LArClusterHelper::SortByNHits);
 
+    const RemnantHitIndex remnantHitIndex(remnantClusters);
+
     for (const Cluster *const pPfoCluster : sortedPfoClusters)
     {
         CaloHitList clusterHitList;
@@ -51,9 +53,20 @@ void BoundedClusterMopUpAlgorithm::ClusterMopUp(const ClusterList &pfoClusters,
             ShowerPositionMap showerPositionMap;
             const XSampling xSampling(fitResult.GetShowerFitResult());
             this->GetShowerPositionMap(fitResult, xSampling, showerPositionMap);
+
+            ClusterToNHitsMap nBoundedHitsMap;
+            this->GetNBoundedHits(remnantHitIndex, xSampling, showerPositionMap, nBoundedHitsMap);
+
             for (const Cluster *const pRemnantCluster : sortedRemnantClusters)
             {
-                const float boundedFraction(this->GetBoundedFraction(pRemnantCluster, xSampling, showerPositionMap));
+                const unsigned int nHits(pRemnantCluster->GetNCaloHits());
+
+                if (0 == nHits)
+                    throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+                const ClusterToNHitsMap::const_iterator nBoundedIter(nBoundedHitsMap.find(pRemnantCluster));
+                const unsigned int nBoundedHits((nBoundedHitsMap.end() != nBoundedIter) ? nBoundedIter->second : 0);
+                const float boundedFraction(static_cast<float>(nBoundedHits) / static_cast<float>(nHits));
 
                 if (boundedFraction < m_minBoundedFraction)
                     continue;
@@ -104,41 +117,46 @@ void BoundedClusterMopUpAlgorithm::GetShowerPositionMap(
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-float BoundedClusterMopUpAlgorithm::GetBoundedFraction(
-    const Cluster *const pCluster, const XSampling &xSampling, const ShowerPositionMap &showerPositionMap) const
+void BoundedClusterMopUpAlgorithm::GetNBoundedHits(const RemnantHitIndex &remnantHitIndex, const XSampling &xSampling,
+    const ShowerPositionMap &showerPositionMap, ClusterToNHitsMap &nBoundedHitsMap) const
 {
-    if (((xSampling.m_maxX - xSampling.m_minX) < std::numeric_limits<float>::epsilon()) || (0 >= xSampling.m_nPoints) || (0 == pCluster->GetNCaloHits()))
-    {
+    if (((xSampling.m_maxX - xSampling.m_minX) < std::numeric_limits<float>::epsilon()) || (0 >= xSampling.m_nPoints))
         throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    if (showerPositionMap.empty())
+        return;
+
+    float minZ(std::numeric_limits<float>::max()), maxZ(-std::numeric_limits<float>::max());
+
+    for (const ShowerPositionMap::value_type &mapEntry : showerPositionMap)
+    {
+        minZ = std::min(minZ, mapEntry.second.GetLowEdgeZ());
+        maxZ = std::max(maxZ, mapEntry.second.GetHighEdgeZ());
     }
 
-    unsigned int nMatchedHits(0);
-    const OrderedCaloHitList &orderedCaloHitList(pCluster->GetOrderedCaloHitList());
+    // Only remnant hits within the x extent of the sampling, and the z extent of the shower edges, can be bounded
+    CaloHitVector candidateCaloHits;
+    remnantHitIndex.GetCaloHitsInRegion(
+        CartesianVector(xSampling.m_minX, 0.f, minZ), CartesianVector(xSampling.m_maxX, 0.f, maxZ), candidateCaloHits);
 
-    for (OrderedCaloHitList::const_iterator iter = orderedCaloHitList.begin(), iterEnd = orderedCaloHitList.end(); iter != iterEnd; ++iter)
+    for (const CaloHit *const pCaloHit : candidateCaloHits)
     {
-        for (CaloHitList::const_iterator hIter = iter->second->begin(), hIterEnd = iter->second->end(); hIter != hIterEnd; ++hIter)
-        {
-            const CaloHit *const pCaloHit = *hIter;
-            const float x(pCaloHit->GetPositionVector().GetX());
-            const float z(pCaloHit->GetPositionVector().GetZ());
+        const float x(pCaloHit->GetPositionVector().GetX());
+        const float z(pCaloHit->GetPositionVector().GetZ());
 
-            try
-            {
-                const int xBin(xSampling.GetBin(x));
+        try
+        {
+            const int xBin(xSampling.GetBin(x));
 
-                ShowerPositionMap::const_iterator positionIter = showerPositionMap.find(xBin);
+            ShowerPositionMap::const_iterator positionIter = showerPositionMap.find(xBin);
 
-                if ((showerPositionMap.end() != positionIter) && (z > positionIter->second.GetLowEdgeZ()) && (z < positionIter->second.GetHighEdgeZ()))
-                    ++nMatchedHits;
-            }
-            catch (StatusCodeException &)
-            {
-            }
+            if ((showerPositionMap.end() != positionIter) && (z > positionIter->second.GetLowEdgeZ()) && (z < positionIter->second.GetHighEdgeZ()))
+                ++nBoundedHitsMap[remnantHitIndex.GetRemnantCluster(pCaloHit)];
+        }
+        catch (StatusCodeException &)
+        {
         }
     }
-
-    return (static_cast<float>(nMatchedHits) / static_cast<float>(pCluster->GetNCaloHits()));
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -67,15 +67,15 @@ private:
     void GetShowerPositionMap(const TwoDSlidingShowerFitResult &fitResult, const XSampling &xSampling, ShowerPositionMap &showerPositionMap) const;
 
     /**
-     *  @brief  Get the fraction of hits in a cluster bounded by a specified shower position map
+     *  @brief  Count the remnant hits, in each remnant cluster, bounded by a specified shower position map
      *
-     *  @param  pCluster address of the cluster
+     *  @param  remnantHitIndex the spatial index of the remnant hits
      *  @param  xSampling the x sampling details
      *  @param  showerPositionMap the shower position map
-     *
-     *  @return the fraction of bounded hits
+     *  @param  nBoundedHitsMap to receive the number of bounded hits in each remnant cluster with at least one bounded hit
      */
-    float GetBoundedFraction(const pandora::Cluster *const pCluster, const XSampling &xSampling, const ShowerPositionMap &showerPositionMap) const;
+    void GetNBoundedHits(const RemnantHitIndex &remnantHitIndex, const XSampling &xSampling, const ShowerPositionMap &showerPositionMap,
+        ClusterToNHitsMap &nBoundedHitsMap) const;
 
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
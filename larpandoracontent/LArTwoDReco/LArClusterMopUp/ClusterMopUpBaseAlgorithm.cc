@@ -151,4 +151,57 @@ StatusCode ClusterMopUpBaseAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
     return MopUpBaseAlgorithm::ReadSettings(xmlHandle);
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ClusterMopUpBaseAlgorithm::RemnantHitIndex::RemnantHitIndex(const ClusterList &remnantClusters)
+{
+    CaloHitList remnantCaloHits;
+
+    for (const Cluster *const pRemnantCluster : remnantClusters)
+    {
+        CaloHitList clusterCaloHits;
+        pRemnantCluster->GetOrderedCaloHitList().FillCaloHitList(clusterCaloHits);
+
+        for (const CaloHit *const pCaloHit : clusterCaloHits)
+        {
+            if (m_caloHitToClusterMap.insert(CaloHitToClusterMap::value_type(pCaloHit, pRemnantCluster)).second)
+                remnantCaloHits.push_back(pCaloHit);
+        }
+    }
+
+    HitKDNode2DList hitKDNode2DList;
+    const KDTreeBox hitsBoundingRegion2D(fill_and_bound_2d_kd_tree(remnantCaloHits, hitKDNode2DList));
+    m_kdTree.build(hitKDNode2DList, hitsBoundingRegion2D);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ClusterMopUpBaseAlgorithm::RemnantHitIndex::GetCaloHitsInRegion(
+    const CartesianVector &minPosition, const CartesianVector &maxPosition, CaloHitVector &caloHitVector) const
+{
+    // ATTN The kd tree prunes sub-regions that merely touch the search region, so pad the region to guarantee that boundary hits are found
+    const float padding(0.1f);
+    const KDTreeBox searchRegion(
+        minPosition.GetX() - padding, maxPosition.GetX() + padding, minPosition.GetZ() - padding, maxPosition.GetZ() + padding);
+
+    HitKDNode2DList found;
+    m_kdTree.search(searchRegion, found);
+
+    for (const HitKDNode2D &hitKDNode2D : found)
+        caloHitVector.push_back(hitKDNode2D.data);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const Cluster *ClusterMopUpBaseAlgorithm::RemnantHitIndex::GetRemnantCluster(const CaloHit *const pCaloHit) const
+{
+    const CaloHitToClusterMap::const_iterator iter(m_caloHitToClusterMap.find(pCaloHit));
+
+    if (m_caloHitToClusterMap.end() == iter)
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+    return iter->second;
+}
+
 } // namespace lar_content
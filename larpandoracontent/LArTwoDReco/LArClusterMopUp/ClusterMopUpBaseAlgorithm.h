@@ -8,9 +8,11 @@
 #ifndef LAR_CLUSTER_MOP_UP_BASE_ALGORITHM_H
 #define LAR_CLUSTER_MOP_UP_BASE_ALGORITHM_H 1
 
+#include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
 #include "larpandoracontent/LArUtility/MopUpBaseAlgorithm.h"
 
 #include <unordered_map>
+#include <vector>
 
 namespace lar_content
 {
@@ -28,6 +30,62 @@ public:
     ClusterMopUpBaseAlgorithm();
 
 protected:
+    typedef KDTreeLinkerAlgo<const pandora::CaloHit *, 2> HitKDTree2D;
+    typedef KDTreeNodeInfoT<const pandora::CaloHit *, 2> HitKDNode2D;
+    typedef std::vector<HitKDNode2D> HitKDNode2DList;
+
+    typedef std::unordered_map<const pandora::CaloHit *, const pandora::Cluster *> CaloHitToClusterMap;
+    typedef std::unordered_map<const pandora::Cluster *, unsigned int> ClusterToNHitsMap;
+
+    /**
+     *  @brief  RemnantHitIndex class, a spatial index of the hits in the remnant clusters of a single view. Built once per view, it allows
+     *          the remnant hits near a pfo cluster to be identified without scanning all remnant hits for each pfo cluster
+     */
+    class RemnantHitIndex
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  remnantClusters the list of remnant clusters
+         */
+        RemnantHitIndex(const pandora::ClusterList &remnantClusters);
+
+        /**
+         *  @brief  Copy constructor - deleted, as the kd tree owns its node pool
+         */
+        RemnantHitIndex(const RemnantHitIndex &) = delete;
+
+        /**
+         *  @brief  Assignment operator - deleted, as the kd tree owns its node pool
+         */
+        RemnantHitIndex &operator=(const RemnantHitIndex &) = delete;
+
+        /**
+         *  @brief  Get the remnant hits within a specified region of the x-z plane. The region is padded slightly, so that hits on its
+         *          boundary are always returned; callers should apply their own, exact selection to the returned hits
+         *
+         *  @param  minPosition the minimum x and z coordinates of the region
+         *  @param  maxPosition the maximum x and z coordinates of the region
+         *  @param  caloHitVector to receive the remnant hits in the region
+         */
+        void GetCaloHitsInRegion(const pandora::CartesianVector &minPosition, const pandora::CartesianVector &maxPosition,
+            pandora::CaloHitVector &caloHitVector) const;
+
+        /**
+         *  @brief  Get the remnant cluster containing a specified remnant hit
+         *
+         *  @param  pCaloHit address of the remnant hit
+         *
+         *  @return address of the remnant cluster
+         */
+        const pandora::Cluster *GetRemnantCluster(const pandora::CaloHit *const pCaloHit) const;
+
+    private:
+        HitKDTree2D m_kdTree;                      ///< The kd tree of remnant hits
+        CaloHitToClusterMap m_caloHitToClusterMap; ///< The remnant hit to remnant cluster map
+    };
+
     virtual pandora::StatusCode Run();
 
     /**
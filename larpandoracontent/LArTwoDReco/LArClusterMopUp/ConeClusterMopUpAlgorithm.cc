@@ -49,6 +49,8 @@ void ConeClusterMopUpAlgorithm::ClusterMopUp(const ClusterList &pfoClusters, con
     ClusterVector sortedRemnantClusters(remnantClusters.begin(), remnantClusters.end());
     std::sort(sortedRemnantClusters.begin(), sortedRemnantClusters.end(), LArClusterHelper::SortByNHits);
 
+    const RemnantHitIndex remnantHitIndex(remnantClusters);
+
     for (const Cluster *const pPfoCluster : sortedPfoClusters)
     {
         try
@@ -114,33 +116,45 @@ void ConeClusterMopUpAlgorithm::ClusterMopUp(const ClusterList &pfoClusters, con
                 continue;
             }
 
-            // Bounded fraction calculation
-            for (const Cluster *const pRemnantCluster : sortedRemnantClusters)
+            // Bounded fraction calculation, considering only remnant hits within the x-z extent of the cone
+            const float rTPMinL(minP.second + (minL - minP.first) * ((maxP.second - minP.second) / (maxP.first - minP.first)));
+            const float rTPMaxL(minP.second + (maxL - minP.first) * ((maxP.second - minP.second) / (maxP.first - minP.first)));
+            const float rTNMinL(minN.second + (minL - minN.first) * ((maxN.second - minN.second) / (maxN.first - minN.first)));
+            const float rTNMaxL(minN.second + (maxL - minN.first) * ((maxN.second - minN.second) / (maxN.first - minN.first)));
+            const float coneMinT(std::min(rTNMinL, rTNMaxL)), coneMaxT(std::max(rTPMinL, rTPMaxL));
+
+            CartesianVector coneMinPosition(0.f, 0.f, 0.f), coneMaxPosition(0.f, 0.f, 0.f);
+            this->GetConeBoundingRegion(
+                showerFitResult.GetShowerFitResult(), minL, maxL, coneMinT, coneMaxT, coneMinPosition, coneMaxPosition);
+
+            CaloHitVector candidateCaloHits;
+            remnantHitIndex.GetCaloHitsInRegion(coneMinPosition, coneMaxPosition, candidateCaloHits);
+
+            ClusterToNHitsMap nMatchedHitsMap;
+
+            for (const CaloHit *const pCaloHit : candidateCaloHits)
             {
-                const unsigned int nHits(pRemnantCluster->GetNCaloHits());
+                float rL(0.f), rT(0.f);
+                showerFitResult.GetShowerFitResult().GetLocalPosition(pCaloHit->GetPositionVector(), rL, rT);
 
-                unsigned int nMatchedHits(0);
-                const OrderedCaloHitList &orderedCaloHitList(pRemnantCluster->GetOrderedCaloHitList());
+                if ((rL < minL) || (rL > maxL))
+                    continue;
 
-                for (OrderedCaloHitList::const_iterator iter = orderedCaloHitList.begin(), iterEnd = orderedCaloHitList.end(); iter != iterEnd; ++iter)
-                {
-                    for (CaloHitList::const_iterator hIter = iter->second->begin(), hIterEnd = iter->second->end(); hIter != hIterEnd; ++hIter)
-                    {
-                        float rL(0.f), rT(0.f);
-                        showerFitResult.GetShowerFitResult().GetLocalPosition((*hIter)->GetPositionVector(), rL, rT);
+                const float rTP(minP.second + (rL - minP.first) * ((maxP.second - minP.second) / (maxP.first - minP.first)));
+                const float rTN(minN.second + (rL - minN.first) * ((maxN.second - minN.second) / (maxN.first - minN.first)));
 
-                        if ((rL < minL) || (rL > maxL))
-                            continue;
+                if ((rT > rTP) || (rT < rTN))
+                    continue;
 
-                        const float rTP(minP.second + (rL - minP.first) * ((maxP.second - minP.second) / (maxP.first - minP.first)));
-                        const float rTN(minN.second + (rL - minN.first) * ((maxN.second - minN.second) / (maxN.first - minN.first)));
+                ++nMatchedHitsMap[remnantHitIndex.GetRemnantCluster(pCaloHit)];
+            }
 
-                        if ((rT > rTP) || (rT < rTN))
-                            continue;
+            for (const Cluster *const pRemnantCluster : sortedRemnantClusters)
+            {
+                const unsigned int nHits(pRemnantCluster->GetNCaloHits());
 
-                        ++nMatchedHits;
-                    }
-                }
+                const ClusterToNHitsMap::const_iterator nMatchedIter(nMatchedHitsMap.find(pRemnantCluster));
+                const unsigned int nMatchedHits((nMatchedHitsMap.end() != nMatchedIter) ? nMatchedIter->second : 0);
 
                 const float boundedFraction((nHits > 0) ? static_cast<float>(nMatchedHits) / static_cast<float>(nHits) : 0.f);
 
@@ -165,6 +179,33 @@ void ConeClusterMopUpAlgorithm::ClusterMopUp(const ClusterList &pfoClusters, con
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void ConeClusterMopUpAlgorithm::GetConeBoundingRegion(const TwoDSlidingFitResult &fitResult, const float minL, const float maxL,
+    const float minT, const float maxT, CartesianVector &minPosition, CartesianVector &maxPosition) const
+{
+    // ATTN The local to global transformation is a rotation plus translation, so the region is bounded by the images of its corners
+    float minX(std::numeric_limits<float>::max()), maxX(-std::numeric_limits<float>::max());
+    float minZ(std::numeric_limits<float>::max()), maxZ(-std::numeric_limits<float>::max());
+
+    for (const float rL : {minL, maxL})
+    {
+        for (const float rT : {minT, maxT})
+        {
+            CartesianVector position(0.f, 0.f, 0.f);
+            fitResult.GetGlobalPosition(rL, rT, position);
+
+            minX = std::min(minX, position.GetX());
+            maxX = std::max(maxX, position.GetX());
+            minZ = std::min(minZ, position.GetZ());
+            maxZ = std::max(maxZ, position.GetZ());
+        }
+    }
+
+    minPosition = CartesianVector(minX, 0.f, minZ);
+    maxPosition = CartesianVector(maxX, 0.f, maxZ);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 bool ConeClusterMopUpAlgorithm::SortCoordinates(const Coordinate &lhs, const Coordinate &rhs)
 {
     return (lhs.second < rhs.second);
@@ -10,6 +10,8 @@
 
 #include "Pandora/Algorithm.h"
 
+#include "larpandoracontent/LArObjects/LArTwoDSlidingFitResult.h"
+
 #include "larpandoracontent/LArTwoDReco/LArClusterMopUp/ClusterMopUpBaseAlgorithm.h"
 
 namespace lar_content
@@ -32,6 +34,20 @@ private:
     typedef std::pair<float, float> Coordinate;
     typedef std::vector<Coordinate> CoordinateList;
 
+    /**
+     *  @brief  Get the x-z region enclosing a specified rectangle in the local (longitudinal, transverse) coordinates of a sliding fit
+     *
+     *  @param  fitResult the sliding fit result
+     *  @param  minL the minimum longitudinal coordinate of the rectangle
+     *  @param  maxL the maximum longitudinal coordinate of the rectangle
+     *  @param  minT the minimum transverse coordinate of the rectangle
+     *  @param  maxT the maximum transverse coordinate of the rectangle
+     *  @param  minPosition to receive the minimum x and z coordinates of the enclosing region
+     *  @param  maxPosition to receive the maximum x and z coordinates of the enclosing region
+     */
+    void GetConeBoundingRegion(const TwoDSlidingFitResult &fitResult, const float minL, const float maxL, const float minT,
+        const float maxT, pandora::CartesianVector &minPosition, pandora::CartesianVector &maxPosition) const;
+
     /**
      *  @brief  Sort coordinates by increasing transverse displacement
      *
@@ -12,18 +12,9 @@
 
 #include "larpandoracontent/LArTwoDReco/LArClusterMopUp/ClusterMopUpBaseAlgorithm.h"
 
-#include <unordered_map>
-
 namespace lar_content
 {
 
-template <typename, unsigned int>
-class KDTreeLinkerAlgo;
-template <typename, unsigned int>
-class KDTreeNodeInfoT;
-
-//------------------------------------------------------------------------------------------------------------------------------------------
-
 /**
  *  @brief  IsolatedClusterMopUpAlgorithm class
  */
@@ -46,8 +37,6 @@ private:
      */
     void DissolveClustersToHits(const pandora::ClusterList &clusterList, pandora::CaloHitList &caloHitList) const;
 
-    typedef std::unordered_map<const pandora::CaloHit *, const pandora::Cluster *> CaloHitToClusterMap;
-
     /**
      *  @brief  Look for isolated hit additions, considering a list of candidate hits and a list of host clusters
      *
@@ -60,10 +49,6 @@ private:
 
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
-    typedef KDTreeLinkerAlgo<const pandora::CaloHit *, 2> HitKDTree2D;
-    typedef KDTreeNodeInfoT<const pandora::CaloHit *, 2> HitKDNode2D;
-    typedef std::vector<HitKDNode2D> HitKDNode2DList;
-
     unsigned int m_maxCaloHitsInCluster; ///< The maximum number of hits in a cluster to be dissolved
     float m_maxHitClusterDistance;       ///< The maximum hit to cluster distance for isolated hit merging
     bool m_addHitsAsIsolated;            ///< Whether to add hits to clusters as "isolated" (don't contribute to spatial properties)
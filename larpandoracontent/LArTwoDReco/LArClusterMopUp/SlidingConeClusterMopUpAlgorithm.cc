@@ -146,6 +146,12 @@ void SlidingConeClusterMopUpAlgorithm::GetAvailableTwoDClusters(ClusterVector &a
 void SlidingConeClusterMopUpAlgorithm::GetClusterMergeMap(const Vertex *const pVertex, const ClusterVector &clusters3D,
     const ClusterVector &availableClusters2D, ClusterMergeMap &clusterMergeMap) const
 {
+    ConeHitPositionsList hitPositionsList;
+    hitPositionsList.reserve(availableClusters2D.size());
+
+    for (const Cluster *const pCluster2D : availableClusters2D)
+        hitPositionsList.emplace_back(pCluster2D);
+
     for (const Cluster *const pShowerCluster : clusters3D)
     {
         float coneLength3D(0.f);
@@ -176,11 +182,17 @@ void SlidingConeClusterMopUpAlgorithm::GetClusterMergeMap(const Vertex *const pV
             continue;
         }
 
-        for (const Cluster *const pNearbyCluster2D : availableClusters2D)
+        SimpleConeList simpleConeList2D;
+        SimpleConeScoreList coneScoreList;
+
+        for (unsigned int iNearby = 0; iNearby < availableClusters2D.size(); ++iNearby)
         {
+            const Cluster *const pNearbyCluster2D(availableClusters2D.at(iNearby));
             ClusterMerge bestClusterMerge(nullptr, 0.f, 0.f);
             const HitType hitType(LArClusterHelper::GetClusterHitType(pNearbyCluster2D));
 
+            simpleConeList2D.clear();
+
             for (const SimpleCone &simpleCone3D : simpleConeList3D)
             {
                 const CartesianVector coneBaseCentre3D(simpleCone3D.GetConeApex() + simpleCone3D.GetConeDirection() * coneLength3D);
@@ -188,9 +200,14 @@ void SlidingConeClusterMopUpAlgorithm::GetClusterMergeMap(const Vertex *const pV
                 const CartesianVector coneBaseCentre2D(LArGeometryHelper::ProjectPosition(this->GetPandora(), coneBaseCentre3D, hitType));
 
                 const CartesianVector apexToBase2D(coneBaseCentre2D - coneApex2D);
-                const SimpleCone simpleCone2D(coneApex2D, apexToBase2D.GetUnitVector(), apexToBase2D.GetMagnitude(), m_coneTanHalfAngle);
-                const ClusterMerge clusterMerge(
-                    pShowerCluster, simpleCone2D.GetBoundedHitFraction(pNearbyCluster2D), simpleCone2D.GetMeanRT(pNearbyCluster2D));
+                simpleConeList2D.emplace_back(coneApex2D, apexToBase2D.GetUnitVector(), apexToBase2D.GetMagnitude(), m_coneTanHalfAngle);
+            }
+
+            SimpleCone::GetConeScores(simpleConeList2D, hitPositionsList.at(iNearby), coneScoreList);
+
+            for (const SimpleConeScore &coneScore : coneScoreList)
+            {
+                const ClusterMerge clusterMerge(pShowerCluster, coneScore.m_boundedFraction1, coneScore.m_meanRT);
 
                 if (clusterMerge < bestClusterMerge)
                     bestClusterMerge = clusterMerge;
@@ -56,7 +56,7 @@ void CosmicRayExtensionAlgorithm::FillClusterAssociationMatrix(const ClusterVect
     {
         try
         {
-            pointingClusterList.push_back(LArPointingCluster(*iter));
+            pointingClusterList.push_back(LArPointingClusterHelper::GetPointingCluster(*iter));
         }
         catch (StatusCodeException &)
         {
@@ -42,12 +42,12 @@ public:
 
     /**
      *  @brief  Search in the KDTree for all points that would be contained in the given searchbox
-     *          The founded points are stored in resRecHitList
+     *          The founded points are stored in resRecHitList. Searches do not modify the tree, so may run concurrently
      *
      *  @param  searchBox
      *  @param  resRecHitList
      */
-    void search(const KDTreeBoxT<DIM> &searchBox, std::vector<KDTreeNodeInfoT<DATA, DIM>> &resRecHitList);
+    void search(const KDTreeBoxT<DIM> &searchBox, std::vector<KDTreeNodeInfoT<DATA, DIM>> &resRecHitList) const;
 
     /**
      *  @brief  findNearestNeighbour
@@ -56,7 +56,7 @@ public:
      *  @param  result
      *  @param  distance
      */
-    void findNearestNeighbour(const KDTreeNodeInfoT<DATA, DIM> &point, const KDTreeNodeInfoT<DATA, DIM> *&result, float &distance);
+    void findNearestNeighbour(const KDTreeNodeInfoT<DATA, DIM> &point, const KDTreeNodeInfoT<DATA, DIM> *&result, float &distance) const;
 
     /**
      *  @brief  Whether the tree is empty
@@ -109,8 +109,10 @@ private:
      *
      *  @param  current
      *  @param  trackBox
+     *  @param  recHits
      */
-    void recSearch(const KDTreeNodeT<DATA, DIM> *current, const KDTreeBoxT<DIM> &trackBox);
+    void recSearch(
+        const KDTreeNodeT<DATA, DIM> *current, const KDTreeBoxT<DIM> &trackBox, std::vector<KDTreeNodeInfoT<DATA, DIM>> &recHits) const;
 
     /**
      *  @brief  Recursive nearest neighbour search. Is called by findNearestNeighbour()
@@ -122,14 +124,15 @@ private:
      *  @param  best_dist
      */
     void recNearestNeighbour(unsigned depth, const KDTreeNodeT<DATA, DIM> *current, const KDTreeNodeInfoT<DATA, DIM> &point,
-        const KDTreeNodeT<DATA, DIM> *&best_match, float &best_dist);
+        const KDTreeNodeT<DATA, DIM> *&best_match, float &best_dist) const;
 
     /**
      *  @brief  Add all elements of an subtree to the closest elements. Used during the recSearch().
      *
      *  @param  current
+     *  @param  recHits
      */
-    void addSubtree(const KDTreeNodeT<DATA, DIM> *current);
+    void addSubtree(const KDTreeNodeT<DATA, DIM> *current, std::vector<KDTreeNodeInfoT<DATA, DIM>> &recHits) const;
 
     /**
      *  @brief  dist2
@@ -151,8 +154,7 @@ private:
     int nodePoolSize_;                 ///< The node pool size
     int nodePoolPos_;                  ///< The node pool position
 
-    std::vector<KDTreeNodeInfoT<DATA, DIM>> *closestNeighbour; ///< The closest neighbour
-    std::vector<KDTreeNodeInfoT<DATA, DIM>> *initialEltList;   ///< The initial element list
+    std::vector<KDTreeNodeInfoT<DATA, DIM>> *initialEltList; ///< The initial element list
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -164,7 +166,6 @@ inline KDTreeLinkerAlgo<DATA, DIM>::KDTreeLinkerAlgo() :
     nodePool_(nullptr),
     nodePoolSize_(-1),
     nodePoolPos_(-1),
-    closestNeighbour(nullptr),
     initialEltList(nullptr)
 {
 }
@@ -246,20 +247,17 @@ inline int KDTreeLinkerAlgo<DATA, DIM>::medianSearch(int low, int high, int tree
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename DATA, unsigned DIM>
-inline void KDTreeLinkerAlgo<DATA, DIM>::search(const KDTreeBoxT<DIM> &trackBox, std::vector<KDTreeNodeInfoT<DATA, DIM>> &recHits)
+inline void KDTreeLinkerAlgo<DATA, DIM>::search(const KDTreeBoxT<DIM> &trackBox, std::vector<KDTreeNodeInfoT<DATA, DIM>> &recHits) const
 {
     if (root_)
-    {
-        closestNeighbour = &recHits;
-        this->recSearch(root_, trackBox);
-        closestNeighbour = nullptr;
-    }
+        this->recSearch(root_, trackBox, recHits);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename DATA, unsigned DIM>
-inline void KDTreeLinkerAlgo<DATA, DIM>::recSearch(const KDTreeNodeT<DATA, DIM> *current, const KDTreeBoxT<DIM> &trackBox)
+inline void KDTreeLinkerAlgo<DATA, DIM>::recSearch(
+    const KDTreeNodeT<DATA, DIM> *current, const KDTreeBoxT<DIM> &trackBox, std::vector<KDTreeNodeInfoT<DATA, DIM>> &recHits) const
 {
     // By construction, current can't be null
     //assert(current != 0);
@@ -279,7 +277,7 @@ inline void KDTreeLinkerAlgo<DATA, DIM>::recSearch(const KDTreeNodeT<DATA, DIM>
         }
 
         if (isInside)
-            closestNeighbour->push_back(current->info);
+            recHits.push_back(current->info);
     }
     else
     {
@@ -298,11 +296,11 @@ inline void KDTreeLinkerAlgo<DATA, DIM>::recSearch(const KDTreeNodeT<DATA, DIM>
 
         if (isFullyContained)
         {
-            this->addSubtree(current->left);
+            this->addSubtree(current->left, recHits);
         }
         else if (hasIntersection)
         {
-            this->recSearch(current->left, trackBox);
+            this->recSearch(current->left, trackBox, recHits);
         }
 
         //if region( v->right ) is fully contained in the rectangle
@@ -319,11 +317,11 @@ inline void KDTreeLinkerAlgo<DATA, DIM>::recSearch(const KDTreeNodeT<DATA, DIM>
 
         if (isFullyContained)
         {
-            this->addSubtree(current->right);
+            this->addSubtree(current->right, recHits);
         }
         else if (hasIntersection)
         {
-            this->recSearch(current->right, trackBox);
+            this->recSearch(current->right, trackBox, recHits);
         }
     }
 }
@@ -332,7 +330,7 @@ inline void KDTreeLinkerAlgo<DATA, DIM>::recSearch(const KDTreeNodeT<DATA, DIM>
 
 template <typename DATA, unsigned DIM>
 inline void KDTreeLinkerAlgo<DATA, DIM>::findNearestNeighbour(
-    const KDTreeNodeInfoT<DATA, DIM> &point, const KDTreeNodeInfoT<DATA, DIM> *&result, float &distance)
+    const KDTreeNodeInfoT<DATA, DIM> &point, const KDTreeNodeInfoT<DATA, DIM> *&result, float &distance) const
 {
     if (nullptr != result || distance != std::numeric_limits<float>::max())
     {
@@ -357,7 +355,7 @@ inline void KDTreeLinkerAlgo<DATA, DIM>::findNearestNeighbour(
 
 template <typename DATA, unsigned DIM>
 inline void KDTreeLinkerAlgo<DATA, DIM>::recNearestNeighbour(unsigned int depth, const KDTreeNodeT<DATA, DIM> *current,
-    const KDTreeNodeInfoT<DATA, DIM> &point, const KDTreeNodeT<DATA, DIM> *&best_match, float &best_dist)
+    const KDTreeNodeInfoT<DATA, DIM> &point, const KDTreeNodeT<DATA, DIM> *&best_match, float &best_dist) const
 {
     const unsigned int current_dim = depth % DIM;
 
@@ -418,7 +416,8 @@ inline void KDTreeLinkerAlgo<DATA, DIM>::recNearestNeighbour(unsigned int depth,
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename DATA, unsigned DIM>
-inline void KDTreeLinkerAlgo<DATA, DIM>::addSubtree(const KDTreeNodeT<DATA, DIM> *current)
+inline void KDTreeLinkerAlgo<DATA, DIM>::addSubtree(
+    const KDTreeNodeT<DATA, DIM> *current, std::vector<KDTreeNodeInfoT<DATA, DIM>> &recHits) const
 {
     // By construction, current can't be null
     //assert(current != 0);
@@ -426,13 +425,13 @@ inline void KDTreeLinkerAlgo<DATA, DIM>::addSubtree(const KDTreeNodeT<DATA, DIM>
     if ((current->left == nullptr) && (current->right == nullptr))
     {
         // Leaf case
-        closestNeighbour->push_back(current->info);
+        recHits.push_back(current->info);
     }
     else
     {
         // Node case
-        this->addSubtree(current->left);
-        this->addSubtree(current->right);
+        this->addSubtree(current->left, recHits);
+        this->addSubtree(current->right, recHits);
     }
 }
 
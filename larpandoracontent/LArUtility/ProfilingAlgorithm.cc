@@ -0,0 +1,69 @@
+/**
+ *  @file   larpandoracontent/LArUtility/ProfilingAlgorithm.cc
+ *
+ *  @brief  Implementation of the profiling algorithm class.
+ *
+ *  $Log: $
+ */
+
+#include "Pandora/AlgorithmHeaders.h"
+
+#include "larpandoracontent/LArHelpers/LArProfilingHelper.h"
+
+#include "larpandoracontent/LArUtility/ProfilingAlgorithm.h"
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+StatusCode ProfilingAlgorithm::Reset()
+{
+    LArProfilingHelper::EndEvent(this);
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ProfilingAlgorithm::Run()
+{
+    LArProfilingHelper::BeginEvent(this);
+
+    for (unsigned int iAlgorithm = 0; iAlgorithm < m_algorithmNames.size(); ++iAlgorithm)
+    {
+        const LArProfilingHelper::ScopedTimer timer(*this, "Algorithm", m_algorithmTypes.at(iAlgorithm));
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::RunDaughterAlgorithm(*this, m_algorithmNames.at(iAlgorithm)));
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ProfilingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
+{
+    LArProfilingHelper::Settings settings;
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArProfilingHelper::ReadSettings(xmlHandle, settings));
+    LArProfilingHelper::Enable(this, settings);
+
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ProcessAlgorithmList(*this, xmlHandle, "algorithms", m_algorithmNames));
+
+    const TiXmlHandle algorithmListHandle(xmlHandle.FirstChild("algorithms").Element());
+
+    for (TiXmlElement *pXmlElement = algorithmListHandle.FirstChild("algorithm").Element(); nullptr != pXmlElement;
+         pXmlElement = pXmlElement->NextSiblingElement("algorithm"))
+    {
+        const char *const pType(pXmlElement->Attribute("type"));
+        m_algorithmTypes.push_back(pType ? std::string(pType) : std::string("Unknown"));
+    }
+
+    if (m_algorithmTypes.size() != m_algorithmNames.size())
+    {
+        std::cout << "ProfilingAlgorithm::ReadSettings - unable to identify the daughter algorithm types" << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+} // namespace lar_content
@@ -0,0 +1,32 @@
+/**
+ *  @file   larpandoracontent/LArUtility/ProfilingAlgorithm.h
+ *
+ *  @brief  Header file for the profiling algorithm class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_PROFILING_ALGORITHM_H
+#define LAR_PROFILING_ALGORITHM_H 1
+
+#include "Pandora/Algorithm.h"
+
+namespace lar_content
+{
+
+/**
+ *  @brief  ProfilingAlgorithm class, which runs a list of daughter algorithms and records the time spent in each
+ */
+class ProfilingAlgorithm : public pandora::Algorithm
+{
+private:
+    pandora::StatusCode Reset();
+    pandora::StatusCode Run();
+    pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
+
+    pandora::StringVector m_algorithmNames; ///< The names of the daughter algorithms
+    pandora::StringVector m_algorithmTypes; ///< The types of the daughter algorithms, used to label the records
+};
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_PROFILING_ALGORITHM_H
@@ -50,6 +50,13 @@ void AsymmetryFeatureBaseTool::Run(LArMvaHelper::MvaFeatureVector &featureVector
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+bool AsymmetryFeatureBaseTool::IsThreadSafe() const
+{
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void AsymmetryFeatureBaseTool::IncrementAsymmetryParameters(
     const float weight, const CartesianVector &clusterDirection, CartesianVector &localWeightedDirectionSum) const
 {
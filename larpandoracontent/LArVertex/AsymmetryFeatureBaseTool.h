@@ -39,6 +39,13 @@ public:
         const VertexSelectionBaseAlgorithm::ClusterListMap &, const VertexSelectionBaseAlgorithm::KDTreeMap &,
         const VertexSelectionBaseAlgorithm::ShowerClusterListMap &showerClusterListMap, const float, float &);
 
+    /**
+     *  @brief  Whether the tool may be run concurrently for different vertices
+     *
+     *  @return boolean
+     */
+    bool IsThreadSafe() const;
+
 protected:
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
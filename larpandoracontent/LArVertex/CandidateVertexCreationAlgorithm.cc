@@ -13,6 +13,8 @@
 
 #include "larpandoracontent/LArVertex/CandidateVertexCreationAlgorithm.h"
 
+#include <algorithm>
+#include <limits>
 #include <utility>
 
 using namespace pandora;
@@ -173,6 +175,23 @@ void CandidateVertexCreationAlgorithm::SelectClusters(ClusterVector &clusterVect
 
 void CandidateVertexCreationAlgorithm::CreateEndpointCandidates(const ClusterVector &clusterVector1, const ClusterVector &clusterVector2) const
 {
+    // Index the clusters in view 2 by the x extent of their fitted end positions
+    XOrderedIndexVector xOrderedIndices2;
+    FloatVector maxLayerX2;
+
+    for (unsigned int iCluster2 = 0; iCluster2 < clusterVector2.size(); ++iCluster2)
+    {
+        const TwoDSlidingFitResult &fitResult2(this->GetCachedSlidingFitResult(clusterVector2.at(iCluster2)));
+        const float minX2(fitResult2.GetGlobalMinLayerPosition().GetX()), maxX2(fitResult2.GetGlobalMaxLayerPosition().GetX());
+        xOrderedIndices2.emplace_back(std::min(minX2, maxX2), iCluster2);
+        maxLayerX2.push_back(std::max(minX2, maxX2));
+    }
+
+    std::sort(xOrderedIndices2.begin(), xOrderedIndices2.end());
+
+    // ATTN Loose x window, as this is only a pre-selection of cluster pairs for the exact checks in CreateEndpointVertex
+    const float xMargin(2.f * m_maxEndpointXDiscrepancy + 1.f);
+
     for (const Cluster *const pCluster1 : clusterVector1)
     {
         const HitType hitType1(LArClusterHelper::GetClusterHitType(pCluster1));
@@ -181,8 +200,25 @@ void CandidateVertexCreationAlgorithm::CreateEndpointCandidates(const ClusterVec
         const CartesianVector minLayerPosition1(fitResult1.GetGlobalMinLayerPosition());
         const CartesianVector maxLayerPosition1(fitResult1.GetGlobalMaxLayerPosition());
 
-        for (const Cluster *const pCluster2 : clusterVector2)
+        const float minX1(std::min(minLayerPosition1.GetX(), maxLayerPosition1.GetX()) - xMargin);
+        const float maxX1(std::max(minLayerPosition1.GetX(), maxLayerPosition1.GetX()) + xMargin);
+
+        // Retain the input order of compatible clusters, so candidates are created in the same order as for an exhaustive search
+        std::vector<unsigned int> indices2;
+        const XOrderedIndexVector::const_iterator endIter(std::upper_bound(xOrderedIndices2.begin(), xOrderedIndices2.end(),
+            std::make_pair(maxX1, std::numeric_limits<unsigned int>::max())));
+
+        for (XOrderedIndexVector::const_iterator iter = xOrderedIndices2.begin(); iter != endIter; ++iter)
         {
+            if (maxLayerX2.at(iter->second) >= minX1)
+                indices2.push_back(iter->second);
+        }
+
+        std::sort(indices2.begin(), indices2.end());
+
+        for (const unsigned int iCluster2 : indices2)
+        {
+            const Cluster *const pCluster2(clusterVector2.at(iCluster2));
             const HitType hitType2(LArClusterHelper::GetClusterHitType(pCluster2));
 
             const TwoDSlidingFitResult &fitResult2(this->GetCachedSlidingFitResult(pCluster2));
@@ -256,13 +292,20 @@ void CandidateVertexCreationAlgorithm::CreateCrossingCandidates(
 void CandidateVertexCreationAlgorithm::FindCrossingPoints(const ClusterVector &clusterVector, CartesianPointVector &crossingPoints) const
 {
     ClusterToSpacepointsMap clusterToSpacepointsMap;
+    ClusterToXOrderedIndicesMap clusterToXOrderedIndicesMap;
 
     for (const Cluster *const pCluster : clusterVector)
     {
         ClusterToSpacepointsMap::iterator mapIter(clusterToSpacepointsMap.emplace(pCluster, CartesianPointVector()).first);
         this->GetSpacepoints(pCluster, mapIter->second);
+        this->GetXOrderedIndices(mapIter->second, clusterToXOrderedIndicesMap[pCluster]);
     }
 
+    XOrderedPositionMap crossingPointMap;
+
+    for (const CartesianVector &crossingPoint : crossingPoints)
+        crossingPointMap.emplace(crossingPoint.GetX(), crossingPoint);
+
     for (const Cluster *const pCluster1 : clusterVector)
     {
         for (const Cluster *const pCluster2 : clusterVector)
@@ -270,7 +313,8 @@ void CandidateVertexCreationAlgorithm::FindCrossingPoints(const ClusterVector &c
             if (pCluster1 == pCluster2)
                 continue;
 
-            this->FindCrossingPoints(clusterToSpacepointsMap.at(pCluster1), clusterToSpacepointsMap.at(pCluster2), crossingPoints);
+            this->FindCrossingPoints(clusterToSpacepointsMap.at(pCluster1), clusterToXOrderedIndicesMap.at(pCluster1),
+                clusterToSpacepointsMap.at(pCluster2), clusterToXOrderedIndicesMap.at(pCluster2), crossingPoints, crossingPointMap);
         }
     }
 }
@@ -279,7 +323,8 @@ void CandidateVertexCreationAlgorithm::FindCrossingPoints(const ClusterVector &c
 
 void CandidateVertexCreationAlgorithm::GetSpacepoints(const Cluster *const pCluster, CartesianPointVector &spacepoints) const
 {
-    LArClusterHelper::GetCoordinateVector(pCluster, spacepoints);
+    // ATTN All spacepoints, including the extrapolated positions, are sorted once, below
+    LArClusterHelper::GetCoordinateVector(pCluster, spacepoints, false);
 
     const TwoDSlidingFitResult &fitResult(this->GetCachedSlidingFitResult(pCluster));
     const float minLayerRL(fitResult.GetL(fitResult.GetMinLayer()));
@@ -302,61 +347,150 @@ void CandidateVertexCreationAlgorithm::GetSpacepoints(const Cluster *const pClus
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void CandidateVertexCreationAlgorithm::FindCrossingPoints(
-    const CartesianPointVector &spacepoints1, const CartesianPointVector &spacepoints2, CartesianPointVector &crossingPoints) const
+void CandidateVertexCreationAlgorithm::GetXOrderedIndices(const CartesianPointVector &positions, XOrderedIndexVector &xOrderedIndices) const
+{
+    for (unsigned int index = 0; index < positions.size(); ++index)
+        xOrderedIndices.emplace_back(positions.at(index).GetX(), index);
+
+    std::sort(xOrderedIndices.begin(), xOrderedIndices.end());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void CandidateVertexCreationAlgorithm::FindCrossingPoints(const CartesianPointVector &spacepoints1,
+    const XOrderedIndexVector &xOrderedIndices1, const CartesianPointVector &spacepoints2, const XOrderedIndexVector &xOrderedIndices2,
+    CartesianPointVector &crossingPoints, XOrderedPositionMap &crossingPointMap) const
 {
+    if (xOrderedIndices1.empty() || xOrderedIndices2.empty())
+        return;
+
+    // No pair of spacepoints can be closer than the gap between the x extents of the two clusters
+    const float xGap(std::max(
+        xOrderedIndices2.front().first - xOrderedIndices1.back().first, xOrderedIndices1.front().first - xOrderedIndices2.back().first));
+
+    if ((xGap > 0.f) && (xGap * xGap >= m_maxCrossingSeparationSquared))
+        return;
+
     bool bestCrossingFound(false);
     float bestSeparationSquared(m_maxCrossingSeparationSquared);
-    CartesianVector bestPosition1(0.f, 0.f, 0.f), bestPosition2(0.f, 0.f, 0.f);
+    unsigned int bestIndex1(0), bestIndex2(0);
 
-    for (const CartesianVector &position1 : spacepoints1)
+    for (unsigned int index1 = 0; index1 < spacepoints1.size(); ++index1)
     {
-        for (const CartesianVector &position2 : spacepoints2)
+        const CartesianVector &position1(spacepoints1.at(index1));
+        const float x1(position1.GetX());
+
+        // ATTN Only visit spacepoints whose x separation alone does not exceed the best separation. Ties are kept and resolved by index,
+        // so the chosen pair is the first found by an exhaustive search in input order
+        XOrderedIndexVector::const_iterator iter(std::partition_point(xOrderedIndices2.begin(), xOrderedIndices2.end(),
+            [&](const XOrderedIndexVector::value_type &xIndex)
+            {
+                const float deltaX(x1 - xIndex.first);
+                return ((deltaX > 0.f) && (deltaX * deltaX > bestSeparationSquared));
+            }));
+
+        for (; iter != xOrderedIndices2.end(); ++iter)
         {
-            const float separationSquared((position1 - position2).GetMagnitudeSquared());
+            const float deltaX(iter->first - x1);
 
-            if (separationSquared < bestSeparationSquared)
+            if ((deltaX > 0.f) && (deltaX * deltaX > bestSeparationSquared))
+                break;
+
+            const unsigned int index2(iter->second);
+            const float separationSquared((position1 - spacepoints2.at(index2)).GetMagnitudeSquared());
+
+            if ((separationSquared < bestSeparationSquared) ||
+                (bestCrossingFound && (separationSquared == bestSeparationSquared) && (index1 == bestIndex1) && (index2 < bestIndex2)))
             {
                 bestCrossingFound = true;
                 bestSeparationSquared = separationSquared;
-                bestPosition1 = position1;
-                bestPosition2 = position2;
+                bestIndex1 = index1;
+                bestIndex2 = index2;
             }
         }
     }
 
     if (bestCrossingFound)
     {
-        bool alreadyPopulated(false);
+        const CartesianVector &bestPosition1(spacepoints1.at(bestIndex1));
+        const CartesianVector &bestPosition2(spacepoints2.at(bestIndex2));
 
-        for (const CartesianVector &existingPosition : crossingPoints)
-        {
-            if (((existingPosition - bestPosition1).GetMagnitudeSquared() < m_minNearbyCrossingDistanceSquared) ||
-                ((existingPosition - bestPosition2).GetMagnitudeSquared() < m_minNearbyCrossingDistanceSquared))
-            {
-                alreadyPopulated = true;
-                break;
-            }
-        }
-
-        if (!alreadyPopulated)
+        if (!this->IsNearExistingCrossingPoint(bestPosition1, crossingPointMap) &&
+            !this->IsNearExistingCrossingPoint(bestPosition2, crossingPointMap))
         {
             crossingPoints.push_back(bestPosition1);
             crossingPoints.push_back(bestPosition2);
+            crossingPointMap.emplace(bestPosition1.GetX(), bestPosition1);
+            crossingPointMap.emplace(bestPosition2.GetX(), bestPosition2);
         }
     }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+bool CandidateVertexCreationAlgorithm::IsNearExistingCrossingPoint(
+    const CartesianVector &position, const XOrderedPositionMap &crossingPointMap) const
+{
+    const XOrderedPositionMap::const_iterator startIter(crossingPointMap.lower_bound(position.GetX()));
+
+    for (XOrderedPositionMap::const_iterator iter = startIter; iter != crossingPointMap.end(); ++iter)
+    {
+        const float deltaX(iter->first - position.GetX());
+
+        if (deltaX * deltaX >= m_minNearbyCrossingDistanceSquared)
+            break;
+
+        if ((iter->second - position).GetMagnitudeSquared() < m_minNearbyCrossingDistanceSquared)
+            return true;
+    }
+
+    for (XOrderedPositionMap::const_reverse_iterator iter(startIter); iter != crossingPointMap.rend(); ++iter)
+    {
+        const float deltaX(iter->first - position.GetX());
+
+        if (deltaX * deltaX >= m_minNearbyCrossingDistanceSquared)
+            break;
+
+        if ((iter->second - position).GetMagnitudeSquared() < m_minNearbyCrossingDistanceSquared)
+            return true;
+    }
+
+    return false;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void CandidateVertexCreationAlgorithm::CreateCrossingVertices(const CartesianPointVector &crossingPoints1,
     const CartesianPointVector &crossingPoints2, const HitType hitType1, const HitType hitType2, unsigned int &nCrossingCandidates) const
 {
+    XOrderedIndexVector xOrderedIndices2;
+    this->GetXOrderedIndices(crossingPoints2, xOrderedIndices2);
 
     for (const CartesianVector &position1 : crossingPoints1)
     {
-        for (const CartesianVector &position2 : crossingPoints2)
+        const float x1(position1.GetX());
+
+        XOrderedIndexVector::const_iterator iter(std::partition_point(xOrderedIndices2.begin(), xOrderedIndices2.end(),
+            [&](const XOrderedIndexVector::value_type &xIndex)
+            { return ((xIndex.first < x1) && (std::fabs(x1 - xIndex.first) > m_maxCrossingXDiscrepancy)); }));
+
+        // Visit the compatible crossing points in input order, so that candidates are created in the same order as for an exhaustive search
+        std::vector<unsigned int> indices2;
+
+        for (; iter != xOrderedIndices2.end(); ++iter)
         {
+            if ((iter->first > x1) && (std::fabs(x1 - iter->first) > m_maxCrossingXDiscrepancy))
+                break;
+
+            indices2.push_back(iter->second);
+        }
+
+        std::sort(indices2.begin(), indices2.end());
+
+        for (const unsigned int index2 : indices2)
+        {
+            const CartesianVector &position2(crossingPoints2.at(index2));
+
             if (nCrossingCandidates > m_nMaxCrossingCandidates)
                 return;
 
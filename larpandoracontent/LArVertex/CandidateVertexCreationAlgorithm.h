@@ -12,6 +12,7 @@
 
 #include "Pandora/Algorithm.h"
 
+#include <map>
 #include <unordered_map>
 
 namespace lar_content
@@ -29,6 +30,11 @@ public:
     CandidateVertexCreationAlgorithm();
 
 private:
+    typedef std::unordered_map<const pandora::Cluster *, pandora::CartesianPointVector> ClusterToSpacepointsMap;
+    typedef std::vector<std::pair<float, unsigned int>> XOrderedIndexVector;
+    typedef std::unordered_map<const pandora::Cluster *, XOrderedIndexVector> ClusterToXOrderedIndicesMap;
+    typedef std::multimap<float, pandora::CartesianVector> XOrderedPositionMap;
+
     pandora::StatusCode Run();
 
     /**
@@ -83,15 +89,37 @@ private:
      */
     void GetSpacepoints(const pandora::Cluster *const pCluster, pandora::CartesianPointVector &spacePoints) const;
 
+    /**
+     *  @brief  Get the indices of a list of positions, ordered by x coordinate
+     *
+     *  @param  positions the list of positions
+     *  @param  xOrderedIndices to receive the (x coordinate, index) pairs, in order of increasing x coordinate and then index
+     */
+    void GetXOrderedIndices(const pandora::CartesianPointVector &positions, XOrderedIndexVector &xOrderedIndices) const;
+
     /**
      *  @brief  Identify where (extrapolated) clusters plausibly cross in 2D
      *
      *  @param  spacepoints1 space points for cluster 1
+     *  @param  xOrderedIndices1 the x-ordered indices of the space points for cluster 1
      *  @param  spacepoints2 space points for cluster 2
+     *  @param  xOrderedIndices2 the x-ordered indices of the space points for cluster 2
      *  @param  crossingPoints to receive the list of plausible 2D crossing points
+     *  @param  crossingPointMap the x-ordered map of crossing points identified so far, to be updated
      */
-    void FindCrossingPoints(const pandora::CartesianPointVector &spacepoints1, const pandora::CartesianPointVector &spacepoints2,
-        pandora::CartesianPointVector &crossingPoints) const;
+    void FindCrossingPoints(const pandora::CartesianPointVector &spacepoints1, const XOrderedIndexVector &xOrderedIndices1,
+        const pandora::CartesianPointVector &spacepoints2, const XOrderedIndexVector &xOrderedIndices2,
+        pandora::CartesianPointVector &crossingPoints, XOrderedPositionMap &crossingPointMap) const;
+
+    /**
+     *  @brief  Whether a position lies within the minimum allowed distance of an existing crossing point
+     *
+     *  @param  position the position
+     *  @param  crossingPointMap the x-ordered map of existing crossing points
+     *
+     *  @return boolean
+     */
+    bool IsNearExistingCrossingPoint(const pandora::CartesianVector &position, const XOrderedPositionMap &crossingPointMap) const;
 
     /**
      *  @brief  Attempt to create candidate vertex positions, using 2D crossing points in 2 views
@@ -131,8 +159,6 @@ private:
 
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
-    typedef std::unordered_map<const pandora::Cluster *, pandora::CartesianPointVector> ClusterToSpacepointsMap;
-
     pandora::StringVector m_inputClusterListNames; ///< The list of cluster list names
     std::string m_inputVertexListName;             ///< The list name for existing candidate vertices
     std::string m_outputVertexListName;            ///< The name under which to save the output vertex list
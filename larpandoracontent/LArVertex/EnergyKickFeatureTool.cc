@@ -49,6 +49,13 @@ void EnergyKickFeatureTool::Run(LArMvaHelper::MvaFeatureVector &featureVector, c
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+bool EnergyKickFeatureTool::IsThreadSafe() const
+{
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 float EnergyKickFeatureTool::GetEnergyKickForView(
     const CartesianVector &vertexPosition2D, const VertexSelectionBaseAlgorithm::SlidingFitDataList &slidingFitDataList) const
 {
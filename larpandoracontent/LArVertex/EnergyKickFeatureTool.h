@@ -37,6 +37,13 @@ public:
         const VertexSelectionBaseAlgorithm::SlidingFitDataListMap &slidingFitDataListMap, const VertexSelectionBaseAlgorithm::ClusterListMap &,
         const VertexSelectionBaseAlgorithm::KDTreeMap &, const VertexSelectionBaseAlgorithm::ShowerClusterListMap &, const float, float &);
 
+    /**
+     *  @brief  Whether the tool may be run concurrently for different vertices
+     *
+     *  @return boolean
+     */
+    bool IsThreadSafe() const;
+
 private:
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
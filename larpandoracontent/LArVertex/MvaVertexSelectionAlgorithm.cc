@@ -25,6 +25,7 @@
 
 #include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
 
+#include <algorithm>
 #include <random>
 
 using namespace pandora;
@@ -75,11 +76,8 @@ void MvaVertexSelectionAlgorithm<T>::GetVertexScoreList(const VertexVector &vert
     this->AddEventFeaturesToVector(eventFeatureInfo, eventFeatureList);
 
     VertexFeatureInfoMap vertexFeatureInfoMap;
-    for (const Vertex *const pVertex : vertexVector)
-    {
-        this->PopulateVertexFeatureInfoMap(
-            beamConstants, clusterListMap, slidingFitDataListMap, showerClusterListMap, kdTreeMap, pVertex, vertexFeatureInfoMap);
-    }
+    this->PopulateVertexFeatureInfoMap(
+        beamConstants, clusterListMap, slidingFitDataListMap, showerClusterListMap, kdTreeMap, vertexVector, vertexFeatureInfoMap);
 
     // Use a simple score to get the list of vertices representing good regions.
     VertexScoreList initialScoreList;
@@ -127,42 +125,50 @@ template <typename T>
 const pandora::Vertex *MvaVertexSelectionAlgorithm<T>::CompareVertices(const VertexVector &vertexVector, const VertexFeatureInfoMap &vertexFeatureInfoMap,
     const LArMvaHelper::MvaFeatureVector &eventFeatureList, const KDTreeMap &kdTreeMap, const T &t, const bool useRPhi) const
 {
-    const Vertex *pBestVertex(vertexVector.front());
-    LArMvaHelper::MvaFeatureVector chosenFeatureList;
-
-    VertexFeatureInfo chosenVertexFeatureInfo(vertexFeatureInfoMap.at(pBestVertex));
-    this->AddVertexFeaturesToVector(chosenVertexFeatureInfo, chosenFeatureList, useRPhi);
+    // Materialise the per-vertex feature blocks once, as the rows of a contiguous row-major matrix
+    LArMvaHelper::MvaFeatureVector vertexFeatureMatrix;
 
     for (const Vertex *const pVertex : vertexVector)
+        this->AddVertexFeaturesToVector(vertexFeatureInfoMap.at(pVertex), vertexFeatureMatrix, useRPhi);
+
+    const size_t nEventFeatures(eventFeatureList.size());
+    const size_t nVertexFeatures(vertexFeatureMatrix.size() / vertexVector.size());
+    const size_t nPairFeatures(nEventFeatures + 2 * nVertexFeatures);
+
+    // ATTN Each comparison depends on the current winner, so pairwise inputs are assembled from matrix rows in a single reused buffer
+    LArMvaHelper::MvaFeatureVector pairFeatureList(nPairFeatures);
+    pairFeatureList.reserve(nPairFeatures + 2);
+    std::copy(eventFeatureList.begin(), eventFeatureList.end(), pairFeatureList.begin());
+
+    const LArMvaHelper::MvaFeatureVector::iterator candidateBlock(pairFeatureList.begin() + nEventFeatures);
+    const LArMvaHelper::MvaFeatureVector::iterator chosenBlock(candidateBlock + nVertexFeatures);
+
+    const Vertex *pBestVertex(vertexVector.front());
+    LArMvaHelper::MvaFeatureVector::const_iterator chosenRow(vertexFeatureMatrix.begin());
+
+    for (size_t iVertex = 0; iVertex < vertexVector.size(); ++iVertex)
     {
+        const Vertex *const pVertex(vertexVector.at(iVertex));
+
         if (pVertex == pBestVertex)
             continue;
 
-        LArMvaHelper::MvaFeatureVector featureList;
-        VertexFeatureInfo vertexFeatureInfo(vertexFeatureInfoMap.at(pVertex));
-        this->AddVertexFeaturesToVector(vertexFeatureInfo, featureList, useRPhi);
+        const LArMvaHelper::MvaFeatureVector::const_iterator candidateRow(vertexFeatureMatrix.begin() + iVertex * nVertexFeatures);
+        std::copy(candidateRow, candidateRow + nVertexFeatures, candidateBlock);
+        std::copy(chosenRow, chosenRow + nVertexFeatures, chosenBlock);
 
         if (!m_legacyVariables)
         {
-            LArMvaHelper::MvaFeatureVector sharedFeatureList;
             float separation(0.f), axisHits(0.f);
             this->GetSharedFeatures(pVertex, pBestVertex, kdTreeMap, separation, axisHits);
-            VertexSharedFeatureInfo sharedFeatureInfo(separation, axisHits);
-            this->AddSharedFeaturesToVector(sharedFeatureInfo, sharedFeatureList);
-
-            if (LArMvaHelper::Classify(t, LArMvaHelper::ConcatenateFeatureLists(eventFeatureList, featureList, chosenFeatureList, sharedFeatureList)))
-            {
-                pBestVertex = pVertex;
-                chosenFeatureList = featureList;
-            }
+            pairFeatureList.resize(nPairFeatures);
+            this->AddSharedFeaturesToVector(VertexSharedFeatureInfo(separation, axisHits), pairFeatureList);
         }
-        else
+
+        if (LArMvaHelper::Classify(t, pairFeatureList))
         {
-            if (LArMvaHelper::Classify(t, LArMvaHelper::ConcatenateFeatureLists(eventFeatureList, featureList, chosenFeatureList)))
-            {
-                pBestVertex = pVertex;
-                chosenFeatureList = featureList;
-            }
+            pBestVertex = pVertex;
+            chosenRow = candidateRow;
         }
     }
 
@@ -79,6 +79,13 @@ void RPhiFeatureTool::Run(LArMvaHelper::MvaFeatureVector &featureVector, const V
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+bool RPhiFeatureTool::IsThreadSafe() const
+{
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 float RPhiFeatureTool::GetFastScore(const KernelEstimate &kernelEstimateU, const KernelEstimate &kernelEstimateV, const KernelEstimate &kernelEstimateW) const
 {
     Histogram histogramU(m_fastHistogramNPhiBins, m_fastHistogramPhiMin, m_fastHistogramPhiMax);
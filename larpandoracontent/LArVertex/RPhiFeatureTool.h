@@ -42,6 +42,13 @@ public:
         const VertexSelectionBaseAlgorithm::ClusterListMap &, const VertexSelectionBaseAlgorithm::KDTreeMap &kdTreeMap,
         const VertexSelectionBaseAlgorithm::ShowerClusterListMap &, const float beamDeweightingScore, float &bestFastScore);
 
+    /**
+     *  @brief  Whether the tool may be run concurrently for different vertices
+     *
+     *  @return boolean
+     */
+    bool IsThreadSafe() const;
+
 private:
     /**
      *  @brief Kernel estimate class
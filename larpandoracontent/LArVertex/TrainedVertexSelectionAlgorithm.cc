@@ -14,6 +14,7 @@
 #include "larpandoracontent/LArHelpers/LArInteractionTypeHelper.h"
 #include "larpandoracontent/LArHelpers/LArMCParticleHelper.h"
 #include "larpandoracontent/LArHelpers/LArMvaHelper.h"
+#include "larpandoracontent/LArHelpers/LArParallelHelper.h"
 
 #include "larpandoracontent/LArVertex/EnergyDepositionAsymmetryFeatureTool.h"
 #include "larpandoracontent/LArVertex/EnergyKickFeatureTool.h"
@@ -38,6 +39,7 @@ TrainedVertexSelectionAlgorithm::TrainedVertexSelectionAlgorithm() :
     m_trainingSetMode(false),
     m_allowClassifyDuringTraining(false),
     m_mcVertexXCorrection(0.f),
+    m_trainingOutputFormat(LArMvaHelper::TRAINING_OUTPUT_CSV),
     m_minClusterCaloHits(12),
     m_slidingFitWindow(100),
     m_minShowerSpineLength(15.f),
@@ -56,7 +58,8 @@ TrainedVertexSelectionAlgorithm::TrainedVertexSelectionAlgorithm() :
     m_dropFailedRPhiFastScoreCandidates(true),
     m_testBeamMode(false),
     m_legacyEventShapes(true),
-    m_legacyVariables(true)
+    m_legacyVariables(true),
+    m_maxFeatureThreads(1)
 {
 }
 
@@ -428,6 +431,52 @@ void TrainedVertexSelectionAlgorithm::AddEventFeaturesToVector(const EventFeatur
 void TrainedVertexSelectionAlgorithm::PopulateVertexFeatureInfoMap(const BeamConstants &beamConstants, const ClusterListMap &clusterListMap,
     const SlidingFitDataListMap &slidingFitDataListMap, const ShowerClusterListMap &showerClusterListMap, const KDTreeMap &kdTreeMap,
     const Vertex *const pVertex, VertexFeatureInfoMap &vertexFeatureInfoMap) const
+{
+    const VertexFeatureInfo vertexFeatureInfo(
+        this->CalculateVertexFeatureInfo(beamConstants, clusterListMap, slidingFitDataListMap, showerClusterListMap, kdTreeMap, pVertex));
+    vertexFeatureInfoMap.emplace(pVertex, vertexFeatureInfo);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void TrainedVertexSelectionAlgorithm::PopulateVertexFeatureInfoMap(const BeamConstants &beamConstants, const ClusterListMap &clusterListMap,
+    const SlidingFitDataListMap &slidingFitDataListMap, const ShowerClusterListMap &showerClusterListMap, const KDTreeMap &kdTreeMap,
+    const VertexVector &vertexVector, VertexFeatureInfoMap &vertexFeatureInfoMap) const
+{
+    bool allToolsThreadSafe(true);
+
+    for (const VertexFeatureTool *const pFeatureTool : m_featureToolVector)
+        allToolsThreadSafe = allToolsThreadSafe && pFeatureTool->IsThreadSafe();
+
+    if (!allToolsThreadSafe || (m_maxFeatureThreads <= 1))
+    {
+        for (const Vertex *const pVertex : vertexVector)
+        {
+            this->PopulateVertexFeatureInfoMap(
+                beamConstants, clusterListMap, slidingFitDataListMap, showerClusterListMap, kdTreeMap, pVertex, vertexFeatureInfoMap);
+        }
+
+        return;
+    }
+
+    // ATTN Features are calculated concurrently into per-vertex slots, then inserted into the map serially and in input order
+    const VertexFeatureInfo defaultFeatureInfo(0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f);
+    VertexFeatureInfoVector vertexFeatureInfoVector(vertexVector.size(), defaultFeatureInfo);
+
+    LArParallelHelper::ForEachIndex(vertexVector.size(), m_maxFeatureThreads, [&](const size_t index) {
+        vertexFeatureInfoVector.at(index) = this->CalculateVertexFeatureInfo(
+            beamConstants, clusterListMap, slidingFitDataListMap, showerClusterListMap, kdTreeMap, vertexVector.at(index));
+    });
+
+    for (size_t index = 0; index < vertexVector.size(); ++index)
+        vertexFeatureInfoMap.emplace(vertexVector.at(index), vertexFeatureInfoVector.at(index));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+TrainedVertexSelectionAlgorithm::VertexFeatureInfo TrainedVertexSelectionAlgorithm::CalculateVertexFeatureInfo(
+    const BeamConstants &beamConstants, const ClusterListMap &clusterListMap, const SlidingFitDataListMap &slidingFitDataListMap,
+    const ShowerClusterListMap &showerClusterListMap, const KDTreeMap &kdTreeMap, const Vertex *const pVertex) const
 {
     float bestFastScore(-std::numeric_limits<float>::max()); // not actually used - artefact of toolizing RPhi score and still using performance trick
 
@@ -473,8 +522,8 @@ void TrainedVertexSelectionAlgorithm::PopulateVertexFeatureInfoMap(const BeamCon
         vertexEnergy = this->GetVertexEnergy(pVertex, kdTreeMap);
     }
 
-    VertexFeatureInfo vertexFeatureInfo(beamDeweighting, 0.f, energyKick, localAsymmetry, globalAsymmetry, showerAsymmetry, dEdxAsymmetry, vertexEnergy);
-    vertexFeatureInfoMap.emplace(pVertex, vertexFeatureInfo);
+    return VertexFeatureInfo(
+        beamDeweighting, 0.f, energyKick, localAsymmetry, globalAsymmetry, showerAsymmetry, dEdxAsymmetry, vertexEnergy);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -639,6 +688,8 @@ const pandora::Vertex *TrainedVertexSelectionAlgorithm::ProduceTrainingExamples(
     VertexFeatureInfo bestVertexFeatureInfo(vertexFeatureInfoMap.at(pBestVertex));
     this->AddVertexFeaturesToVector(bestVertexFeatureInfo, bestVertexFeatureList, useRPhi);
 
+    const std::string outputFile(trainingOutputFile + "_" + interactionType + ".txt");
+
     for (const Vertex *const pVertex : vertexVector)
     {
         if (pVertex == pBestVertex)
@@ -659,11 +710,13 @@ const pandora::Vertex *TrainedVertexSelectionAlgorithm::ProduceTrainingExamples(
             if (pBestVertex && (bestVertexDr < maxRadius))
             {
                 if (coinFlip(generator))
-                    LArMvaHelper::ProduceTrainingExample(trainingOutputFile + "_" + interactionType + ".txt", true,
-                        LArMvaHelper::ConcatenateFeatureLists(eventFeatureList, bestVertexFeatureList, featureList, sharedFeatureList));
+                    LArMvaHelper::ProduceTrainingExample(outputFile, true,
+                        LArMvaHelper::ConcatenateFeatureLists(eventFeatureList, bestVertexFeatureList, featureList, sharedFeatureList),
+                        m_trainingOutputFormat);
                 else
-                    LArMvaHelper::ProduceTrainingExample(trainingOutputFile + "_" + interactionType + ".txt", false,
-                        LArMvaHelper::ConcatenateFeatureLists(eventFeatureList, featureList, bestVertexFeatureList, sharedFeatureList));
+                    LArMvaHelper::ProduceTrainingExample(outputFile, false,
+                        LArMvaHelper::ConcatenateFeatureLists(eventFeatureList, featureList, bestVertexFeatureList, sharedFeatureList),
+                        m_trainingOutputFormat);
             }
         }
         else
@@ -671,11 +724,13 @@ const pandora::Vertex *TrainedVertexSelectionAlgorithm::ProduceTrainingExamples(
             if (pBestVertex && (bestVertexDr < maxRadius))
             {
                 if (coinFlip(generator))
-                    LArMvaHelper::ProduceTrainingExample(trainingOutputFile + "_" + interactionType + ".txt", true,
-                        LArMvaHelper::ConcatenateFeatureLists(eventFeatureList, bestVertexFeatureList, featureList));
+                    LArMvaHelper::ProduceTrainingExample(outputFile, true,
+                        LArMvaHelper::ConcatenateFeatureLists(eventFeatureList, bestVertexFeatureList, featureList),
+                        m_trainingOutputFormat);
                 else
-                    LArMvaHelper::ProduceTrainingExample(trainingOutputFile + "_" + interactionType + ".txt", false,
-                        LArMvaHelper::ConcatenateFeatureLists(eventFeatureList, featureList, bestVertexFeatureList));
+                    LArMvaHelper::ProduceTrainingExample(outputFile, false,
+                        LArMvaHelper::ConcatenateFeatureLists(eventFeatureList, featureList, bestVertexFeatureList),
+                        m_trainingOutputFormat);
             }
         }
     }
@@ -856,6 +911,14 @@ void TrainedVertexSelectionAlgorithm::PopulateFinalVertexScoreList(const VertexF
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode TrainedVertexSelectionAlgorithm::Reset()
+{
+    LArMvaHelper::FlushTrainingExamples();
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode TrainedVertexSelectionAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     AlgorithmToolVector algorithmToolVector;
@@ -878,6 +941,8 @@ StatusCode TrainedVertexSelectionAlgorithm::ReadSettings(const TiXmlHandle xmlHa
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
         XmlHelper::ReadValue(xmlHandle, "TrainingOutputFileVertex", m_trainingOutputFileVertex));
 
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArMvaHelper::ReadTrainingOutputFormat(xmlHandle, m_trainingOutputFormat));
+
     if (m_trainingSetMode && (m_trainingOutputFileRegion.empty() || m_trainingOutputFileVertex.empty()))
     {
         std::cout << "TrainedVertexSelectionAlgorithm: TrainingOutputFileRegion and TrainingOutputFileVertex are required for training set "
@@ -952,6 +1017,9 @@ StatusCode TrainedVertexSelectionAlgorithm::ReadSettings(const TiXmlHandle xmlHa
 
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "LegacyVariables", m_legacyVariables));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "MaxFeatureThreads", m_maxFeatureThreads));
+
     if (m_trainingSetMode && m_legacyEventShapes)
         std::cout << "TrainedVertexSelectionAlgorithm: WARNING -- Producing training sample using incorrect legacy event shapes, consider turning LegacyEventShapes off"
                   << std::endl;
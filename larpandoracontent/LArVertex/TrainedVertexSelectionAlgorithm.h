@@ -68,6 +68,7 @@ public:
     };
 
     typedef std::map<const pandora::Vertex *const, VertexFeatureInfo> VertexFeatureInfoMap;
+    typedef std::vector<VertexFeatureInfo> VertexFeatureInfoVector;
 
     //--------------------------------------------------------------------------------------------------------------------------------------
 
@@ -309,6 +310,39 @@ protected:
         const SlidingFitDataListMap &slidingFitDataListMap, const ShowerClusterListMap &showerClusterListMap, const KDTreeMap &kdTreeMap,
         const pandora::Vertex *const pVertex, VertexFeatureInfoMap &vertexFeatureInfoMap) const;
 
+    /**
+     *  @brief  Populate the vertex feature info map for a vector of vertices, evaluating the vertices in parallel if configured to do so
+     *          and all feature tools are thread safe
+     *
+     *  @param  beamConstants the beam constants
+     *  @param  clusterListMap the cluster list map
+     *  @param  slidingFitDataListMap the sliding fit data list map
+     *  @param  showerClusterListMap the shower cluster list map
+     *  @param  kdTreeMap the kd tree map
+     *  @param  vertexVector the vector of vertices
+     *  @param  vertexFeatureInfoMap the map to populate
+     */
+    void PopulateVertexFeatureInfoMap(const BeamConstants &beamConstants, const ClusterListMap &clusterListMap,
+        const SlidingFitDataListMap &slidingFitDataListMap, const ShowerClusterListMap &showerClusterListMap, const KDTreeMap &kdTreeMap,
+        const pandora::VertexVector &vertexVector, VertexFeatureInfoMap &vertexFeatureInfoMap) const;
+
+    /**
+     *  @brief  Calculate the vertex feature info for a given vertex. May be called concurrently for different vertices if all feature
+     *          tools are thread safe
+     *
+     *  @param  beamConstants the beam constants
+     *  @param  clusterListMap the cluster list map
+     *  @param  slidingFitDataListMap the sliding fit data list map
+     *  @param  showerClusterListMap the shower cluster list map
+     *  @param  kdTreeMap the kd tree map
+     *  @param  pVertex the vertex
+     *
+     *  @return the vertex feature info
+     */
+    VertexFeatureInfo CalculateVertexFeatureInfo(const BeamConstants &beamConstants, const ClusterListMap &clusterListMap,
+        const SlidingFitDataListMap &slidingFitDataListMap, const ShowerClusterListMap &showerClusterListMap, const KDTreeMap &kdTreeMap,
+        const pandora::Vertex *const pVertex) const;
+
     /**
      *  @brief  Populate the initial vertex score list for a given vertex
      *
@@ -447,16 +481,18 @@ protected:
     void PopulateFinalVertexScoreList(const VertexFeatureInfoMap &vertexFeatureInfoMap, const pandora::Vertex *const pFavouriteVertex,
         const pandora::VertexVector &vertexVector, VertexScoreList &finalVertexScoreList) const;
 
+    pandora::StatusCode Reset();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
-    VertexFeatureTool::FeatureToolVector m_featureToolVector; ///< The feature tool vector
-    bool m_trainingSetMode;                                   ///< Whether to train
-    bool m_allowClassifyDuringTraining;                       ///< Whether classification is allowed during training
-    float m_mcVertexXCorrection;                              ///< The correction to the x-coordinate of the MC vertex position
-    std::string m_trainingOutputFileRegion;                   ///< The training output file for the region mva
-    std::string m_trainingOutputFileVertex;                   ///< The training output file for the vertex mva
-    std::string m_mcParticleListName;                         ///< The MC particle list for creating training examples
-    std::string m_caloHitListName;                            ///< The 2D CaloHit list name
+    VertexFeatureTool::FeatureToolVector m_featureToolVector;  ///< The feature tool vector
+    bool m_trainingSetMode;                                    ///< Whether to train
+    bool m_allowClassifyDuringTraining;                        ///< Whether classification is allowed during training
+    float m_mcVertexXCorrection;                               ///< The correction to the x-coordinate of the MC vertex position
+    std::string m_trainingOutputFileRegion;                    ///< The training output file for the region mva
+    std::string m_trainingOutputFileVertex;                    ///< The training output file for the vertex mva
+    LArMvaHelper::TrainingOutputFormat m_trainingOutputFormat; ///< The format of the training output files
+    std::string m_mcParticleListName;                          ///< The MC particle list for creating training examples
+    std::string m_caloHitListName;                             ///< The 2D CaloHit list name
 
     pandora::StringVector m_inputClusterListNames; ///< The list of cluster list names
     unsigned int m_minClusterCaloHits;             ///< The min number of hits parameter in the energy score
@@ -480,6 +516,7 @@ protected:
     bool m_testBeamMode;                      ///< Test beam mode
     bool m_legacyEventShapes;                 ///< Whether to use the old event shapes calculation
     bool m_legacyVariables;                   ///< Whether to only use the old variables
+    unsigned int m_maxFeatureThreads;         ///< The maximum number of threads with which to evaluate vertex features
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -170,9 +170,7 @@ CartesianVector VertexRefinementAlgorithm::RefineVertexTwoD(const ClusterList &c
         CartesianVector centroid(0.f, 0.f, 0.f);
         LArPcaHelper::EigenValues eigenValues(0.f, 0.f, 0.f);
         LArPcaHelper::EigenVectors eigenVectors;
-        CartesianPointVector pointVector;
-
-        LArClusterHelper::GetCoordinateVector(pCluster, pointVector);
+        const CartesianPointVector &pointVector(LArClusterHelper::GetClusterSummary(pCluster).GetPositions());
         LArPcaHelper::RunPca(pointVector, centroid, eigenValues, eigenVectors);
 
         intercepts.push_back(LArClusterHelper::GetClosestPosition(originalVtxPos, pCluster));
@@ -377,11 +377,8 @@ pandora::CartesianPointVector VertexSelectionBaseAlgorithm::ShowerCluster::GetCl
 
     for (const Cluster *const pCluster : clusterList)
     {
-        CartesianPointVector clusterCoordinateVector;
-        LArClusterHelper::GetCoordinateVector(pCluster, clusterCoordinateVector);
-
-        coordinateVector.insert(coordinateVector.end(), std::make_move_iterator(clusterCoordinateVector.begin()),
-            std::make_move_iterator(clusterCoordinateVector.end()));
+        const CartesianPointVector &clusterCoordinateVector(LArClusterHelper::GetClusterSummary(pCluster).GetSortedCoordinates());
+        coordinateVector.insert(coordinateVector.end(), clusterCoordinateVector.begin(), clusterCoordinateVector.end());
     }
 
     return coordinateVector;